@@ -178,11 +178,21 @@ def pack_params(params, attr_name, buffer,
         return
 
     # NOTE: dtypes of params might be mixed, in particular f16 & f32.
-    offset = 0
+    vs = []
     for param in params:
         v = getattr(param, attr_name)
         if attr_name == 'grad' and v is None and zero_fill:
             v = param.xp.zeros_like(param.data)
+        vs.append(v)
+
+    if all(isinstance(v, chx.ndarray) for v in vs):
+        # Packs and casts all the arrays in a single kernel call.
+        packed = chx.pack(vs, transfer_dtype)
+        buffer.from_device(packed, packed.nbytes, 0, stream)
+        return
+
+    offset = 0
+    for v in vs:
         size = v.size * np.dtype(transfer_dtype).itemsize
         if v.dtype != transfer_dtype:
             tmp = v.astype(transfer_dtype)
@@ -199,12 +209,25 @@ def unpack_params(params, attr_name, buffer,
     if len(params) == 0:
         return
     xp = chainer.backend.get_array_module(getattr(params[0], attr_name))
-    offset = 0
+    vs = []
     for param in params:
         v = getattr(param, attr_name)
         if attr_name == 'grad' and v is None and zero_fill:
             v = param.xp.empty_like(param.data)
             setattr(param, attr_name, v)
+        vs.append(v)
+
+    if all(isinstance(v, chx.ndarray) for v in vs):
+        # Casts and scatters the buffer into all the arrays in a single kernel
+        # call.
+        packed = chx.empty(
+            (sum(v.size for v in vs),), transfer_dtype, device=vs[0].device)
+        buffer.to_device(packed, packed.nbytes, 0, stream)
+        chx.unpack(packed, vs)
+        return
+
+    offset = 0
+    for param, v in zip(params, vs):
         size = v.size * np.dtype(transfer_dtype).itemsize
         grad_dtype = v.dtype
         if grad_dtype != transfer_dtype:
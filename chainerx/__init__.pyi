@@ -608,6 +608,12 @@ def batch_norm(
         axis: tp.Optional[tp.Union[int, tp.Tuple[int, ...]]]=None) -> ndarray: ...
 
 
+def bincount(
+        x: ndarray,
+        weights: tp.Optional[ndarray]=None,
+        minlength: int=...) -> ndarray: ...
+
+
 def bitwise_and(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 
@@ -641,7 +647,8 @@ def conv(
         b: tp.Optional[ndarray]=None,
         stride: tp.Union[int, tp.Tuple[int, ...]]=...,
         pad: tp.Union[int, tp.Tuple[int, ...]]=...,
-        cover_all: bool=False) -> ndarray: ...
+        cover_all: bool=False,
+        dilate: tp.Union[int, tp.Tuple[int, ...]]=...) -> ndarray: ...
 
 
 def conv_transpose(
@@ -650,7 +657,8 @@ def conv_transpose(
         b: tp.Optional[ndarray]=None,
         stride: tp.Union[int, tp.Tuple[int, ...]]=...,
         pad: tp.Union[int, tp.Tuple[int, ...]]=...,
-        outsize: tp.Optional[tp.Tuple[int, ...]]=None) -> ndarray: ...
+        outsize: tp.Optional[tp.Tuple[int, ...]]=None,
+        dilate: tp.Union[int, tp.Tuple[int, ...]]=...) -> ndarray: ...
 
 
 def copy(a: ndarray) -> ndarray: ...
@@ -677,6 +685,17 @@ def dot(a: ndarray, b: ndarray) -> ndarray: ...
 def dstack(arrays: tp.List[ndarray]) -> ndarray: ...
 
 
+def einsum(subscripts: str, *operands: ndarray) -> ndarray: ...
+
+
+def embedding_bag(
+        table: ndarray,
+        indices: ndarray,
+        offsets: ndarray,
+        mode: str=...,
+        per_sample_weights: tp.Optional[ndarray]=None) -> ndarray: ...
+
+
 def empty(
         shape: tp.Union[int, tp.Tuple[int, ...]],
         dtype: tp.Optional[tp.Any]=None,
@@ -759,6 +778,8 @@ def full_like(
         device: tp.Optional[Device]=None) -> ndarray: ...
 
 
+def gelu(x: ndarray, approximate: bool=False) -> ndarray: ...
+
 def greater(x1: ndarray, x2: ndarray) -> ndarray: ...
 
 
@@ -766,8 +787,16 @@ def greater_equal(x1: ndarray, x2: ndarray) -> ndarray: ...
 
 def gaussian_kl_divergence(mean: ndarray, ln_var: ndarray, reduce: tp.Optional[str]="sum") -> ndarray: ...
 
+def hard_swish(x: ndarray) -> ndarray: ...
+
 def hinge(x1: ndarray, x2: ndarray, norm: float=1.0) -> ndarray: ...
 
+def histogram(
+        a: ndarray,
+        bins: tp.Union[int, ndarray]=...,
+        range: tp.Optional[tp.Tuple[float, float]]=None,
+        weights: tp.Optional[ndarray]=None) -> tp.Tuple[ndarray, ndarray]: ...
+
 def hstack(arrays: tp.List[ndarray]) -> ndarray: ...
 
 def huber_loss(x: ndarray, t: ndarray, delta: float,reduce: tp.Optional[str]="sum_along_second_axis") -> ndarray: ...
@@ -865,10 +894,18 @@ def max_pool(
 def maximum(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 
+def median(
+        a: ndarray,
+        axis: tp.Union[int, tp.Optional[tp.List[int]]]=None,
+        keepdims: bool=...) -> ndarray: ...
+
+
 def meshgrid(arrays: tp.List[ndarray],
              indexing: tp.Optional[str]=...) -> tp.List[ndarray]: ...
 
 
+def mish(x: ndarray) -> ndarray: ...
+
 def minimum(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 
@@ -882,6 +919,26 @@ def moveaxis(a: ndarray, source: tp.Union[int, tp.Tuple[int, ...]],
 def multiply(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 
+def nanmedian(
+        a: ndarray,
+        axis: tp.Union[int, tp.Optional[tp.List[int]]]=None,
+        keepdims: bool=...) -> ndarray: ...
+
+
+def nanpercentile(
+        a: ndarray,
+        q: tp.Union[float, tp.Sequence[float]],
+        axis: tp.Union[int, tp.Optional[tp.List[int]]]=None,
+        keepdims: bool=...) -> ndarray: ...
+
+
+def nanquantile(
+        a: ndarray,
+        q: tp.Union[float, tp.Sequence[float]],
+        axis: tp.Union[int, tp.Optional[tp.List[int]]]=None,
+        keepdims: bool=...) -> ndarray: ...
+
+
 def nansum(a: ndarray,
         axis: tp.Optional[tp.Union[int, tp.List[int]]]=None,
         keepdims: bool=...) -> ndarray: ...
@@ -904,6 +961,13 @@ def ones(shape: tp.Union[int, tp.Sequence[int]],
 def ones_like(a: ndarray, device: tp.Optional[Device]=None) -> ndarray: ...
 
 
+def quantile(
+        a: ndarray,
+        q: tp.Union[float, tp.Sequence[float]],
+        axis: tp.Union[int, tp.Optional[tp.List[int]]]=None,
+        keepdims: bool=...) -> ndarray: ...
+
+
 def remainder(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 
@@ -915,8 +979,48 @@ def reshape(
 @tp.overload
 def reshape(a: ndarray, *args: tp.Any) -> ndarray: ...
 
+def scatter_reduce(
+        a: ndarray,
+        indices: ndarray,
+        b: ndarray,
+        reduce: str=...) -> ndarray: ...
+
+
+def searchsorted(a: ndarray, v: ndarray, side: str=...) -> ndarray: ...
+
+
+def segment_max(
+        data: ndarray,
+        segment_ids: ndarray,
+        num_segments: int,
+        sorted: bool=...) -> ndarray: ...
+
+
+def segment_mean(
+        data: ndarray,
+        segment_ids: ndarray,
+        num_segments: int,
+        sorted: bool=...) -> ndarray: ...
+
+
+def segment_min(
+        data: ndarray,
+        segment_ids: ndarray,
+        num_segments: int,
+        sorted: bool=...) -> ndarray: ...
+
+
+def segment_sum(
+        data: ndarray,
+        segment_ids: ndarray,
+        num_segments: int,
+        sorted: bool=...) -> ndarray: ...
+
+
 def sign(x: ndarray) -> ndarray: ...
 
+def silu(x: ndarray) -> ndarray: ...
+
 def sin(x: ndarray) -> ndarray: ...
 
 def sinh(x: ndarray) -> ndarray: ...
@@ -971,6 +1075,17 @@ def squared_difference(x1: ndarray, x2: ndarray) -> ndarray: ...
 
 def sqrt(x: ndarray) -> ndarray: ...
 
+def pack(arrays: tp.List[ndarray],
+         dtype: tp.Optional[tp.Any]=None) -> ndarray: ...
+
+
+def percentile(
+        a: ndarray,
+        q: tp.Union[float, tp.Sequence[float]],
+        axis: tp.Union[int, tp.Optional[tp.List[int]]]=None,
+        keepdims: bool=...) -> ndarray: ...
+
+
 def power(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 def squeeze(
@@ -1041,6 +1156,18 @@ def tril(m: ndarray, k: int=...) -> ndarray: ...
 def triu(m: ndarray, k: int=...) -> ndarray: ...
 
 
+def unique(
+        ar: ndarray,
+        return_index: bool=...,
+        return_inverse: bool=...,
+        return_counts: bool=...) -> tp.Union[ndarray, tp.Tuple[ndarray, ...]]: ...
+
+
+def unpack(packed: ndarray,
+           arrays: tp.List[ndarray],
+           scale: tp.Any=...) -> None: ...
+
+
 def vstack(arrays: tp.List[ndarray]) -> ndarray: ...
 
 def where(cond: ndarray, x: ndarray, y: ndarray) -> ndarray: ...
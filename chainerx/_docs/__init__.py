@@ -7,6 +7,7 @@ from chainerx._docs import backprop
 from chainerx._docs import context
 from chainerx._docs import device
 from chainerx._docs import routines
+from chainerx._docs import sparse
 from chainerx._docs import utils
 
 
@@ -21,5 +22,6 @@ def set_doc(obj, docstring):
 
 
 def set_docs():
-    for m in (array, backend, backprop, context, device, routines, utils):
+    for m in (array, backend, backprop, context, device, routines, sparse,
+              utils):
         m.set_docs()
@@ -629,6 +629,36 @@ Note:
 .. seealso:: :func:`numpy.nonzero`
 """)
 
+    _docs.set_doc(
+        chainerx.embedding_bag,
+        """embedding_bag(table, indices, offsets, mode='sum', \
+per_sample_weights=None)
+Reduces the rows of an embedding table into bags.
+
+The ``b``-th bag consists of the rows of ``table`` at
+``indices[offsets[b]:offsets[b + 1]]``, and the last one of those up to the
+end of ``indices``. The rows are reduced without being gathered into an
+intermediate array.
+
+Args:
+    table (~chainerx.ndarray): 2-D embedding table.
+    indices (~chainerx.ndarray): 1-D array of integral row indices.
+    offsets (~chainerx.ndarray): 1-D array of integral positions in
+        ``indices`` where the bags start. It must be non-decreasing from 0.
+    mode (str): Reduction of the bags, one of ``'sum'``, ``'mean'``,
+        ``'max'`` and ``'min'``.
+    per_sample_weights (~chainerx.ndarray): Weights of the rows, of the
+        same shape as ``indices``. They are only supported with ``'sum'``.
+
+Returns:
+    :class:`~chainerx.ndarray`: Array of shape
+    ``(len(offsets), table.shape[1])``. Empty bags are filled with zeros.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input arrays ``table`` and ``per_sample_weights``.
+""")
+
 
 def _docs_linalg():
     _docs.set_doc(
@@ -656,6 +686,36 @@ Note:
     output array to input arrays ``a`` and ``b``.
 
 .. seealso:: :func:`numpy.dot`
+""")
+
+    _docs.set_doc(
+        chainerx.einsum,
+        """einsum(subscripts, *operands)
+Evaluates the Einstein summation convention on the operands.
+
+The subscripts consist of a comma-separated list of labels for the axes of
+each operand, which may contain an ellipsis ``...`` standing for the leading
+axes, optionally followed by ``->`` and the labels of the output. Without
+``->``, the output is labeled by the ellipsis and then the labels that appear
+only once, in alphabetical order. Axes of length 1 are broadcast.
+
+Repeated labels in an operand take its diagonal and labels not in the output
+are summed over, so that e.g. ``'ii'`` is the trace of a matrix. The operands
+are contracted pairwise in the order with the fewest operations, which is
+searched for exhaustively for up to four operands and greedily otherwise.
+
+Args:
+    subscripts (str): Labels of the axes of the operands and the output.
+    operands (~chainerx.ndarray): Input arrays.
+
+Returns:
+    :class:`~chainerx.ndarray`: Output array.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input arrays ``operands``.
+
+.. seealso:: :func:`numpy.einsum`
 """)
 
     _docs.set_doc(
@@ -1414,6 +1474,54 @@ Note:
     output array to the input arrays in ``arrays``.
 
 .. seealso:: :func:`numpy.stack`
+""")
+
+    _docs.set_doc(
+        chainerx.pack,
+        """pack(arrays, dtype=None)
+Packs arrays into a contiguous 1-dimensional array.
+
+The elements of each array are laid out one array after another in row-major
+order. All the arrays are copied in a single kernel call regardless of their
+strides, which is useful to prepare communication buffers from many small
+arrays.
+
+Args:
+    arrays (sequence of :class:`~chainerx.ndarray`\\ s): Arrays to be packed.
+    dtype: Data type of the packed array. The elements are cast to this type.
+        If omitted, the result type of ``arrays`` is used.
+
+Returns:
+    ~chainerx.ndarray: Packed 1-dimensional array.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input arrays in ``arrays``.
+
+.. seealso:: :func:`chainerx.unpack`
+""")
+
+    _docs.set_doc(
+        chainerx.unpack,
+        """unpack(packed, arrays, scale=1)
+Unpacks a packed array into arrays in place.
+
+This is the inverse of :func:`chainerx.pack`. Consecutive ranges of
+``packed`` are multiplied by ``scale``, cast to the data types of the arrays
+and written into them in a single kernel call.
+
+Args:
+    packed (~chainerx.ndarray): 1-dimensional array whose size is the total
+        size of ``arrays``.
+    arrays (sequence of :class:`~chainerx.ndarray`\\ s): Arrays to be
+        overwritten.
+    scale (scalar): Factor by which the elements are multiplied.
+
+Note:
+    This function does not support backpropagation. The arrays must not
+    require gradients.
+
+.. seealso:: :func:`chainerx.pack`
 """)
 
     _docs.set_doc(
@@ -1887,6 +1995,139 @@ Note:
 .. seealso:: :func:`numpy.sum`
 """)
 
+    _docs.set_doc(
+        chainerx.segment_sum,
+        """segment_sum(data, segment_ids, num_segments, sorted=False)
+Sums the sub-arrays of an array over segments.
+
+The ``i``-th sub-array of ``data`` along the first axis is reduced into the
+``segment_ids[i]``-th segment.
+
+Args:
+    data (~chainerx.ndarray): Input array of at least 1 dimension.
+    segment_ids (~chainerx.ndarray): 1-D array of integral segment ids in
+        ``[0, num_segments)``, one for each sub-array of ``data``.
+    num_segments (int): Number of segments.
+    sorted (bool): If ``True``, ``segment_ids`` must be non-decreasing.
+        Sorted segments are reduced in parallel without per-thread buffers.
+
+Returns:
+    :class:`~chainerx.ndarray`: Array of shape
+    ``(num_segments,) + data.shape[1:]``. Empty segments are filled with
+    zeros.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``data``.
+""")
+
+    _docs.set_doc(
+        chainerx.segment_mean,
+        """segment_mean(data, segment_ids, num_segments, sorted=False)
+Averages the sub-arrays of an array over segments.
+
+The ``i``-th sub-array of ``data`` along the first axis is reduced into the
+``segment_ids[i]``-th segment.
+
+Args:
+    data (~chainerx.ndarray): Input array of at least 1 dimension.
+    segment_ids (~chainerx.ndarray): 1-D array of integral segment ids in
+        ``[0, num_segments)``, one for each sub-array of ``data``.
+    num_segments (int): Number of segments.
+    sorted (bool): If ``True``, ``segment_ids`` must be non-decreasing.
+        Sorted segments are reduced in parallel without per-thread buffers.
+
+Returns:
+    :class:`~chainerx.ndarray`: Array of shape
+    ``(num_segments,) + data.shape[1:]``. The mean of integral arrays is
+    computed in a floating point dtype. Empty segments are filled with zeros.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``data``.
+""")
+
+    _docs.set_doc(
+        chainerx.segment_max,
+        """segment_max(data, segment_ids, num_segments, sorted=False)
+Takes the maxima of the sub-arrays of an array over segments.
+
+The ``i``-th sub-array of ``data`` along the first axis is reduced into the
+``segment_ids[i]``-th segment.
+
+Args:
+    data (~chainerx.ndarray): Input array of at least 1 dimension.
+    segment_ids (~chainerx.ndarray): 1-D array of integral segment ids in
+        ``[0, num_segments)``, one for each sub-array of ``data``.
+    num_segments (int): Number of segments.
+    sorted (bool): If ``True``, ``segment_ids`` must be non-decreasing.
+        Sorted segments are reduced in parallel without per-thread buffers.
+
+Returns:
+    :class:`~chainerx.ndarray`: Array of shape
+    ``(num_segments,) + data.shape[1:]``. NaNs are propagated. Empty
+    segments are filled with zeros.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``data``. The gradient is propagated
+    to all the elements equal to the maxima.
+""")
+
+    _docs.set_doc(
+        chainerx.segment_min,
+        """segment_min(data, segment_ids, num_segments, sorted=False)
+Takes the minima of the sub-arrays of an array over segments.
+
+The ``i``-th sub-array of ``data`` along the first axis is reduced into the
+``segment_ids[i]``-th segment.
+
+Args:
+    data (~chainerx.ndarray): Input array of at least 1 dimension.
+    segment_ids (~chainerx.ndarray): 1-D array of integral segment ids in
+        ``[0, num_segments)``, one for each sub-array of ``data``.
+    num_segments (int): Number of segments.
+    sorted (bool): If ``True``, ``segment_ids`` must be non-decreasing.
+        Sorted segments are reduced in parallel without per-thread buffers.
+
+Returns:
+    :class:`~chainerx.ndarray`: Array of shape
+    ``(num_segments,) + data.shape[1:]``. NaNs are propagated. Empty
+    segments are filled with zeros.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``data``. The gradient is propagated
+    to all the elements equal to the minima.
+""")
+
+    _docs.set_doc(
+        chainerx.scatter_reduce,
+        """scatter_reduce(a, indices, b, reduce='sum')
+Reduces the sub-arrays of an array into those of another at given indices.
+
+Returns a copy of ``a`` whose ``indices[i]``-th sub-array along the first
+axis is reduced with the ``i``-th sub-array of ``b``. Sub-arrays scattered
+to the same index are all reduced.
+
+Args:
+    a (~chainerx.ndarray): Input array of at least 1 dimension.
+    indices (~chainerx.ndarray): 1-D array of integral indices of ``a``, one
+        for each sub-array of ``b``.
+    b (~chainerx.ndarray): Array of sub-arrays to be scattered. It is cast
+        to the dtype of ``a``.
+    reduce (str): Reduction, one of ``'sum'``, ``'mean'``, ``'max'`` and
+        ``'min'``. The mean is taken over the sub-array of ``a`` and all
+        the sub-arrays of ``b`` scattered to it.
+
+Returns:
+    :class:`~chainerx.ndarray`: Array of the same shape as ``a``.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input arrays ``a`` and ``b``.
+""")
+
     _docs.set_doc(
         chainerx.maximum,
         """maximum(x1, x2)
@@ -2191,6 +2432,79 @@ Note:
 .. seealso:: :func:`chainer.functions.sigmoid`
 """)
 
+    _docs.set_doc(
+        chainerx.gelu,
+        """gelu(x, approximate=False)
+Element-wise Gaussian error linear unit function.
+
+Args:
+    x (~chainerx.ndarray): Input array.
+    approximate (bool): If ``True``, the tanh approximation of
+        :math:`\\Phi` is used.
+
+Returns:
+    :class:`~chainerx.ndarray`: Returned array: :math:`y = x \\Phi(x)`,
+    where :math:`\\Phi` is the cumulative distribution function of the
+    standard normal distribution. The approximation is
+    :math:`\\Phi(x) \\approx \\frac{1}{2}(1 + \\tanh(\\sqrt{2 / \\pi}
+    (x + 0.044715 x^3)))`.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``x``.
+""")
+
+    _docs.set_doc(
+        chainerx.silu,
+        """silu(x)
+Element-wise sigmoid linear unit function, also known as Swish.
+
+Args:
+    x (~chainerx.ndarray): Input array.
+
+Returns:
+    :class:`~chainerx.ndarray`: Returned array:
+    :math:`y = x (1 + \\exp(-x))^{-1}`.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``x``.
+""")
+
+    _docs.set_doc(
+        chainerx.mish,
+        """mish(x)
+Element-wise Mish function.
+
+Args:
+    x (~chainerx.ndarray): Input array.
+
+Returns:
+    :class:`~chainerx.ndarray`: Returned array:
+    :math:`y = x \\tanh(\\log(1 + \\exp(x)))`.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``x``.
+""")
+
+    _docs.set_doc(
+        chainerx.hard_swish,
+        """hard_swish(x)
+Element-wise hard Swish function.
+
+Args:
+    x (~chainerx.ndarray): Input array.
+
+Returns:
+    :class:`~chainerx.ndarray`: Returned array:
+    :math:`y = x \\min(\\max(x + 3, 0), 6) / 6`.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input array ``x``.
+""")
+
     _docs.set_doc(
         chainerx.sin,
         """sin(x)
@@ -2747,6 +3061,60 @@ Returns:
 .. seealso:: :func:`numpy.argmin`
 """)
 
+    _docs.set_doc(
+        chainerx.searchsorted,
+        """searchsorted(a, v, side='left')
+Finds the indices at which values are to be inserted to keep arrays sorted.
+
+NaNs are sorted at the end of ``a``.
+
+Args:
+    a (~chainerx.ndarray): Array sorted in ascending order along its last
+        axis. If it has more than one dimension, each of its rows along the
+        last axis is searched for the values in the corresponding row of
+        ``v``.
+    v (~chainerx.ndarray): Values to insert into ``a``. If ``a`` has more
+        than one dimension, ``v`` must have the same leading dimensions.
+    side (str): If ``'left'``, the first suitable index is returned. If
+        ``'right'``, the last suitable index is returned.
+
+Returns:
+    :class:`~chainerx.ndarray`: The indices of the same shape as ``v``.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.searchsorted`
+""")
+
+    _docs.set_doc(
+        chainerx.unique,
+        """unique(ar, return_index=False, return_inverse=False, \
+return_counts=False)
+Finds the sorted unique elements of an array.
+
+The array is flattened. NaNs are sorted at the end and are regarded as equal.
+
+Args:
+    ar (~chainerx.ndarray): Input array.
+    return_index (bool): If ``True``, also returns the indices of the first
+        occurrences of the unique elements in the flattened array.
+    return_inverse (bool): If ``True``, also returns the indices of the
+        unique elements that reconstruct the flattened array.
+    return_counts (bool): If ``True``, also returns the number of occurrences
+        of each unique element.
+
+Returns:
+    :class:`~chainerx.ndarray` or tuple of :class:`~chainerx.ndarray`:
+    The unique elements, followed by the requested indices and counts if
+    any.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.unique`
+""")
+
 
 def _docs_statistics():
     _docs.set_doc(
@@ -2801,6 +3169,57 @@ Note:
     output array to the input array ``a``.
 
 .. seealso:: :func:`numpy.amin`
+""")
+
+    _docs.set_doc(
+        chainerx.bincount,
+        """bincount(x, weights=None, minlength=0)
+Counts the occurrences of each value in an array of non-negative integers.
+
+Args:
+    x (~chainerx.ndarray): 1-dimensional array of non-negative integers.
+    weights (~chainerx.ndarray): Weights of the elements of ``x`` of the same
+        shape. If given, the weights are summed instead of counting the
+        elements.
+    minlength (int): Minimum number of bins of the output.
+
+Returns:
+    :class:`~chainerx.ndarray`: The number of occurrences, or the sum of the
+    weights, of each value from ``0`` to the maximum of ``x``. It is of dtype
+    ``int64`` without weights, and otherwise of the dtype of the weights if
+    it is a floating point dtype, or ``float64``.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.bincount`
+""")
+
+    _docs.set_doc(
+        chainerx.histogram,
+        """histogram(a, bins=10, range=None, weights=None)
+Computes the histogram of an array.
+
+Args:
+    a (~chainerx.ndarray): Input array. It is flattened.
+    bins (int or ~chainerx.ndarray): Number of equal-width bins, or the
+        monotonically increasing edges of the bins. Each bin includes its
+        left edge, and the last bin also includes its right edge.
+    range (None or tuple of floats): Lower and upper edges of the bins if
+        ``bins`` is a number. The minimum and the maximum of ``a`` are used
+        by default. Elements outside the range, and NaNs, are ignored.
+    weights (~chainerx.ndarray): Weights of the elements of ``a`` of the same
+        shape. If given, the weights are summed instead of counting the
+        elements.
+
+Returns:
+    tuple of :class:`~chainerx.ndarray`: The histogram and the edges of the
+    bins. The histogram is of the dtype as in :func:`chainerx.bincount`.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.histogram`
 """)
 
     _docs.set_doc(
@@ -2824,6 +3243,165 @@ Returns:
     specified.
 
 .. seealso:: :func:`numpy.mean`
+""")
+
+    _docs.set_doc(
+        chainerx.median,
+        """median(a, axis=None, keepdims=False)
+Computes the median of an array along the specified axes.
+
+The result is NaN where any of the elements is NaN.
+
+Args:
+    a (~chainerx.ndarray): Array to take the median of.
+    axis (None or int or tuple of ints): Along which axis or axes to compute
+        the median. The flattened array is used by default.
+    keepdims (bool): If ``True``, the axes which are reduced are left in the
+        result as dimensions with size one.
+
+Returns:
+    :class:`~chainerx.ndarray`: The median of ``a``, along the axis or axes
+    if specified.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.median`
+""")
+
+    _docs.set_doc(
+        chainerx.nanmedian,
+        """nanmedian(a, axis=None, keepdims=False)
+Computes the median of an array along the specified axes.
+
+NaNs are ignored, and the result is NaN where all the elements are
+NaN.
+
+Args:
+    a (~chainerx.ndarray): Array to take the median of.
+    axis (None or int or tuple of ints): Along which axis or axes to compute
+        the median. The flattened array is used by default.
+    keepdims (bool): If ``True``, the axes which are reduced are left in the
+        result as dimensions with size one.
+
+Returns:
+    :class:`~chainerx.ndarray`: The median of ``a``, along the axis or axes
+    if specified.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.nanmedian`
+""")
+
+    _docs.set_doc(
+        chainerx.nanpercentile,
+        """nanpercentile(a, q, axis=None, keepdims=False)
+Computes the percentiles of an array along the specified axes.
+
+The percentiles are linearly interpolated between the nearest elements.
+NaNs are ignored, and the result is NaN where all the elements are
+NaN.
+
+Args:
+    a (~chainerx.ndarray): Array to take the percentiles of.
+    q (float or sequence of floats): Percentiles to compute, in the range
+        ``[0, 100]``.
+    axis (None or int or tuple of ints): Along which axis or axes to compute
+        the percentiles. The flattened array is used by default.
+    keepdims (bool): If ``True``, the axes which are reduced are left in the
+        result as dimensions with size one.
+
+Returns:
+    :class:`~chainerx.ndarray`: The percentiles of ``a``. If ``q`` is a
+    sequence, they are stacked along the first axis.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.nanpercentile`
+""")
+
+    _docs.set_doc(
+        chainerx.nanquantile,
+        """nanquantile(a, q, axis=None, keepdims=False)
+Computes the quantiles of an array along the specified axes.
+
+The quantiles are linearly interpolated between the nearest elements.
+NaNs are ignored, and the result is NaN where all the elements are
+NaN.
+
+Args:
+    a (~chainerx.ndarray): Array to take the quantiles of.
+    q (float or sequence of floats): Quantiles to compute, in the range
+        ``[0, 1]``.
+    axis (None or int or tuple of ints): Along which axis or axes to compute
+        the quantiles. The flattened array is used by default.
+    keepdims (bool): If ``True``, the axes which are reduced are left in the
+        result as dimensions with size one.
+
+Returns:
+    :class:`~chainerx.ndarray`: The quantiles of ``a``. If ``q`` is a
+    sequence, they are stacked along the first axis.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.nanquantile`
+""")
+
+    _docs.set_doc(
+        chainerx.percentile,
+        """percentile(a, q, axis=None, keepdims=False)
+Computes the percentiles of an array along the specified axes.
+
+The percentiles are linearly interpolated between the nearest elements.
+The result is NaN where any of the elements is NaN.
+
+Args:
+    a (~chainerx.ndarray): Array to take the percentiles of.
+    q (float or sequence of floats): Percentiles to compute, in the range
+        ``[0, 100]``.
+    axis (None or int or tuple of ints): Along which axis or axes to compute
+        the percentiles. The flattened array is used by default.
+    keepdims (bool): If ``True``, the axes which are reduced are left in the
+        result as dimensions with size one.
+
+Returns:
+    :class:`~chainerx.ndarray`: The percentiles of ``a``. If ``q`` is a
+    sequence, they are stacked along the first axis.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.percentile`
+""")
+
+    _docs.set_doc(
+        chainerx.quantile,
+        """quantile(a, q, axis=None, keepdims=False)
+Computes the quantiles of an array along the specified axes.
+
+The quantiles are linearly interpolated between the nearest elements.
+The result is NaN where any of the elements is NaN.
+
+Args:
+    a (~chainerx.ndarray): Array to take the quantiles of.
+    q (float or sequence of floats): Quantiles to compute, in the range
+        ``[0, 1]``.
+    axis (None or int or tuple of ints): Along which axis or axes to compute
+        the quantiles. The flattened array is used by default.
+    keepdims (bool): If ``True``, the axes which are reduced are left in the
+        result as dimensions with size one.
+
+Returns:
+    :class:`~chainerx.ndarray`: The quantiles of ``a``. If ``q`` is a
+    sequence, they are stacked along the first axis.
+
+Note:
+    This function is not differentiable.
+
+.. seealso:: :func:`numpy.quantile`
 """)
 
     _docs.set_doc(
@@ -2853,7 +3431,7 @@ Returns:
 def _docs_connection():
     _docs.set_doc(
         chainerx.conv,
-        """conv(x, w, b=None, stride=1, pad=0, cover_all=False)
+        """conv(x, w, b=None, stride=1, pad=0, cover_all=False, dilate=1)
 N-dimensional convolution.
 
 This is an implementation of N-dimensional convolution which is generalized
@@ -2917,6 +3495,12 @@ Args:
     cover_all (bool): If ``True``, all spatial locations are convoluted
         into some output pixels. It may make the output size larger.
         `cover_all` needs to be ``False`` if you want to use ``cuda`` backend.
+    dilate (:class:`int` or :class:`tuple` of :class:`int` s):
+        Dilation factors of filter applications
+        :math:`(r_1, r_2, ..., r_N)`. ``dilate=r`` is equivalent to
+        ``(r, r, ..., r)``. A filter of size :math:`k_n` dilated by
+        :math:`r_n` covers :math:`r_n (k_n - 1) + 1` input elements, which
+        replaces :math:`k_n` in the equations above.
 
 Returns:
     ~chainerx.ndarray:
@@ -2940,7 +3524,8 @@ Note:
     During backpropagation, this function propagates the gradient of the
     output array to input arrays ``x``, ``w``, and ``b``.
 
-.. seealso:: :func:`chainer.functions.convolution_nd`
+.. seealso:: :func:`chainer.functions.convolution_nd`,
+    :func:`chainer.functions.dilated_convolution_2d`
 
 .. admonition:: Example
 
@@ -2978,7 +3563,8 @@ astype(np.float32)
 
     _docs.set_doc(
         chainerx.conv_transpose,
-        """conv_transpose(x, w, b=None, stride=1, pad=0, outsize=None)
+        """conv_transpose(x, w, b=None, stride=1, pad=0, outsize=None, \
+dilate=1)
 N-dimensional transposed convolution.
 
 This is an implementation of N-dimensional transposed convolution, which is
@@ -3041,6 +3627,12 @@ Args:
         tuple of ints :math:`(l_1, l_2, ..., l_N)`. Default value is
         ``None`` and the outsize is estimated by input size, stride and
         pad.
+    dilate (:class:`int` or :class:`tuple` of :class:`int` s):
+        Dilation factors of filter applications
+        :math:`(r_1, r_2, ..., r_N)`. ``dilate=r`` is equivalent to
+        ``(r, r, ..., r)``. A filter of size :math:`k_n` dilated by
+        :math:`r_n` covers :math:`r_n (k_n - 1) + 1` output elements, which
+        replaces :math:`k_n` in the equations above.
 
 Returns:
     ~chainerx.ndarray:
@@ -0,0 +1,136 @@
+import chainerx
+from chainerx import _docs
+
+
+def set_docs():
+    sparse = chainerx.sparse
+
+    _docs.set_doc(
+        sparse.coo_matrix,
+        """coo_matrix(data, row, col, shape)
+Sparse matrix in the coordinate (COO) format.
+
+The ``p``-th non-zero element ``data[p]`` is at ``(row[p], col[p])``. The
+elements may be in any order, and elements at the same position are summed up.
+
+Args:
+    data (~chainerx.ndarray): 1-D array of the non-zero elements.
+    row (~chainerx.ndarray): 1-D integer array of their row indices.
+    col (~chainerx.ndarray): 1-D integer array of their column indices.
+    shape (tuple of ints): Shape of the matrix.
+
+Note:
+    The indices are stored as ``int64`` arrays.
+
+.. seealso:: :class:`scipy.sparse.coo_matrix`
+""")
+
+    _docs.set_doc(
+        sparse.coo_matrix.todense,
+        """todense()
+Returns the matrix as a dense array.
+
+The gradient of the output array is propagated to ``data``.
+""")
+
+    _docs.set_doc(
+        sparse.coo_matrix.tocsr,
+        """tocsr()
+Converts the matrix into the CSR format, sorting the elements by their rows.
+
+The gradient of the ``data`` of the output is propagated to ``data``.
+""")
+
+    _docs.set_doc(
+        sparse.csr_matrix,
+        """csr_matrix(data, indices, indptr, shape)
+Sparse matrix in the compressed sparse row (CSR) format.
+
+The non-zero elements in the ``i``-th row are
+``data[indptr[i]:indptr[i + 1]]`` at the columns
+``indices[indptr[i]:indptr[i + 1]]``.
+
+Args:
+    data (~chainerx.ndarray): 1-D array of the non-zero elements.
+    indices (~chainerx.ndarray): 1-D integer array of their column indices.
+    indptr (~chainerx.ndarray): 1-D integer array of the row pointers, whose
+        length is the number of rows plus one.
+    shape (tuple of ints): Shape of the matrix.
+
+Note:
+    The indices are stored as ``int64`` arrays.
+
+.. seealso:: :class:`scipy.sparse.csr_matrix`
+""")
+
+    _docs.set_doc(
+        sparse.csr_matrix.todense,
+        """todense()
+Returns the matrix as a dense array.
+
+The gradient of the output array is propagated to ``data``.
+""")
+
+    _docs.set_doc(
+        sparse.csr_matrix.tocoo,
+        """tocoo()
+Converts the matrix into the COO format, keeping the order of the elements.
+""")
+
+    _docs.set_doc(
+        sparse.to_coo,
+        """to_coo(a)
+Converts a matrix into a sparse matrix in the COO format.
+
+Args:
+    a (~chainerx.ndarray): 2-D array.
+
+Returns:
+    :class:`~chainerx.sparse.coo_matrix`: Sparse matrix of the non-zero
+    elements of ``a`` in C-order.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    non-zero elements to the input array ``a``.
+""")
+
+    _docs.set_doc(
+        sparse.to_csr,
+        """to_csr(a)
+Converts a matrix into a sparse matrix in the CSR format.
+
+Args:
+    a (~chainerx.ndarray): 2-D array.
+
+Returns:
+    :class:`~chainerx.sparse.csr_matrix`: Sparse matrix of the non-zero
+    elements of ``a``.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    non-zero elements to the input array ``a``.
+""")
+
+    _docs.set_doc(
+        sparse.matmul,
+        """matmul(a, b)
+Returns the product of a sparse matrix and a dense matrix or vector.
+
+The product is computed by the native kernels in parallel across the rows of
+``a``. Matrices in the COO format are converted into the CSR format first.
+
+Args:
+    a (~chainerx.sparse.coo_matrix or ~chainerx.sparse.csr_matrix): Sparse
+        matrix of shape ``(m, k)``.
+    b (~chainerx.ndarray): Dense array of shape ``(k, n)`` or ``(k,)``.
+
+Returns:
+    :class:`~chainerx.ndarray`: Output array of shape ``(m, n)`` or ``(m,)``.
+
+Note:
+    Sparse matrices are only supported by the native backend.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the non-zero elements ``a.data`` and to ``b``.
+""")
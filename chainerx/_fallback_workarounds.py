@@ -176,7 +176,7 @@ def _populate_ndarray():
                 'ChainerX setitem fallback for advanced indexing is not '
                 'supported for arrays that are connected to a graph.')
 
-        xp, dev, self = _from_chx(self)
+        xp, dev, arr = _from_chx(self)
         if isinstance(key, tuple):
             key = tuple([_from_chx(k)[2] for k in key])
         else:
@@ -184,7 +184,11 @@ def _populate_ndarray():
         _, _, value = _from_chx(value)
 
         with dev:
-            self[key] = value
+            arr[key] = value
+
+        # The buffer is written bypassing the ChainerX routines, which would
+        # otherwise bump the data version.
+        chainerx._core._bump_data_version(self)
 
     ndarray.__setitem__ = __setitem__
     ndarray.__getitem__ = __getitem__
@@ -0,0 +1,48 @@
+import typing as tp
+
+from chainerx import ndarray
+
+
+class coo_matrix:
+    data: ndarray
+    row: ndarray
+    col: ndarray
+    shape: tp.Tuple[int, ...]
+    nnz: int
+
+    def __init__(self,
+                 data: ndarray,
+                 row: ndarray,
+                 col: ndarray,
+                 shape: tp.Tuple[int, ...]) -> None: ...
+
+    def todense(self) -> ndarray: ...
+
+    def tocsr(self) -> csr_matrix: ...
+
+
+class csr_matrix:
+    data: ndarray
+    indices: ndarray
+    indptr: ndarray
+    shape: tp.Tuple[int, ...]
+    nnz: int
+
+    def __init__(self,
+                 data: ndarray,
+                 indices: ndarray,
+                 indptr: ndarray,
+                 shape: tp.Tuple[int, ...]) -> None: ...
+
+    def todense(self) -> ndarray: ...
+
+    def tocoo(self) -> coo_matrix: ...
+
+
+def to_coo(a: ndarray) -> coo_matrix: ...
+
+
+def to_csr(a: ndarray) -> csr_matrix: ...
+
+
+def matmul(a: tp.Union[coo_matrix, csr_matrix], b: ndarray) -> ndarray: ...
@@ -0,0 +1,186 @@
+// Measures the cold-start latency of ChainerX.
+//
+// The benchmark re-executes itself a number of times. Each child process measures the creation of a context, a backend and a device,
+// and the latency of the first and the second kernel calls, and the parent measures the wall time of the whole child process.
+// The difference between the process time and the sum of the phases approximates process creation, dynamic loading of the library
+// including the static initialization of kernel registrations, and process exit.
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/backend.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/creation.h"
+
+namespace chx = chainerx;
+
+namespace {
+
+enum Phase { kContext = 0, kBackend, kDevice, kFirstCall, kSecondCall, kProcess, kPhaseCount };
+
+const char* const kPhaseNames[kPhaseCount] = {"context", "backend", "device", "first call", "second call", "process"};
+
+using Clock = std::chrono::steady_clock;
+
+int64_t ElapsedNs(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+// Runs the phases in this process and writes the durations of all but the last phase to stdout.
+void RunChild(const std::string& device_name) {
+    std::array<int64_t, kPhaseCount> durations{};
+
+    Clock::time_point start = Clock::now();
+    chx::Context ctx{};
+    durations[kContext] = ElapsedNs(start);
+    chx::SetDefaultContext(&ctx);
+
+    chx::DeviceId device_id{device_name};
+    start = Clock::now();
+    chx::Backend& backend = ctx.GetBackend(device_id.backend_name());
+    durations[kBackend] = ElapsedNs(start);
+
+    start = Clock::now();
+    chx::Device& device = backend.GetDevice(device_id.index());
+    durations[kDevice] = ElapsedNs(start);
+    chx::SetDefaultDevice(&device);
+
+    for (Phase phase : {kFirstCall, kSecondCall}) {
+        start = Clock::now();
+        chx::Ones({2, 3}, chx::Dtype::kFloat32);
+        device.Synchronize();
+        durations[phase] = ElapsedNs(start);
+    }
+
+    for (int i = 0; i < kProcess; ++i) {
+        std::cout << durations[i] << ' ';
+    }
+    std::cout << std::endl;
+}
+
+// Executes this program as a child and returns the durations of all phases.
+std::array<int64_t, kPhaseCount> SpawnChild(const std::string& program, const std::string& device_name) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        throw std::runtime_error("pipe failed.");
+    }
+
+    Clock::time_point start = Clock::now();
+    pid_t pid = fork();
+    if (pid < 0) {
+        throw std::runtime_error("fork failed.");
+    }
+    if (pid == 0) {
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[0]);
+        close(fds[1]);
+        execl(program.c_str(), program.c_str(), "--child", "--device", device_name.c_str(), static_cast<char*>(nullptr));
+        std::_Exit(127);
+    }
+    close(fds[1]);
+
+    std::string output{};
+    std::array<char, 256> buffer{};
+    ssize_t n{};
+    while ((n = read(fds[0], buffer.data(), buffer.size())) > 0) {
+        output.append(buffer.data(), static_cast<size_t>(n));
+    }
+    close(fds[0]);
+
+    int status{};
+    waitpid(pid, &status, 0);
+    int64_t process_ns = ElapsedNs(start);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        throw std::runtime_error("Child process failed.");
+    }
+
+    std::array<int64_t, kPhaseCount> durations{};
+    std::istringstream is{output};
+    for (int i = 0; i < kProcess; ++i) {
+        if (!(is >> durations[i])) {
+            throw std::runtime_error("Malformed output from child process: " + output);
+        }
+    }
+    durations[kProcess] = process_ns;
+    return durations;
+}
+
+void Run(const std::string& program, const std::string& device_name, int64_t repeat) {
+    std::array<std::vector<int64_t>, kPhaseCount> samples{};
+    for (int64_t i = 0; i < repeat; ++i) {
+        std::array<int64_t, kPhaseCount> durations = SpawnChild(program, device_name);
+        for (int j = 0; j < kPhaseCount; ++j) {
+            samples[j].emplace_back(durations[j]);
+        }
+    }
+
+    std::cout << std::setw(14) << "phase" << std::setw(14) << "median[us]" << std::setw(14) << "min[us]" << std::endl;
+    for (int i = 0; i < kPhaseCount; ++i) {
+        std::vector<int64_t>& s = samples[i];
+        std::sort(s.begin(), s.end());
+        std::cout << std::fixed << std::setprecision(1) << std::setw(14) << kPhaseNames[i] << std::setw(14)
+                  << static_cast<double>(s[s.size() / 2]) * 1e-3 << std::setw(14) << static_cast<double>(s.front()) * 1e-3 << std::endl;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int64_t repeat{20};
+    bool child{false};
+    std::string device_name{"native:0"};
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        auto read_next_string = [&]() {
+            ++i;
+            if (i >= argc) {
+                throw std::runtime_error("The value of flag " + arg + " is omitted.");
+            }
+            return argv[i];
+        };
+
+        if (arg == "--repeat") {
+            repeat = std::atoi(read_next_string());
+        } else if (arg == "--device") {
+            device_name = read_next_string();
+        } else if (arg == "--child") {
+            child = true;
+        } else {
+            throw std::runtime_error("Unknown argument: " + arg);
+        }
+    }
+
+    if (child) {
+        RunChild(device_name);
+        return 0;
+    }
+
+    if (repeat < 1) {
+        throw std::runtime_error("Repeat count must be positive.");
+    }
+
+    std::cout << "Repeat: " << repeat << std::endl;
+    std::cout << "Device: " << device_name << std::endl;
+
+    // argv[0] may not contain a path if the program is found in PATH, so use the executable of this process instead.
+    Run("/proc/self/exe", device_name, repeat);
+}
@@ -0,0 +1,264 @@
+// Measures how inference throughput scales when multiple threads run the same model on shared parameters.
+//
+// For each thread count, every thread repeatedly runs the forward pass of a fixed MLP under no-backprop mode.
+// The benchmark reports the aggregate throughput, the speedup and parallel efficiency relative to a single thread, and the time spent
+// blocking on the internal mutexes of ChainerX (see chainerx/lock_profiling.h), so that serialization points become visible.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/lock_profiling.h"
+#include "chainerx/routines/activation.h"
+#include "chainerx/routines/connection.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/allocation_count.h"
+
+namespace chx = chainerx;
+
+namespace {
+
+chx::Array MakeRandomArray(const chx::Shape& shape, std::mt19937& gen) {
+    std::normal_distribution<float> dist{0.f, 0.05f};
+    int64_t n = shape.GetTotalSize();
+    std::shared_ptr<float> data{new float[n], std::default_delete<float[]>{}};
+    std::generate_n(data.get(), n, [&dist, &gen]() { return dist(gen); });
+    return chx::FromContiguousHostData(shape, chx::Dtype::kFloat32, static_cast<std::shared_ptr<void>>(data), chx::GetDefaultDevice());
+}
+
+class Model {
+public:
+    Model(int64_t n_in, int64_t n_hidden, int64_t n_out, int64_t n_layers, std::mt19937& gen) {
+        for (int64_t i = 0; i < n_layers; ++i) {
+            int64_t layer_in = i == 0 ? n_in : n_hidden;
+            int64_t layer_out = i == n_layers - 1 ? n_out : n_hidden;
+            weights_.emplace_back(MakeRandomArray({layer_out, layer_in}, gen));
+            biases_.emplace_back(chx::Zeros({layer_out}, chx::Dtype::kFloat32));
+        }
+    }
+
+    // Returns a model whose parameters are deep copies of this model's, used to exclude contention on shared parameters.
+    Model Copy() const {
+        Model model{};
+        for (size_t i = 0; i < weights_.size(); ++i) {
+            model.weights_.emplace_back(weights_[i].Copy());
+            model.biases_.emplace_back(biases_[i].Copy());
+        }
+        return model;
+    }
+
+    chx::Array operator()(const chx::Array& x) const {
+        chx::Array h = x;
+        for (size_t i = 0; i < weights_.size(); ++i) {
+            h = chx::Linear(h, weights_[i], biases_[i]);
+            if (i != weights_.size() - 1) {
+                h = chx::Relu(h);
+            }
+        }
+        return h;
+    }
+
+private:
+    Model() = default;
+
+    std::vector<chx::Array> weights_;
+    std::vector<chx::Array> biases_;
+};
+
+// Blocks threads until all of them are ready, so that their measured sections overlap.
+class StartGate {
+public:
+    explicit StartGate(size_t count) : count_{count} {}
+
+    void ArriveAndWait() {
+        std::unique_lock<std::mutex> lock{mutex_};
+        if (--count_ == 0) {
+            cv_.notify_all();
+        } else {
+            cv_.wait(lock, [this]() { return count_ == 0; });
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t count_;
+};
+
+struct Options {
+    size_t max_threads{std::max<size_t>(1, std::thread::hardware_concurrency())};
+    int64_t iterations{1000};
+    int64_t batch_size{1};
+    int64_t n_in{784};
+    int64_t n_hidden{256};
+    int64_t n_out{10};
+    int64_t n_layers{3};
+    bool copy_params{false};
+    std::string device_name{"native"};
+};
+
+// Runs the model on the given number of threads and returns the elapsed wall time in seconds.
+double RunThreads(const Model& model, const chx::Array& x, size_t thread_count, const Options& options) {
+    chx::Context& context = chx::GetDefaultContext();
+    chx::Device& device = chx::GetDefaultDevice();
+
+    std::vector<Model> models;
+    if (options.copy_params) {
+        for (size_t i = 0; i < thread_count; ++i) {
+            models.emplace_back(model.Copy());
+        }
+    }
+
+    // The gate includes the main thread, which starts the clock once all workers are warmed up.
+    StartGate gate{thread_count + 1};
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        const Model& thread_model = options.copy_params ? models[i] : model;
+        threads.emplace_back([&context, &device, &thread_model, &x, &gate, &options]() {
+            chx::SetDefaultContext(&context);
+            chx::SetDefaultDevice(&device);
+            chx::NoBackpropModeScope scope{};
+
+            // Warm up.
+            thread_model(x);
+            device.Synchronize();
+
+            gate.ArriveAndWait();
+            for (int64_t iteration = 0; iteration < options.iterations; ++iteration) {
+                thread_model(x);
+            }
+            device.Synchronize();
+        });
+    }
+
+    gate.ArriveAndWait();
+    chx::ResetLockWaitStats();
+    auto start = std::chrono::steady_clock::now();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return std::chrono::duration<double>{std::chrono::steady_clock::now() - start}.count();
+}
+
+void Run(const Options& options) {
+    std::mt19937 gen{0};
+    Model model{options.n_in, options.n_hidden, options.n_out, options.n_layers, gen};
+    chx::Array x = MakeRandomArray({options.batch_size, options.n_in}, gen);
+
+    {
+        chx::NoBackpropModeScope scope{};
+        chx::testing::AllocationCount allocations = chx::testing::CountAllocations([&model, &x]() { model(x); });
+        std::cout << "Allocations per forward: " << allocations.count << " (" << allocations.bytesize << " bytes)" << std::endl;
+    }
+
+    const chx::LockSite sites[] = {chx::LockSite::kKernelRegistry, chx::LockSite::kContext, chx::LockSite::kBackendDevices};
+
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "samples/s" << std::setw(10) << "speedup" << std::setw(12) << "efficiency";
+    for (chx::LockSite site : sites) {
+        std::ostringstream name;
+        name << site;
+        std::cout << std::setw(24) << name.str() + " waits" << std::setw(14) << "wait[ms]";
+    }
+    std::cout << std::endl;
+
+    // Powers of two, followed by the maximum thread count if it is not one of them.
+    std::vector<size_t> thread_counts;
+    for (size_t thread_count = 1; thread_count < options.max_threads; thread_count *= 2) {
+        thread_counts.emplace_back(thread_count);
+    }
+    thread_counts.emplace_back(options.max_threads);
+
+    double base_throughput{};
+    for (size_t thread_count : thread_counts) {
+        double elapsed = RunThreads(model, x, thread_count, options);
+        double throughput = static_cast<double>(thread_count * options.iterations * options.batch_size) / elapsed;
+        if (thread_count == 1) {
+            base_throughput = throughput;
+        }
+        double speedup = throughput / base_throughput;
+
+        std::cout << std::fixed << std::setprecision(2) << std::setw(8) << thread_count << std::setw(14) << throughput << std::setw(10)
+                  << speedup << std::setw(12) << speedup / thread_count;
+        for (chx::LockSite site : sites) {
+            chx::LockWaitStats stats = chx::GetLockWaitStats(site);
+            std::cout << std::setw(24) << stats.contended_count << std::setw(14) << static_cast<double>(stats.wait_ns) * 1e-6;
+        }
+        std::cout << std::endl;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options{};
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        auto read_next_string = [&]() {
+            ++i;
+            if (i >= argc) {
+                throw std::runtime_error("The value of flag " + arg + " is omitted.");
+            }
+            return argv[i];
+        };
+        auto read_next_int = [&]() { return std::atoi(read_next_string()); };
+
+        if (arg == "--threads") {
+            options.max_threads = read_next_int();
+        } else if (arg == "--iterations") {
+            options.iterations = read_next_int();
+        } else if (arg == "--batchsize") {
+            options.batch_size = read_next_int();
+        } else if (arg == "--unit") {
+            options.n_hidden = read_next_int();
+        } else if (arg == "--layer") {
+            options.n_layers = read_next_int();
+        } else if (arg == "--copy-params") {
+            options.copy_params = true;
+        } else if (arg == "--device") {
+            options.device_name = read_next_string();
+        } else {
+            throw std::runtime_error("Unknown argument: " + arg);
+        }
+    }
+
+    if (options.max_threads < 1) {
+        throw std::runtime_error("Thread count must be positive.");
+    }
+
+    chx::Context ctx{};
+    chx::SetDefaultContext(&ctx);
+    chx::Device& device = ctx.GetDevice(options.device_name);
+    chx::SetDefaultDevice(&device);
+
+    std::cout << "Max threads: " << options.max_threads << std::endl;
+    std::cout << "Iterations per thread: " << options.iterations << std::endl;
+    std::cout << "Minibatch size: " << options.batch_size << std::endl;
+    std::cout << "Hidden neurons: " << options.n_hidden << std::endl;
+    std::cout << "Layers: " << options.n_layers << std::endl;
+    std::cout << "Parameters: " << (options.copy_params ? "copied per thread" : "shared") << std::endl;
+    std::cout << "Device: " << device.name() << std::endl;
+
+    Run(options);
+}
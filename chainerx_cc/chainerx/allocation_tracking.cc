@@ -0,0 +1,21 @@
+#include "chainerx/allocation_tracking.h"
+
+#include <atomic>
+
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace internal {
+
+std::atomic<AllocationTracker*> AllocationTrackingScope::allocation_tracker_{nullptr};
+
+AllocationTrackingScope::AllocationTrackingScope(AllocationTracker& tracker) {
+    AllocationTracker* expected{nullptr};
+    bool exchanged = allocation_tracker_.compare_exchange_strong(expected, &tracker, std::memory_order_acq_rel);
+    CHAINERX_ASSERT(exchanged);  // nested use is not supported
+}
+
+AllocationTrackingScope::~AllocationTrackingScope() { allocation_tracker_.store(nullptr, std::memory_order_release); }
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chainerx {
+namespace internal {
+
+// Counts memory allocations made by devices.
+// Used in combination with AllocationTrackingScope to measure how many allocations a routine performs.
+// This class is thread safe.
+class AllocationTracker {
+public:
+    void operator()(size_t bytesize) {
+        count_.fetch_add(1, std::memory_order_relaxed);
+        bytesize_.fetch_add(static_cast<int64_t>(bytesize), std::memory_order_relaxed);
+    }
+
+    // Returns the number of allocations.
+    int64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    // Returns the total size of the allocations in bytes.
+    int64_t bytesize() const { return bytesize_.load(std::memory_order_relaxed); }
+
+    void Reset() {
+        count_.store(0, std::memory_order_relaxed);
+        bytesize_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> count_{0};
+    std::atomic<int64_t> bytesize_{0};
+};
+
+// A scope object to track allocations.
+// Allocations made by any device within the scope are reported to the tracker specified in the constructor.
+// Only one allocation tracking scope can exist at any given moment.
+class AllocationTrackingScope {
+public:
+    explicit AllocationTrackingScope(AllocationTracker& tracker);
+    ~AllocationTrackingScope();
+
+    AllocationTrackingScope(const AllocationTrackingScope&) = delete;
+    AllocationTrackingScope& operator=(const AllocationTrackingScope&) = delete;
+    AllocationTrackingScope(AllocationTrackingScope&& other) = delete;
+    AllocationTrackingScope& operator=(AllocationTrackingScope&& other) = delete;
+
+    static AllocationTracker* GetGlobalTracker() { return allocation_tracker_.load(std::memory_order_acquire); }
+
+private:
+    // The global allocation tracker.
+    static std::atomic<AllocationTracker*> allocation_tracker_;
+};
+
+// Reports an allocation to the global tracker, if any.
+// Devices must call this function for every allocation of a non-empty memory chunk.
+inline void RecordAllocation(size_t bytesize) {
+    if (AllocationTracker* tracker = AllocationTrackingScope::GetGlobalTracker()) {
+        (*tracker)(bytesize);
+    }
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,67 @@
+#include "chainerx/allocation_tracking.h"
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/allocation_count.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+TEST(AllocationTrackingTest, Track) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+
+    internal::AllocationTracker tracker{};
+    {
+        internal::AllocationTrackingScope scope{tracker};
+        Empty({2, 3}, Dtype::kFloat32);
+        Empty({4}, Dtype::kInt8);
+    }
+    EXPECT_EQ(2, tracker.count());
+    EXPECT_EQ(2 * 3 * 4 + 4, tracker.bytesize());
+
+    // Allocations outside of the scope are not tracked.
+    Empty({2, 3}, Dtype::kFloat32);
+    EXPECT_EQ(2, tracker.count());
+
+    tracker.Reset();
+    EXPECT_EQ(0, tracker.count());
+    EXPECT_EQ(0, tracker.bytesize());
+}
+
+TEST(AllocationTrackingTest, EmptyArrayIsNotTracked) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+
+    testing::AllocationCount allocations = testing::CountAllocations([]() { Empty({0, 3}, Dtype::kFloat32); });
+    EXPECT_EQ(0, allocations.count);
+    EXPECT_EQ(0, allocations.bytesize);
+}
+
+TEST(AllocationTrackingTest, ViewIsNotTracked) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+
+    Array a = Empty({2, 3}, Dtype::kFloat32);
+    testing::AllocationCount allocations = testing::CountAllocations([&a]() {
+        a.Transpose();
+        a.Reshape({3, 2});
+    });
+    EXPECT_EQ(0, allocations.count);
+}
+
+TEST(AllocationTrackingTest, GlobalTracker) {
+    EXPECT_EQ(nullptr, internal::AllocationTrackingScope::GetGlobalTracker());
+    internal::AllocationTracker tracker{};
+    {
+        internal::AllocationTrackingScope scope{tracker};
+        EXPECT_EQ(&tracker, internal::AllocationTrackingScope::GetGlobalTracker());
+    }
+    EXPECT_EQ(nullptr, internal::AllocationTrackingScope::GetGlobalTracker());
+}
+
+}  // namespace
+}  // namespace chainerx
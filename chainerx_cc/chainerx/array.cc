@@ -27,6 +27,7 @@
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
 #include "chainerx/context.h"
+#include "chainerx/data_version.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
@@ -491,8 +492,9 @@ Array Array::AsType(Dtype dtype, bool copy) const {
 }
 
 void Array::Fill(Scalar value) const {
-    internal::CheckNoUnsafeInplace(*this, {});
+    internal::CheckNoUnsafeInplace(*this);
     device().backend().CallKernel<FillKernel>(*this, value);
+    internal::BumpDataVersion(*this);
 }
 
 const absl::optional<Array>& Array::GetGrad(const absl::optional<BackpropId>& backprop_id) const {
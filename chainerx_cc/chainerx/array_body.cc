@@ -4,11 +4,13 @@
 #include <cstdint>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "chainerx/array.h"
 #include "chainerx/array_body_leak_detection.h"
 #include "chainerx/array_node.h"
 #include "chainerx/backward.h"
+#include "chainerx/data_version.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
@@ -43,6 +45,10 @@ std::shared_ptr<ArrayBody> CreateArrayBody(ArrayBody::Params params) {
 
 const std::shared_ptr<ArrayNode> ArrayBody::kNullArrayNode{nullptr};
 
+const std::vector<BackpropId> ArrayBody::kNoBackpropIds{};
+
+const std::vector<std::shared_ptr<ArrayNode>> ArrayBody::kNoArrayNodes{};
+
 ArrayBody::ArrayBody(
         const Shape& shape,  // NOLINT(modernize-pass-by-value)
         const Strides& strides,  // NOLINT(modernize-pass-by-value)
@@ -50,7 +56,13 @@ ArrayBody::ArrayBody(
         Device& device,
         std::shared_ptr<void> data,
         int64_t offset)
-    : shape_{shape}, strides_{strides}, dtype_{dtype}, device_{device}, data_{std::move(data)}, offset_{offset} {}
+    : shape_{shape},
+      strides_{strides},
+      dtype_{dtype},
+      device_{device},
+      data_{MakeVersionedData(std::move(data))},
+      offset_{offset},
+      data_version_{FindDataVersion(data_)} {}
 
 ArrayBody::ArrayBody(Params params)
     : ArrayBody{params.shape, params.strides, params.dtype, params.device, std::move(params.data), params.offset} {}
@@ -62,25 +74,27 @@ const std::shared_ptr<ArrayNode>& ArrayBody::AddNode(const std::shared_ptr<Array
     // as a retained output of backward)
     CHAINERX_ASSERT(array_node->weak_body().expired());
 
-    auto it = std::find_if(body->nodes_.begin(), body->nodes_.end(), [&array_node](const std::shared_ptr<ArrayNode>& existing_node) {
+    GraphData& graph_data = body->GetOrCreateGraphData();
+    std::vector<std::shared_ptr<ArrayNode>>& nodes = graph_data.nodes;
+    auto it = std::find_if(nodes.begin(), nodes.end(), [&array_node](const std::shared_ptr<ArrayNode>& existing_node) {
         return existing_node->backprop_id() == array_node->backprop_id();
     });
-    if (it != body->nodes_.end()) {
+    if (it != nodes.end()) {
         return *it;  // Do nothing and return the existing ArrayNode if found for this graph.
     }
 
     // Connect the new backprop ID and the existing backprop IDs in this array body.
-    for (const std::shared_ptr<ArrayNode>& existing_array_node : body->nodes_) {
+    for (const std::shared_ptr<ArrayNode>& existing_array_node : nodes) {
         existing_array_node->device().context().ConnectBackpropIds(existing_array_node->backprop_id(), array_node->backprop_id());
     }
 
     array_node->weak_body_ = body;
 
-    body->nodes_.emplace_back(std::move(array_node));
-    body->grads_.emplace_back(std::make_unique<absl::optional<Array>>(absl::nullopt));
+    nodes.emplace_back(std::move(array_node));
+    graph_data.grads.emplace_back(std::make_unique<absl::optional<Array>>(absl::nullopt));
 
     body->AssertConsistency();
-    return body->nodes_.back();
+    return nodes.back();
 }
 
 const std::shared_ptr<ArrayNode>& ArrayBody::CreateArrayNode(const std::shared_ptr<ArrayBody>& body, const BackpropId& backprop_id) {
@@ -90,16 +104,22 @@ const std::shared_ptr<ArrayNode>& ArrayBody::CreateArrayNode(const std::shared_p
 
 void ArrayBody::AssertConsistency() const {
     if (CHAINERX_DEBUG) {
+        if (graph_data_ == nullptr) {
+            return;
+        }
+        const std::vector<std::shared_ptr<ArrayNode>>& nodes = graph_data_->nodes;
+        const std::vector<std::unique_ptr<absl::optional<Array>>>& grads = graph_data_->grads;
+
         // Array with integral dtypes can neither have array nodes nor gradients.
         if (GetKind(dtype()) != DtypeKind::kFloat) {
-            CHAINERX_ASSERT(nodes_.empty());
-            CHAINERX_ASSERT(grads_.empty());
+            CHAINERX_ASSERT(nodes.empty());
+            CHAINERX_ASSERT(grads.empty());
         }
 
-        CHAINERX_ASSERT(nodes_.size() == grads_.size());
-        for (size_t i = 0; i < nodes_.size(); ++i) {
-            const std::shared_ptr<ArrayNode>& array_node = nodes_[i];
-            const absl::optional<Array>& grad = *grads_[i];
+        CHAINERX_ASSERT(nodes.size() == grads.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const std::shared_ptr<ArrayNode>& array_node = nodes[i];
+            const absl::optional<Array>& grad = *grads[i];
             CHAINERX_ASSERT(array_node != nullptr);
             CHAINERX_ASSERT(this == array_node->weak_body().lock().get());
 
@@ -113,9 +133,20 @@ void ArrayBody::AssertConsistency() const {
     }
 }
 
+ArrayBody::GraphData& ArrayBody::GetOrCreateGraphData() {
+    if (graph_data_ == nullptr) {
+        graph_data_ = std::make_unique<GraphData>();
+    }
+    return *graph_data_;
+}
+
 absl::optional<size_t> ArrayBody::GetNodeIndex(const BackpropId& backprop_id) const {
-    for (size_t i = 0; i < nodes_.size(); ++i) {
-        if (nodes_[i]->backprop_id() == backprop_id) {
+    if (graph_data_ == nullptr) {
+        return absl::nullopt;
+    }
+    const std::vector<std::shared_ptr<ArrayNode>>& nodes = graph_data_->nodes;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i]->backprop_id() == backprop_id) {
             return i;
         }
     }
@@ -140,8 +171,8 @@ ReturnType ArrayBody::GetGradImpl(ThisPtr this_ptr, const BackpropId& backprop_i
     if (!i.has_value()) {
         return nullptr;
     }
-    CHAINERX_ASSERT(*i < this_ptr->grads_.size());
-    return this_ptr->grads_[*i].get();
+    CHAINERX_ASSERT(*i < this_ptr->graph_data_->grads.size());
+    return this_ptr->graph_data_->grads[*i].get();
 }
 
 template absl::optional<Array>* ArrayBody::GetGradImpl<ArrayBody*, absl::optional<Array>*>(ArrayBody*, const BackpropId&);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -55,14 +56,16 @@ public:
 
     int64_t offset() const { return offset_; }
 
+    // Returns the version of the data buffer (see GetDataVersion), or nullptr if the data is null.
+    std::atomic<uint64_t>* data_version() const { return data_version_; }
+
     // Returns the list of backprop IDs whose gradients are marked as required.
     // This does not take backprop mode into account.
-    const std::vector<BackpropId>& grad_required_backprop_ids() const { return grad_required_backprop_ids_; }
-
-    const std::vector<std::shared_ptr<ArrayNode>>& nodes() const { return nodes_; }
+    const std::vector<BackpropId>& grad_required_backprop_ids() const {
+        return graph_data_ == nullptr ? kNoBackpropIds : graph_data_->grad_required_backprop_ids;
+    }
 
-    // TODO(niboshi): Remove this function and add another to assign an array node at a specified index.
-    std::vector<std::shared_ptr<ArrayNode>>& nodes() { return nodes_; }
+    const std::vector<std::shared_ptr<ArrayNode>>& nodes() const { return graph_data_ == nullptr ? kNoArrayNodes : graph_data_->nodes; }
 
     int64_t GetItemSize() const { return chainerx::GetItemSize(dtype()); }
 
@@ -72,8 +75,8 @@ public:
     // This does not take backprop mode into account.
     bool IsGradRequired(const BackpropId& backprop_id) const {
         backprop_id.CheckValid();
-        return grad_required_backprop_ids_.end() !=
-               std::find(grad_required_backprop_ids_.begin(), grad_required_backprop_ids_.end(), backprop_id);
+        const std::vector<BackpropId>& backprop_ids = grad_required_backprop_ids();
+        return backprop_ids.end() != std::find(backprop_ids.begin(), backprop_ids.end(), backprop_id);
     }
 
     // Mark the gradient of the specified backprop ID as required.
@@ -82,9 +85,9 @@ public:
         backprop_id.CheckValid();
         CHAINERX_ASSERT(GetKind(body->dtype_) == DtypeKind::kFloat);
 
-        if (body->grad_required_backprop_ids_.end() ==
-            std::find(body->grad_required_backprop_ids_.begin(), body->grad_required_backprop_ids_.end(), backprop_id)) {
-            body->grad_required_backprop_ids_.emplace_back(backprop_id);
+        std::vector<BackpropId>& backprop_ids = body->GetOrCreateGraphData().grad_required_backprop_ids;
+        if (backprop_ids.end() == std::find(backprop_ids.begin(), backprop_ids.end(), backprop_id)) {
+            backprop_ids.emplace_back(backprop_id);
 
             if (!body->HasArrayNode(backprop_id)) {
                 CreateArrayNode(body, backprop_id);
@@ -99,7 +102,7 @@ public:
     const std::shared_ptr<ArrayNode>& GetArrayNode(const BackpropId& backprop_id) const {
         absl::optional<size_t> index = GetNodeIndex(backprop_id);
         if (index.has_value()) {
-            return nodes_[*index];
+            return graph_data_->nodes[*index];
         }
 
         return kNullArrayNode;
@@ -142,6 +145,14 @@ public:
     void ClearGrad(const BackpropId& backprop_id);
 
 private:
+    // Backprop graph data of the array.
+    // It is allocated on the first use, since most arrays (e.g. temporaries in inference) are never connected to graphs.
+    struct GraphData {
+        std::vector<BackpropId> grad_required_backprop_ids;
+        std::vector<std::shared_ptr<ArrayNode>> nodes;
+        std::vector<std::unique_ptr<absl::optional<Array>>> grads;
+    };
+
     friend std::shared_ptr<ArrayBody> CreateArrayBody(
             const Shape& shape, const Strides& strides, Dtype dtype, Device& device, std::shared_ptr<void> data, int64_t offset);
 
@@ -161,10 +172,18 @@ private:
 
     absl::optional<size_t> GetNodeIndex(const BackpropId& backprop_id) const;
 
+    GraphData& GetOrCreateGraphData();
+
     // The use of non-POD static storage object here is safe, because destructing a shared_ptr with nullptr does not incur any
     // destruction order problem.
     static const std::shared_ptr<ArrayNode> kNullArrayNode;
 
+    // Returned by the accessors of the graph data if it is not allocated.
+    // As with kNullArrayNode, the use of non-POD static storage objects here is safe, because destructing an empty vector does not incur
+    // any destruction order problem.
+    static const std::vector<BackpropId> kNoBackpropIds;
+    static const std::vector<std::shared_ptr<ArrayNode>> kNoArrayNodes;
+
     Shape shape_;
     Strides strides_;
     Dtype dtype_;
@@ -172,9 +191,10 @@ private:
     std::shared_ptr<void> data_;
     int64_t offset_;  // in bytes
 
-    std::vector<BackpropId> grad_required_backprop_ids_;
-    std::vector<std::shared_ptr<ArrayNode>> nodes_;
-    std::vector<std::unique_ptr<absl::optional<Array>>> grads_;
+    // Cached from the deleter of data_ to make reading the version a single load.
+    std::atomic<uint64_t>* data_version_;
+
+    std::unique_ptr<GraphData> graph_data_;
 };
 
 std::shared_ptr<ArrayBody> CreateArrayBody(
@@ -33,6 +33,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/op_node.h"
+#include "chainerx/routines/creation.h"
 #include "chainerx/routines/indexing.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
@@ -770,7 +771,19 @@ TEST_P(ArrayTest, InplaceWithArrayNodes) {
         Array x = testing::BuildArray({4, 1}).WithLinearData<float>();
         Array y = testing::BuildArray({4, 1}).WithLinearData<float>();
         x.RequireGrad(backprop_id);
-        EXPECT_THROW({ y *= x; }, ChainerxError);
+        y += x;  // no throw
+        Backward(y, backprop_id);
+        EXPECT_ARRAY_EQ(OnesLike(x), *x.GetGrad(backprop_id));
+    }
+
+    // Only input array has nodes, and the in-place input is retained for backward
+    {
+        Array x = testing::BuildArray({4, 1}).WithLinearData<float>();
+        Array y = testing::BuildArray({4, 1}).WithLinearData<float>();
+        x.RequireGrad(backprop_id);
+        y *= x;  // no throw
+        // The backward of x needs the original data of y, which has been overwritten.
+        EXPECT_THROW(Backward(y, backprop_id), ChainerxError);
     }
 
     // Only output arrays has nodes, with no backprop scope
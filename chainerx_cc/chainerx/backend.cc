@@ -1,10 +1,12 @@
 #include "chainerx/backend.h"
 
+#include <mutex>
 #include <string>
 #include <utility>
 
 #include "chainerx/device.h"
 #include "chainerx/kernel_registry.h"
+#include "chainerx/lock_profiling.h"
 
 namespace chainerx {
 
@@ -19,7 +21,7 @@ Device& Backend::GetDevice(int index) {
         throw std::out_of_range{"The index number (= " + std::to_string(index) + ") is negative"};
     }
     std::unique_ptr<Device> device = CreateDevice(index);
-    std::lock_guard<std::mutex> lock{devices_mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{devices_mutex_};
     if (devices_.size() <= static_cast<size_t>(index)) {
         devices_.resize(index + 1);
     }
@@ -7,7 +7,9 @@
 #include <vector>
 
 #include "chainerx/kernel.h"
+#include "chainerx/kernel_call_recording.h"
 #include "chainerx/kernel_registry.h"
+#include "chainerx/lock_profiling.h"
 
 namespace chainerx {
 
@@ -54,9 +56,16 @@ public:
     virtual bool SupportsTransfer(Device& src_device, Device& dst_device) = 0;
 
     // Calls the kernel implementation.
+    // The call is reported to the global kernel call recorder, if any.
     template <typename KernelType, typename... Args>
     auto CallKernel(Args&&... args) {
         Kernel& kernel = kernel_registry_.GetKernel<KernelType>();
+        {
+            KernelCallRecordingScope::RecorderHolder holder{};
+            if (KernelCallRecorder* recorder = holder.get()) {
+                internal::RecordKernelCall(*recorder, internal::GetKeyKernelName<KernelType>(), args...);
+            }
+        }
         return dynamic_cast<KernelType&>(kernel).Call(std::forward<Args>(args)...);
     }
 
@@ -73,7 +82,7 @@ private:
 
     std::vector<std::unique_ptr<Device>> devices_;
 
-    std::mutex devices_mutex_;
+    internal::ProfiledMutex devices_mutex_{LockSite::kBackendDevices};
 
     KernelRegistry kernel_registry_;
 };
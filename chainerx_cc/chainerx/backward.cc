@@ -14,6 +14,7 @@
 
 #include "chainerx/array.h"
 #include "chainerx/array_body.h"
+#include "chainerx/array_index.h"
 #include "chainerx/array_node.h"
 #include "chainerx/backprop_mode.h"
 #include "chainerx/backward_context.h"
@@ -23,6 +24,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernels/arithmetic.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
 #include "chainerx/routines/creation.h"
@@ -243,6 +245,8 @@ public:
             absl::optional<float> loss_scale)
         : BackwardImpl{inputs, outputs, backprop_id, double_backprop, {}, false, loss_scale} {}
 
+    void set_observer(internal::OpNodeBackwardObserver* observer) { observer_ = observer; }
+
     void Run() {
         CHAINERX_ASSERT(output_array_nodes_.size() == outputs_.size());
 
@@ -280,8 +284,14 @@ public:
 
             // Backpropagate gradients from the output array nodes into the input array nodes.
             {
+                if (observer_ != nullptr) {
+                    observer_->OnBeginBackward(*op_node);
+                }
                 std::vector<absl::optional<Array>> gxs = ComputeInputGradients(op_node);
                 AccumulateInputGradients(*op_node, std::move(gxs));
+                if (observer_ != nullptr) {
+                    observer_->OnEndBackward(*op_node);
+                }
             }
 
             // Push the creator op nodes into the queue
@@ -301,6 +311,7 @@ public:
                 for (auto it = range.first; it != range.second; ++it) {
                     size_t n_removed = array_node_grad_map_.erase(it->second.get());
                     CHAINERX_ASSERT(n_removed > 0);
+                    owned_grad_buffers_.erase(it->second.get());
                 }
             }
         }
@@ -435,6 +446,7 @@ private:
         // The given backward entry will compute and store a subset of those gradients.
         // The backward entry may compute and store the gradients of other inputs as well, which will be ignored.
         std::vector<Array> computed_input_grads(input_grads.size());
+        std::vector<absl::optional<internal::RegionGrad>> computed_input_region_grads(input_grads.size());
 
         // Call backward.
         BackwardContext bctx{op_node,
@@ -442,6 +454,7 @@ private:
                              absl::MakeSpan(output_array_nodes),
                              absl::MakeSpan(output_grads),
                              computed_input_grads,
+                             computed_input_region_grads,
                              double_backprop_};
         {
             NoBackpropModeScope scope{backprop_ids_to_stop_gradient_};
@@ -459,7 +472,8 @@ private:
             }
 
             Array& computed_input_grad = gsl::at(computed_input_grads, i_input_grad);
-            if (internal::GetArrayBody(computed_input_grad) == nullptr) {
+            absl::optional<internal::RegionGrad>& computed_input_region_grad = gsl::at(computed_input_region_grads, i_input_grad);
+            if (internal::GetArrayBody(computed_input_grad) == nullptr && !computed_input_region_grad.has_value()) {
                 // Input grad is not set by backward function
                 continue;
             }
@@ -474,6 +488,11 @@ private:
                     internal::GradRef& input_grad = array_node_grad_map_.at(input_array_node.get());
                     to_scale_back_nodes_.insert(&input_grad);
                 }
+                if (computed_input_region_grad.has_value()) {
+                    // Region gradients bypass the input gradients of the op node and are accumulated directly.
+                    AccumulateInputRegionGrad(*op_node, *input_array_node, std::move(*computed_input_region_grad));
+                    continue;
+                }
                 try {
                     internal::SetGrad(
                             input_grad,
@@ -527,13 +546,22 @@ private:
                 const ArrayNode& input_array_node = *input_array_nodes[i];
                 // Retrieve the pointer to the input gradient.
                 internal::GradRef& input_grad = array_node_grad_map_.at(input_array_nodes[i].get());
+                absl::optional<Array>& target_grad = input_grad.get();
                 try {
+                    if (IsOwnedGradBuffer(input_array_node, target_grad)) {
+                        // Add to the buffer in-place.
+                        internal::CheckGradCompatible(
+                                *gx, input_array_node.shape(), input_array_node.dtype(), input_array_node.device());
+                        input_array_node.device().backend().CallKernel<AddKernel>(*target_grad, *gx, *target_grad);
+                        continue;
+                    }
+                    bool is_sum = target_grad.has_value();
                     internal::AccumulateGrad(
-                            input_grad.get(),
-                            std::move(*gx),
-                            input_array_node.shape(),
-                            input_array_node.dtype(),
-                            input_array_node.device());
+                            target_grad, std::move(*gx), input_array_node.shape(), input_array_node.dtype(), input_array_node.device());
+                    if (is_sum) {
+                        // The sum is a new array which nothing else refers to, so following gradients can be added to it in-place.
+                        SetOwnedGradBuffer(input_array_node, *target_grad);
+                    }
                 } catch (const GradientError& e) {
                     // TODO(niboshi): Use std::nested_exception
                     throw GradientError{e.what(), " Op: ", op_node.name()};
@@ -542,6 +570,51 @@ private:
         }
     }
 
+    // Adds a region gradient into the gradient of the input array node.
+    // The gradient of the array node is replaced with a buffer owned by this backward computation unless it is already, so that the
+    // gradients of multiple regions are accumulated into a single buffer.
+    void AccumulateInputRegionGrad(const OpNode& op_node, ArrayNode& input_array_node, internal::RegionGrad region_grad) {
+        CHAINERX_ASSERT(double_backprop_ == DoubleBackpropOption::kDisable);
+        const Array& grad = region_grad.grad;
+        if (grad.dtype() != input_array_node.dtype() || &grad.device() != &input_array_node.device()) {
+            throw GradientError{"Gradient dtypes or devices do not match. Op: ", op_node.name()};
+        }
+
+        absl::optional<Array>& target_grad = array_node_grad_map_.at(&input_array_node).get();
+        NoBackpropModeScope scope{};
+        if (!IsOwnedGradBuffer(input_array_node, target_grad)) {
+            Array buffer = target_grad.has_value() ? target_grad->Copy()
+                                                   : Zeros(input_array_node.shape(), input_array_node.dtype(), input_array_node.device());
+            target_grad = buffer;
+            SetOwnedGradBuffer(input_array_node, buffer);
+        }
+
+        Array target_region = target_grad->At(region_grad.indices);
+        if (target_region.shape() != grad.shape()) {
+            throw GradientError{
+                    "Gradient shapes do not match. Expected: ", target_region.shape(), " Actual: ", grad.shape(), ". Op: ", op_node.name()};
+        }
+        input_array_node.device().backend().CallKernel<AddKernel>(target_region, grad, target_region);
+    }
+
+    // Returns whether the gradient is a buffer which is created and exclusively referred by this backward computation.
+    // Such buffers can be modified in-place for accumulation.
+    bool IsOwnedGradBuffer(const ArrayNode& array_node, const absl::optional<Array>& grad) const {
+        if (!grad.has_value()) {
+            return false;
+        }
+        auto it = owned_grad_buffers_.find(&array_node);
+        return it != owned_grad_buffers_.end() && it->second == internal::GetArrayBody(*grad);
+    }
+
+    void SetOwnedGradBuffer(const ArrayNode& array_node, const Array& grad) {
+        // In-place updates would not be recorded in the graph of the gradients.
+        if (double_backprop_ == DoubleBackpropOption::kEnable) {
+            return;
+        }
+        owned_grad_buffers_[&array_node] = internal::GetArrayBody(grad);
+    }
+
     void PushCreatorOpNode(const std::shared_ptr<ArrayNode>& array_node) {
         // When double backprop is disabled, array_node releases the pointer to the creator op node here. After this operation, array_node
         // will look like a leaf node of the graph. Note that this move does not invalidates the array_node object itself; it is guaranteed
@@ -600,10 +673,35 @@ private:
     absl::optional<float> loss_scale_;
 
     std::unordered_set<internal::GradRef*> to_scale_back_nodes_;
+
+    // Gradient buffers of array nodes which are created in this backward computation and can be accumulated in-place.
+    std::unordered_map<const ArrayNode*, std::shared_ptr<ArrayBody>> owned_grad_buffers_;
+
+    // Optional observer of the backward computation of each op node.
+    internal::OpNodeBackwardObserver* observer_{nullptr};
 };
 
 }  // namespace
 
+namespace internal {
+
+void BackwardWithObserver(
+        const std::vector<ConstArrayRef>& outputs,
+        const BackpropId& backprop_id,
+        DoubleBackpropOption double_backprop,
+        absl::optional<float> loss_scale,
+        OpNodeBackwardObserver& observer) {
+    if (outputs.empty()) {
+        return;
+    }
+    std::vector<ConstArrayRef> inputs{};
+    BackwardImpl impl{inputs, outputs, backprop_id, double_backprop, loss_scale};
+    impl.set_observer(&observer);
+    impl.Run();
+}
+
+}  // namespace internal
+
 void Backward(
         const Array& output,
         const absl::optional<BackpropId>& backprop_id,
@@ -19,6 +19,7 @@ namespace internal {
 
 class ArrayBody;
 class ArrayNode;
+class OpNode;
 
 // Throws GradientError in case of mismatch in gradient array props.
 void AccumulateGrad(absl::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device);
@@ -26,6 +27,32 @@ void AccumulateGrad(absl::optional<Array>& target_grad, Array partial_grad, cons
 // Throws GradientError in case of mismatch in gradient array props.
 void SetGrad(absl::optional<Array>& target_grad, Array grad, const Shape& shape, Dtype dtype, Device& device);
 
+// Observes the backward computation of each op node, e.g. for profiling.
+class OpNodeBackwardObserver {
+public:
+    OpNodeBackwardObserver() = default;
+    virtual ~OpNodeBackwardObserver() = default;
+
+    OpNodeBackwardObserver(const OpNodeBackwardObserver&) = delete;
+    OpNodeBackwardObserver(OpNodeBackwardObserver&&) = delete;
+    OpNodeBackwardObserver& operator=(const OpNodeBackwardObserver&) = delete;
+    OpNodeBackwardObserver& operator=(OpNodeBackwardObserver&&) = delete;
+
+    // Called before the backward functions of the op node are called.
+    virtual void OnBeginBackward(const OpNode& op_node) = 0;
+
+    // Called after the gradients computed by the backward functions of the op node are accumulated into the input gradients.
+    virtual void OnEndBackward(const OpNode& op_node) = 0;
+};
+
+// Same as Backward(), but notifies the observer of the backward computation of each op node.
+void BackwardWithObserver(
+        const std::vector<ConstArrayRef>& outputs,
+        const BackpropId& backprop_id,
+        DoubleBackpropOption double_backprop,
+        absl::optional<float> loss_scale,
+        OpNodeBackwardObserver& observer);
+
 }  // namespace internal
 
 // Updates the gradients held by the input arrays using backpropagation.
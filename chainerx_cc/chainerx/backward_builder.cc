@@ -15,8 +15,10 @@
 #include "chainerx/array.h"
 #include "chainerx/array_node.h"
 #include "chainerx/backprop_mode.h"
+#include "chainerx/data_version.h"
 #include "chainerx/device.h"
 #include "chainerx/graph.h"
+#include "chainerx/graph_inspection.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
 
@@ -48,7 +50,7 @@ absl::flat_hash_map<BackpropId, BackwardBuilder::Target::InputArrayNodes> Backwa
             // Need to access the input array via the builder.
             const Array& input = gsl::at(builder_.inputs_, input_index);
 
-            for (std::shared_ptr<ArrayNode>& input_array_node : internal::GetArrayBody(input)->nodes()) {
+            for (const std::shared_ptr<ArrayNode>& input_array_node : internal::GetArrayBody(input)->nodes()) {
                 const BackpropId& backprop_id = input_array_node->backprop_id();
                 if (!IsBackpropRequired(backprop_id)) {
                     continue;
@@ -150,7 +152,8 @@ std::shared_ptr<OpNode>& BackwardBuilder::FindOrCreateOpNode(const BackpropId& b
 RetainedInputToken BackwardBuilder::RetainInput(size_t input_index) {
     CHAINERX_ASSERT(input_index < inputs_.size());
     input_retention_record_.Record(input_index);
-    return {internal::GetArrayBody(gsl::at(inputs_, input_index))->GetParams(), input_index};
+    const Array& input = gsl::at(inputs_, input_index);
+    return {internal::GetArrayBody(input)->GetParams(), input_index, internal::GetDataVersion(input)};
 }
 
 std::vector<RetainedInputToken> BackwardBuilder::RetainInput(std::vector<size_t> indices) {
@@ -158,7 +161,8 @@ std::vector<RetainedInputToken> BackwardBuilder::RetainInput(std::vector<size_t>
     for (size_t i : indices) {
         CHAINERX_ASSERT(i < inputs_.size());
         input_retention_record_.Record(i);
-        token.emplace_back(internal::GetArrayBody(gsl::at(inputs_, i))->GetParams(), i);
+        const Array& input = gsl::at(inputs_, i);
+        token.emplace_back(internal::GetArrayBody(input)->GetParams(), i, internal::GetDataVersion(input));
     }
     return token;
 }
@@ -166,7 +170,8 @@ std::vector<RetainedInputToken> BackwardBuilder::RetainInput(std::vector<size_t>
 RetainedOutputToken BackwardBuilder::RetainOutput(size_t output_index) {
     CHAINERX_ASSERT(output_index < outputs_.size());
     output_retention_record_.Record(output_index);
-    return {internal::GetArrayBody(gsl::at(outputs_, output_index))->GetParams(), output_index};
+    const Array& output = gsl::at(outputs_, output_index);
+    return {internal::GetArrayBody(output)->GetParams(), output_index, internal::GetDataVersion(output)};
 }
 
 std::vector<RetainedOutputToken> BackwardBuilder::RetainOutput(std::vector<size_t> indices) {
@@ -174,7 +179,8 @@ std::vector<RetainedOutputToken> BackwardBuilder::RetainOutput(std::vector<size_
     for (size_t i : indices) {
         CHAINERX_ASSERT(i < outputs_.size());
         output_retention_record_.Record(i);
-        token.emplace_back(internal::GetArrayBody(gsl::at(outputs_, i))->GetParams(), i);
+        const Array& output = gsl::at(outputs_, i);
+        token.emplace_back(internal::GetArrayBody(output)->GetParams(), i, internal::GetDataVersion(output));
     }
     return token;
 }
@@ -186,6 +192,8 @@ void BackwardBuilder::Finalize() {
 
     AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention();
 
+    RecordRetainedArrayProps();
+
     // Connect each pair of backprop IDs concerned in this op.
     // If two backprop IDs are connected, backpropping on the one with lower ordinal will prohibit future backprop on the other.
     ConnectBackpropIds();
@@ -280,6 +288,35 @@ void BackwardBuilder::AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention() {
     }
 }
 
+void BackwardBuilder::RecordRetainedArrayProps() {
+    if (!internal::IsRetainedArrayRecordingEnabled()) {
+        return;
+    }
+    if (!input_retention_record_.IsAnyRecorded() && !output_retention_record_.IsAnyRecorded()) {
+        return;
+    }
+
+    std::vector<internal::RetainedArrayProps> retained_array_props;
+    auto add_props = [&retained_array_props](
+                             const backward_builder_detail::RetentionRecord& record, const std::vector<ConstArrayRef>& arrays, bool is_output) {
+        if (!record.IsAnyRecorded()) {
+            return;
+        }
+        for (size_t i = 0; i < record.size(); ++i) {
+            if (record.IsRecorded(i)) {
+                const Array& array = gsl::at(arrays, i);
+                retained_array_props.emplace_back(is_output, i, array.shape(), array.dtype());
+            }
+        }
+    };
+    add_props(input_retention_record_, inputs_, false);
+    add_props(output_retention_record_, outputs_, true);
+
+    for (const auto& tup : op_node_map_) {
+        tup.second->set_retained_array_props(retained_array_props);
+    }
+}
+
 void BackwardBuilder::ConnectBackpropIds() {
     for (auto it1 = op_node_map_.begin(); it1 != op_node_map_.end(); ++it1) {
         const BackpropId& backprop_id1 = it1->first;
@@ -54,7 +54,8 @@ private:
 template <typename Tag>
 class RetainedArrayToken {
 public:
-    RetainedArrayToken(internal::ArrayBody::Params array_params, size_t index) : array_params_{std::move(array_params)}, index_{index} {}
+    RetainedArrayToken(internal::ArrayBody::Params array_params, size_t index, uint64_t data_version)
+        : array_params_{std::move(array_params)}, index_{index}, data_version_{data_version} {}
 
     ~RetainedArrayToken() = default;
 
@@ -72,9 +73,15 @@ private:
 
     const internal::ArrayBody::Params& array_params() const { return array_params_; }
 
+    // Returns the data version of the array at the retention, which is compared to the current one on retrieval to detect in-place
+    // modification of the retained data.
+    uint64_t data_version() const { return data_version_; }
+
     internal::ArrayBody::Params array_params_;
 
     size_t index_;
+
+    uint64_t data_version_;
 };
 
 }  // namespace backward_builder_detail
@@ -203,6 +210,9 @@ private:
     // These references are required to restore retained inputs/outputs.
     void AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention();
 
+    // Records the properties of the retained inputs and outputs in the op nodes for graph inspection.
+    void RecordRetainedArrayProps();
+
     void ConnectBackpropIds();
 
     const char* op_name_;
@@ -13,8 +13,10 @@
 
 #include "chainerx/array.h"
 #include "chainerx/array_body.h"
+#include "chainerx/array_index.h"
 #include "chainerx/array_node.h"
 #include "chainerx/backprop_mode.h"
+#include "chainerx/data_version.h"
 #include "chainerx/device.h"
 #include "chainerx/error.h"
 #include "chainerx/macro.h"
@@ -70,16 +72,19 @@ BackwardContext::BackwardContext(
         absl::Span<std::shared_ptr<ArrayNode>> output_array_nodes,
         absl::Span<internal::GradRef*> output_grads,
         std::vector<Array>& input_grads,
+        std::vector<absl::optional<internal::RegionGrad>>& input_region_grads,
         DoubleBackpropOption double_backprop_option)
     : op_node_{op_node},
       backward_entry_{backward_entry},
       output_array_nodes_{output_array_nodes},
       output_grads_{output_grads},
       input_grads_{input_grads},
+      input_region_grads_{input_region_grads},
       double_backprop_option_{double_backprop_option} {
     CHAINERX_ASSERT(op_node.get() == &backward_entry.op_node());
     CHAINERX_ASSERT(output_array_nodes_.size() == output_grads_.size());
     CHAINERX_ASSERT(input_grads_.size() == op_node->input_array_node_count());
+    CHAINERX_ASSERT(input_region_grads_.size() == input_grads_.size());
 
     // Input grads must be initialized with null-body arrays.
     const std::vector<size_t>& input_grad_indices = backward_entry.input_array_node_indices();
@@ -118,6 +123,13 @@ Array& BackwardContext::input_grad() {
 
 Array& BackwardContext::input_grad(size_t index) { return gsl::at(input_grads_, index); }
 
+void BackwardContext::SetInputRegionGrad(std::vector<ArrayIndex> indices, Array grad) {
+    CHAINERX_ASSERT(!next_required());
+    const std::vector<size_t>& input_grad_indices = backward_entry_.input_array_node_indices();
+    CHAINERX_ASSERT(input_grad_indices.size() == 1);
+    gsl::at(input_region_grads_, input_grad_indices.front()) = internal::RegionGrad{std::move(indices), std::move(grad)};
+}
+
 namespace {
 
 // Returns the pointers to array nodes for all graphs in the input array corresponding to the input_index.
@@ -143,6 +155,7 @@ std::vector<const std::shared_ptr<ArrayNode>*> GetInputArrayNodesForIndex(const
 Array BackwardContext::GetRetainedInput(const RetainedInputToken& token) {
     CHAINERX_ASSERT(token.index() < op_node_->input_array_node_count());
     size_t input_index = token.index();
+    CheckRetainedDataVersion(token.array_params().data, token.data_version(), "Input", input_index);
 
     // Retrieve the kept array body for retained input.
     // Note that it's a non-const reference so that the following logic can assign to it to keep it for the repeated retrieval of the
@@ -190,6 +203,7 @@ Array BackwardContext::GetRetainedInput(const RetainedInputToken& token) {
 Array BackwardContext::GetRetainedOutput(const RetainedOutputToken& token) {
     CHAINERX_ASSERT(token.index() < output_count());
     size_t output_index = token.index();
+    CheckRetainedDataVersion(token.array_params().data, token.data_version(), "Output", output_index);
 
     // Retrieve the kept array body for retained output.
     // Note that it's a non-const reference so that the following logic can assign to it to keep it for the repeated retrieval of the
@@ -229,6 +243,23 @@ Array BackwardContext::GetRetainedOutput(const RetainedOutputToken& token) {
     return Array{kept_body};
 }
 
+void BackwardContext::CheckRetainedDataVersion(
+        const std::shared_ptr<void>& data, uint64_t retained_version, const char* kind, size_t index) const {
+    uint64_t version = internal::GetDataVersion(data);
+    if (version != retained_version) {
+        throw ChainerxError{kind,
+                            " ",
+                            index,
+                            " of ",
+                            op_node_->name(),
+                            " retained for backward has been modified in place (data version ",
+                            retained_version,
+                            " when retained, ",
+                            version,
+                            " now)."};
+    }
+}
+
 std::shared_ptr<ArrayBody> BackwardContext::GetFabricatedArrayBodyWithNodes(const RetainedOutputToken& token) const {
     std::vector<std::shared_ptr<ArrayNode>> new_output_array_nodes;
 
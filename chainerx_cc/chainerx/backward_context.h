@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include <absl/types/span.h>
 
 #include "chainerx/array_fwd.h"
+#include "chainerx/array_index.h"
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_fwd.h"
 #include "chainerx/constant.h"
@@ -60,6 +62,12 @@ private:
     std::unique_ptr<absl::optional<Array>> temporary_grad_;
 };
 
+// A gradient which is zero except for the region of the input array selected by the indices.
+struct RegionGrad {
+    std::vector<ArrayIndex> indices;
+    Array grad;
+};
+
 }  // namespace internal
 
 // A class that holds the context information for a backward operation such as the upstream gradients.
@@ -74,12 +82,14 @@ public:
     // `input_grads` is where input gradients returned by backward functions will be stored.
     // Its size must be equal to the number of input arrays whose gradients are to be returned in this single backward function (1 in most
     // ordinary functions).
+    // `input_region_grads` is where input gradients set by SetInputRegionGrad() will be stored. Its size must be equal to `input_grads`.
     BackwardContext(
             const std::shared_ptr<internal::OpNode>& op_node,
             const internal::OpNodeBackwardEntry& backward_entry,
             absl::Span<std::shared_ptr<internal::ArrayNode>> output_array_nodes,
             absl::Span<internal::GradRef*> output_grads,
             std::vector<Array>& input_grads,
+            std::vector<absl::optional<internal::RegionGrad>>& input_region_grads,
             DoubleBackpropOption double_backprop_option);
 
     size_t input_count() const { return input_grads_.size(); }
@@ -114,6 +124,13 @@ public:
     // Returns the reference to the input gradient.
     Array& input_grad(size_t index);
 
+    // Sets the input gradient to an array which is zero except for the region selected by the indices, where it equals to the given
+    // gradient.
+    // The full-size gradient is not materialized. Instead, the gradient is added directly into the region of the gradient buffer of the
+    // input, so that the gradients of multiple slices of an array share a single buffer which is zero-filled only once.
+    // This function must not be called if the next order of backward is required.
+    void SetInputRegionGrad(std::vector<ArrayIndex> indices, Array grad);
+
     // TODO(hvy): Write comment.
     Array GetRetainedInput(const RetainedInputToken& token);
 
@@ -124,6 +141,10 @@ public:
     Array GetRetainedOutput(const RetainedOutputToken& token);
 
 private:
+    // Throws ChainerxError if the retained data has been modified in place since the retention, in which case the backward computation
+    // would silently use the modified values.
+    void CheckRetainedDataVersion(const std::shared_ptr<void>& data, uint64_t retained_version, const char* kind, size_t index) const;
+
     std::shared_ptr<internal::ArrayBody> GetFabricatedArrayBodyWithNodes(const RetainedOutputToken& token) const;
 
     const std::shared_ptr<internal::OpNode>& op_node_;  // never be nullptr
@@ -141,6 +162,9 @@ private:
     // Unset gradients will have null array body.
     std::vector<Array>& input_grads_;
 
+    // A reference to the storage of input gradients given by SetInputRegionGrad().
+    std::vector<absl::optional<internal::RegionGrad>>& input_region_grads_;
+
     std::vector<std::shared_ptr<internal::ArrayBody>> retained_input_array_bodies_;
 
     // Array bodies for retained outputs.
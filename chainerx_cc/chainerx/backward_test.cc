@@ -28,7 +28,9 @@
 #include "chainerx/op_node.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/explog.h"
+#include "chainerx/routines/reduction.h"
 #include "chainerx/shape.h"
+#include "chainerx/slice.h"
 #include "chainerx/testing/array.h"
 #include "chainerx/testing/array_check.h"
 #include "chainerx/testing/device_session.h"
@@ -334,6 +336,39 @@ TEST_F(BackpropTest, BackwardWithComplicatedRanks) {
     });
 }
 
+TEST_F(BackpropTest, BackwardRetainedArrayModifiedInplace) {
+    // Retained output
+    {
+        Array x = *testing::BuildArray({2}).WithData<float>({1.0f, 2.0f});
+        x.RequireGrad();
+        Array y = Exp(x);
+        Array z = y.AsGradStopped();
+        z += 1;
+        EXPECT_THROW(Backward(y), ChainerxError);
+    }
+
+    // Retained input
+    {
+        Array x1 = *testing::BuildArray({2}).WithData<float>({1.0f, 2.0f});
+        Array x2 = *testing::BuildArray({2}).WithData<float>({3.0f, 4.0f});
+        x2.RequireGrad();
+        Array y = x1 * x2;
+        x1.Fill(0);
+        EXPECT_THROW(Backward(y), ChainerxError);
+    }
+
+    // In-place modification of unretained arrays does not matter.
+    {
+        Array x1 = *testing::BuildArray({2}).WithData<float>({1.0f, 2.0f});
+        Array x2 = *testing::BuildArray({2}).WithData<float>({3.0f, 4.0f});
+        x2.RequireGrad();
+        Array y = x1 + x2;
+        x1.Fill(0);
+        Backward(y);
+        EXPECT_ARRAY_EQ(OnesLike(x2), *x2.GetGrad());
+    }
+}
+
 TEST_F(BackpropTest, BackwardFromArrayWithoutNode) {
     auto xs = MakeFullArrays({1}, {2.0f, 3.0f});
     auto y1 = xs[0] * xs[1];  // without graph
@@ -569,6 +604,27 @@ TEST_F(BackpropTest, BackwardGivenOutputGrad) {
     CheckBackpropSingleElementExtraInputs({2.0f}, {3.0f}, {6.0f}, fprop);
 }
 
+TEST_F(BackpropTest, BackwardOverlappingSlices) {
+    Array x = (*testing::BuildArray({4, 3}).WithLinearData<float>()).RequireGrad();
+    Array y = Sum(x.At({Slice{0, 2}})) + Sum(x.At({Slice{1, 3}})) + Sum(x.At({1})) + Sum(x);
+    Backward(y);
+
+    Array e = testing::BuildArray({4, 3}).WithData<float>({2, 2, 2, 4, 4, 4, 2, 2, 2, 1, 1, 1});
+    EXPECT_ARRAY_EQ(e, *x.GetGrad());
+}
+
+TEST_F(BackpropTest, BackwardSlicesWithGivenInputGrad) {
+    Array x = (*testing::BuildArray({4, 3}).WithLinearData<float>()).RequireGrad();
+    Array given_grad = OnesLike(x);
+    x.SetGrad(given_grad);
+    Array y = Sum(x.At({Slice{0, 2}})) + Sum(x.At({Slice{2, 4}}));
+    Backward(y);
+
+    EXPECT_ARRAY_EQ(FullLike(x, 2.0f), *x.GetGrad());
+    // The given gradient is not modified in-place.
+    EXPECT_ARRAY_EQ(OnesLike(x), given_grad);
+}
+
 TEST_F(BackpropTest, MultipleGraphsBasic) {
     Array x1 = Full({1}, 2.0f);
     Array x2 = Full({1}, 5.0f);
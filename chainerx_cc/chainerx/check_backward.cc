@@ -167,7 +167,8 @@ void CheckBackwardComputation(
         const std::vector<Array>& eps,
         double atol,
         double rtol,
-        const absl::optional<BackpropId>& backprop_id) {
+        const absl::optional<BackpropId>& backprop_id,
+        size_t numerical_gradient_thread_count = 1) {
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(inputs.front(), backprop_id);
 
     // Compute backward gradients
@@ -207,7 +208,8 @@ void CheckBackwardComputation(
     }
 
     // Compute numerical gradients
-    const std::vector<Array> numerical_grads = CalculateNumericalGradient(func, inputs, grad_outputs, eps);
+    const std::vector<Array> numerical_grads =
+            CalculateNumericalGradient(func, inputs, grad_outputs, eps, NumericalGradientOptions{numerical_gradient_thread_count});
 
     // If you're trapped in any of these asserts, numerical gradiends must be implemented incorrectly.
     if (CHAINERX_DEBUG) {
@@ -297,7 +299,10 @@ void CheckBackward(
         internal::ArrayBodyLeakTracker tracker{};
         {
             internal::ArrayBodyLeakDetectionScope scope{tracker};
-            CheckBackwardComputation(func, inputs, grad_outputs, eps, atol, rtol, backprop_id);
+            // The function is expected to be thread safe if the thread safety check is requested, so its numerical gradients can be
+            // computed in parallel.
+            CheckBackwardComputation(
+                    func, inputs, grad_outputs, eps, atol, rtol, backprop_id, std::max(concurrent_check_thread_count, size_t{1}));
         }
         CheckAllArrayBodiesFreed(tracker);
     }
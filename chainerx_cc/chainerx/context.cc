@@ -62,7 +62,7 @@ native::NativeBackend& Context::GetNativeBackend() {
 
 Backend& Context::GetBackend(const std::string& backend_name) {
     {
-        std::lock_guard<std::mutex> lock{mutex_};
+        std::lock_guard<internal::ProfiledMutex> lock{mutex_};
         auto it = backends_.find(backend_name);
         if (it != backends_.end()) {
             return *it->second;
@@ -90,7 +90,7 @@ Backend& Context::GetBackend(const std::string& backend_name) {
             throw BackendError{"Backend not found: '", backend_name, "'"};
         }
         {
-            std::lock_guard<std::mutex> lock{mutex_};
+            std::lock_guard<internal::ProfiledMutex> lock{mutex_};
             dlopen_handles_.push_back(handle);
         }
 
@@ -121,7 +121,7 @@ Device& Context::GetDevice(const DeviceId& device_id) {
 
 BackpropId Context::MakeBackpropId(std::string backprop_name) {
     // Create new backprop ID
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
     backprop_set_.emplace_back(next_backprop_ordinal_, std::move(backprop_name));
     return BackpropId{*this, next_backprop_ordinal_++};
 }
@@ -137,7 +137,7 @@ void Context::ReleaseBackpropId(const BackpropId& backprop_id) {
 }
 
 void Context::ReleaseBackpropIdNoExcept(const BackpropId& backprop_id) noexcept {
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
     BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
     if (item == nullptr) {
         return;
@@ -165,7 +165,7 @@ void Context::CheckValidBackpropId(const BackpropId& backprop_id) const {
         throw ChainerxError{"Invalid context in backprop ID: ", backprop_id};
     }
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
     if (GetBackpropSetItem(backprop_id.ordinal()) == nullptr) {
         throw ChainerxError{"Invalid backprop ID, maybe already expired: ", ToBackpropIdString(backprop_id.ordinal())};
     }
@@ -179,7 +179,7 @@ void Context::ConnectBackpropIds(const BackpropId& backprop_id1, const BackpropI
         return;
     }
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
 
     BackpropSetItem* item1 = GetBackpropSetItem(backprop_id1.ordinal());
     BackpropSetItem* item2 = GetBackpropSetItem(backprop_id2.ordinal());
@@ -201,12 +201,12 @@ void Context::ConnectBackpropIds(const BackpropId& backprop_id1, const BackpropI
 std::string Context::GetBackpropName(const BackpropId& backprop_id) {
     // Note: backprop name cannot be returned by reference, as the reference may be invalidated when a new graph is pushed to the backprop
     // set.
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
     return ToBackpropIdString(backprop_id.ordinal());
 }
 
 void Context::CheckBackpropAllowed(const BackpropId& backprop_id) {
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
     BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
     if (item == nullptr) {
         throw ChainerxError{"Backprop ID not found: ", ToBackpropIdString(backprop_id.ordinal())};
@@ -221,7 +221,7 @@ void Context::CheckBackpropAllowed(const BackpropId& backprop_id) {
 }
 
 void Context::SetBackpropDone(const BackpropId& backprop_id) {
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
 
     CHAINERX_ASSERT(GetBackpropSetItem(backprop_id.ordinal()) != nullptr);
 
@@ -245,7 +245,7 @@ void Context::SetBackpropDone(const BackpropId& backprop_id) {
 std::vector<BackpropId> Context::GetInnerBackpropIds(const BackpropId& backprop_id) {
     std::vector<BackpropId> inner_backprop_ids;
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
     inner_backprop_ids.reserve(backprop_set_.size());
     for (const std::pair<BackpropOrdinal, BackpropOrdinal>& pair : backprop_connections_) {
         if (pair.first == backprop_id.ordinal()) {
@@ -259,7 +259,7 @@ std::pair<Backend&, bool> Context::RegisterBackend(
         const std::string& backend_name, std::unique_ptr<Backend, context_detail::BackendDeleter> backend) {
     // In a multi-threaded case, backends_[backend_name] may already exist at this point.
     // In that case, the backend created in `Context::GetBackend` is thrown away.
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<internal::ProfiledMutex> lock{mutex_};
     auto pair = backends_.emplace(backend_name, std::move(backend));
     // Initialize the backend only if emplaced.
     if (!pair.second) {
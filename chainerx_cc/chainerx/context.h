@@ -13,6 +13,7 @@
 #include "chainerx/device.h"
 #include "chainerx/device_id.h"
 #include "chainerx/graph.h"
+#include "chainerx/lock_profiling.h"
 #include "chainerx/macro.h"
 
 namespace chainerx {
@@ -116,7 +117,7 @@ public:
 
     BackpropId default_backprop_id() {
         // The first entry is always the default backprop ID.
-        std::lock_guard<std::mutex> lock{mutex_};
+        std::lock_guard<internal::ProfiledMutex> lock{mutex_};
         CHAINERX_ASSERT(!backprop_set_.empty());
         return BackpropId{*this, backprop_set_.front().ordinal};
     }
@@ -161,7 +162,7 @@ private:
 
     std::unordered_map<std::string, std::unique_ptr<Backend, context_detail::BackendDeleter>> backends_;
     std::vector<void*> dlopen_handles_;
-    mutable std::mutex mutex_;
+    mutable internal::ProfiledMutex mutex_{LockSite::kContext};
 
     BackpropOrdinal next_backprop_ordinal_{0};
 
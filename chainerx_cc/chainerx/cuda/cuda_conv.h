@@ -36,6 +36,7 @@ public:
             const absl::optional<Array>& b,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             bool cover_all,
             Dtype out_dtype);
     Array ConvTranspose(
@@ -45,6 +46,7 @@ public:
             const absl::optional<Array>& b,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             const Dims& out_size,
             Dtype out_dtype);
     Array ConvGradWeight(
@@ -55,6 +57,7 @@ public:
             const Array& gy,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             bool cover_all);
 
 private:
@@ -71,7 +74,8 @@ private:
             const Array& y,
             size_t max_workspace_size,
             const Dims& pad,
-            const Dims& stride);
+            const Dims& stride,
+            const Dims& dilate);
     std::tuple<cudnnConvolutionBwdDataAlgo_t, size_t, cudnnMathType_t> FindConvolutionBackwardDataAlgorithm(
             CudnnHandle& handle,
             const CudnnFilterDescriptor& filter_desc,
@@ -83,7 +87,8 @@ private:
             const Array& y,
             size_t max_workspace_size,
             const Dims& pad,
-            const Dims& stride);
+            const Dims& stride,
+            const Dims& dilate);
     std::tuple<cudnnConvolutionBwdFilterAlgo_t, size_t, cudnnMathType_t> FindConvolutionBackwardFilterAlgorithm(
             CudnnHandle& handle,
             const CudnnTensorDescriptor& x_desc,
@@ -95,7 +100,8 @@ private:
             const Array& gw,
             size_t max_workspace_size,
             const Dims& pad,
-            const Dims& stride);
+            const Dims& stride,
+            const Dims& dilate);
 
     struct AlgoCacheKey {
         Shape x_shape;
@@ -103,12 +109,14 @@ private:
         Shape y_shape;
         Dims pad;
         Dims stride;
+        Dims dilate;
         Dtype dtype;
         size_t max_workspace_size;
 
         bool operator==(const AlgoCacheKey& other) const {
             return x_shape == other.x_shape && w_shape == other.w_shape && y_shape == other.y_shape && pad == other.pad &&
-                   stride == other.stride && dtype == other.dtype && max_workspace_size == other.max_workspace_size;
+                   stride == other.stride && dilate == other.dilate && dtype == other.dtype &&
+                   max_workspace_size == other.max_workspace_size;
         }
 
         bool operator!=(const AlgoCacheKey& other) const { return !operator==(other); }
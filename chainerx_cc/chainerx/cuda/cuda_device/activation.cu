@@ -0,0 +1,192 @@
+#include "chainerx/cuda/cuda_device.h"
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include <cuda_runtime.h>
+
+#include "chainerx/array.h"
+#include "chainerx/cuda/cuda_set_device_scope.h"
+#include "chainerx/cuda/data_type.cuh"
+#include "chainerx/cuda/elementwise.cuh"
+#include "chainerx/cuda/float16.cuh"
+#include "chainerx/cuda/kernel_regist.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernels/activation.h"
+
+namespace chainerx {
+namespace cuda {
+namespace {
+
+// Type in which the activations are computed. Float16 values are computed in float.
+template <typename CudaType>
+using ComputeType = std::conditional_t<std::is_same<CudaType, cuda::Float16>{}, float, CudaType>;
+
+using activation_detail::kGeluTanhCoeff;
+using activation_detail::kInvSqrt2;
+using activation_detail::kInvSqrt2Pi;
+using activation_detail::kSqrt2OverPi;
+
+template <typename U>
+__device__ U Sigmoid(U x) {
+    return U{1} / (U{1} + std::exp(-x));
+}
+
+template <typename U>
+__device__ U Softplus(U x) {
+    return (x > U{0} ? x : U{0}) + std::log1p(std::exp(-std::fabs(x)));
+}
+
+template <typename U>
+__device__ U Gelu(U x) {
+    return U{0.5} * x * (U{1} + std::erf(x * static_cast<U>(kInvSqrt2)));
+}
+
+template <typename U>
+__device__ U GeluGrad(U x) {
+    return U{0.5} * (U{1} + std::erf(x * static_cast<U>(kInvSqrt2))) + x * std::exp(U{-0.5} * x * x) * static_cast<U>(kInvSqrt2Pi);
+}
+
+template <typename U>
+__device__ U GeluTanh(U x) {
+    U t = std::tanh(static_cast<U>(kSqrt2OverPi) * (x + static_cast<U>(kGeluTanhCoeff) * x * x * x));
+    return U{0.5} * x * (U{1} + t);
+}
+
+template <typename U>
+__device__ U GeluTanhGrad(U x) {
+    U t = std::tanh(static_cast<U>(kSqrt2OverPi) * (x + static_cast<U>(kGeluTanhCoeff) * x * x * x));
+    U dinner = static_cast<U>(kSqrt2OverPi) * (U{1} + static_cast<U>(3 * kGeluTanhCoeff) * x * x);
+    return U{0.5} * (U{1} + t) + U{0.5} * x * (U{1} - t * t) * dinner;
+}
+
+template <typename U>
+__device__ U Silu(U x) {
+    return x * Sigmoid(x);
+}
+
+template <typename U>
+__device__ U SiluGrad(U x) {
+    U s = Sigmoid(x);
+    return s * (U{1} + x * (U{1} - s));
+}
+
+template <typename U>
+__device__ U Mish(U x) {
+    return x * std::tanh(Softplus(x));
+}
+
+template <typename U>
+__device__ U MishGrad(U x) {
+    U t = std::tanh(Softplus(x));
+    return t + x * Sigmoid(x) * (U{1} - t * t);
+}
+
+template <typename U>
+__device__ U HardSwish(U x) {
+    U r = x + U{3};
+    r = r < U{0} ? U{0} : r;
+    r = r > U{6} ? U{6} : r;
+    return x * r / U{6};
+}
+
+template <typename U>
+__device__ U HardSwishGrad(U x) {
+    if (x < U{-3}) {
+        return U{0};
+    }
+    if (x > U{3}) {
+        return U{1};
+    }
+    return (U{2} * x + U{3}) / U{6};
+}
+
+template <typename T>
+struct GeluImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType& out) {
+        out = CudaType{approximate ? GeluTanh(static_cast<U>(x)) : Gelu(static_cast<U>(x))};
+    }
+    bool approximate;
+};
+
+class CudaGeluKernel : public GeluKernel {
+public:
+    void Call(const Array& x, bool approximate, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Elementwise<const T, T>(GeluImpl<T>{approximate}, x_cast, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(GeluKernel, CudaGeluKernel);
+
+template <typename T>
+struct GeluGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType gout, CudaType& out) {
+        U dx = approximate ? GeluTanhGrad(static_cast<U>(x)) : GeluGrad(static_cast<U>(x));
+        out = CudaType{static_cast<U>(gout) * dx};
+    }
+    bool approximate;
+};
+
+class CudaGeluGradKernel : public GeluGradKernel {
+public:
+    void Call(const Array& x, const Array& gout, bool approximate, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, gout, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        const Array& gout_cast = gout.dtype() == out.dtype() ? gout : gout.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Elementwise<const T, const T, T>(GeluGradImpl<T>{approximate}, x_cast, gout_cast, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(GeluGradKernel, CudaGeluGradKernel);
+
+CHAINERX_CUDA_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(SiluKernel, {
+    using U = ComputeType<CudaType>;
+    out = CudaType{Silu(static_cast<U>(x))};
+});
+
+CHAINERX_CUDA_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(SiluGradKernel, {
+    using U = ComputeType<CudaType>;
+    out = CudaType{static_cast<U>(x2) * SiluGrad(static_cast<U>(x1))};
+});
+
+CHAINERX_CUDA_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(MishKernel, {
+    using U = ComputeType<CudaType>;
+    out = CudaType{Mish(static_cast<U>(x))};
+});
+
+CHAINERX_CUDA_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(MishGradKernel, {
+    using U = ComputeType<CudaType>;
+    out = CudaType{static_cast<U>(x2) * MishGrad(static_cast<U>(x1))};
+});
+
+CHAINERX_CUDA_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(HardSwishKernel, {
+    using U = ComputeType<CudaType>;
+    out = CudaType{HardSwish(static_cast<U>(x))};
+});
+
+CHAINERX_CUDA_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(HardSwishGradKernel, {
+    using U = ComputeType<CudaType>;
+    out = CudaType{static_cast<U>(x2) * HardSwishGrad(static_cast<U>(x1))};
+});
+
+}  // namespace
+}  // namespace cuda
+}  // namespace chainerx
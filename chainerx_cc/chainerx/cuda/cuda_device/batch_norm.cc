@@ -15,6 +15,7 @@
 #include "chainerx/cuda/cuda_set_device_scope.h"
 #include "chainerx/cuda/cudnn.h"
 #include "chainerx/cuda/kernel_regist.h"
+#include "chainerx/data_version.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
@@ -50,16 +51,16 @@ void UpdateRunning(const Array& running, const Array& running_updated) {
             (running.dtype() == running_updated.dtype()) ==
             (internal::GetRawOffsetData(running) == internal::GetRawOffsetData(running_updated)));
 
-    if (running.dtype() == running_updated.dtype()) {
-        // Assume that running already holds the updated values.
-        return;
+    // If the dtypes are the same, assume that running already holds the updated values. Otherwise, the running values must be written back.
+    if (running.dtype() != running_updated.dtype()) {
+        const Array& running_casted_back = running_updated.AsType(running.dtype());
+        Device& device = running.device();
+        device.MemoryCopyFrom(
+                internal::GetRawOffsetData(running), internal::GetRawOffsetData(running_casted_back), running.GetNBytes(), device);
     }
 
-    // The running values must be written back.
-    const Array& running_casted_back = running_updated.AsType(running.dtype());
-    Device& device = running.device();
-    device.MemoryCopyFrom(
-            internal::GetRawOffsetData(running), internal::GetRawOffsetData(running_casted_back), running.GetNBytes(), device);
+    // Either way, running has been written in place bypassing the routines.
+    internal::BumpDataVersion(running);
 }
 
 // Appends singleton axes to make an array with at least 4 dimensions.
@@ -1,17 +1,25 @@
 #include "chainerx/cuda/cuda_device.h"
 
 #include <cstdint>
+#include <vector>
 
 #include <cuda_runtime.h>
 
+#include "chainerx/arithmetic_ops.h"
 #include "chainerx/array.h"
 #include "chainerx/cuda/cuda_runtime.h"
 #include "chainerx/cuda/cuda_set_device_scope.h"
 #include "chainerx/cuda/elementwise.cuh"
+#include "chainerx/cuda/float16.cuh"
 #include "chainerx/cuda/kernel_regist.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/kernels/creation.h"
+#include "chainerx/kernels/manipulation.h"
+#include "chainerx/macro.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace cuda {
@@ -41,6 +49,79 @@ public:
 
 CHAINERX_CUDA_REGISTER_KERNEL(CopyKernel, CudaCopyKernel);
 
+// Returns a contiguous view of the range of the 1-dimensional packed array starting at the given element, reshaped to the given shape.
+Array GetPackedRange(const Array& packed, const Shape& shape, int64_t element_offset) {
+    return internal::MakeArray(
+            shape,
+            Strides{shape, packed.dtype()},
+            packed.dtype(),
+            packed.device(),
+            packed.data(),
+            packed.offset() + element_offset * packed.GetItemSize());
+}
+
+class CudaPackKernel : public PackKernel {
+public:
+    void Call(const std::vector<Array>& arrays, const Array& out) override {
+        CHAINERX_ASSERT(out.ndim() == 1);
+        CHAINERX_ASSERT(out.IsContiguous());
+        Device& device = out.device();
+        CudaSetDeviceScope scope{device.index()};
+        int64_t element_offset = 0;
+        for (const Array& a : arrays) {
+            device.CheckDevicesCompatible(a, out);
+            Array range = GetPackedRange(out, a.shape(), element_offset);
+            auto do_pack = [&](auto in_pt, auto out_pt) {
+                using InT = typename decltype(in_pt)::type;
+                using OutT = typename decltype(out_pt)::type;
+                Elementwise<const InT, OutT>(CopyImpl<InT, OutT>{}, a, range);
+            };
+            VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_pack, out_pt); });
+            element_offset += a.GetTotalSize();
+        }
+        CHAINERX_ASSERT(element_offset == out.GetTotalSize());
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(PackKernel, CudaPackKernel);
+
+template <typename InT, typename OutT>
+struct UnpackImpl {
+    using InCudaType = cuda_internal::DataType<InT>;
+    using OutCudaType = cuda_internal::DataType<OutT>;
+    using ComputeCudaType = cuda_internal::DataType<manipulation_detail::UnpackComputeType<InT, OutT>>;
+    __device__ void operator()(int64_t /*i*/, InCudaType a, OutCudaType& out) {
+        out = static_cast<OutCudaType>(ArithmeticOps<ComputeCudaType>::Multiply(static_cast<ComputeCudaType>(a), scale));
+    }
+    ComputeCudaType scale;
+};
+
+class CudaUnpackKernel : public UnpackKernel {
+public:
+    void Call(const Array& a, Scalar scale, const std::vector<Array>& outs) override {
+        CHAINERX_ASSERT(a.ndim() == 1);
+        CHAINERX_ASSERT(a.IsContiguous());
+        Device& device = a.device();
+        CudaSetDeviceScope scope{device.index()};
+        int64_t element_offset = 0;
+        for (const Array& out : outs) {
+            device.CheckDevicesCompatible(a, out);
+            Array range = GetPackedRange(a, out.shape(), element_offset);
+            auto do_unpack = [&](auto in_pt, auto out_pt) {
+                using InT = typename decltype(in_pt)::type;
+                using OutT = typename decltype(out_pt)::type;
+                using ComputeCudaType = typename UnpackImpl<InT, OutT>::ComputeCudaType;
+                Elementwise<const InT, OutT>(UnpackImpl<InT, OutT>{static_cast<ComputeCudaType>(scale)}, range, out);
+            };
+            VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_unpack, out_pt); });
+            element_offset += out.GetTotalSize();
+        }
+        CHAINERX_ASSERT(element_offset == a.GetTotalSize());
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(UnpackKernel, CudaUnpackKernel);
+
 }  // namespace
 }  // namespace cuda
 }  // namespace chainerx
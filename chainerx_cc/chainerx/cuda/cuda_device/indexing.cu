@@ -25,6 +25,8 @@
 #include "chainerx/kernels/indexing.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/indexing.h"
+#include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -442,6 +444,204 @@ public:
 
 CHAINERX_CUDA_REGISTER_KERNEL(WhereASSKernel, CudaWhereASSKernel);
 
+template <typename T>
+struct WhereCompareAAAAImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType b, CudaType x, CudaType y, CudaType& out) {
+        out = ApplyCompareOp(op, a, b) ? x : y;
+    }
+    CompareOp op;
+};
+
+class CudaWhereCompareAAAAKernel : public WhereCompareAAAAKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, const Array& x, const Array& y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, b, x, y, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Elementwise<const T, const T, const T, const T, T>(WhereCompareAAAAImpl<T>{op}, a, b, x, y, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareAAAAKernel, CudaWhereCompareAAAAKernel);
+
+template <typename T>
+struct WhereCompareAAASImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType b, CudaType x, CudaType& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+    CompareOp op;
+    CudaType y;
+};
+
+class CudaWhereCompareAAASKernel : public WhereCompareAAASKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, const Array& x, Scalar y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, b, x, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using CudaType = cuda_internal::DataType<T>;
+            Elementwise<const T, const T, const T, T>(WhereCompareAAASImpl<T>{op, static_cast<CudaType>(y)}, a, b, x, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareAAASKernel, CudaWhereCompareAAASKernel);
+
+template <typename T>
+struct WhereCompareAASAImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType b, CudaType y, CudaType& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+    CompareOp op;
+    CudaType x;
+};
+
+class CudaWhereCompareAASAKernel : public WhereCompareAASAKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, Scalar x, const Array& y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, b, y, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using CudaType = cuda_internal::DataType<T>;
+            Elementwise<const T, const T, const T, T>(WhereCompareAASAImpl<T>{op, static_cast<CudaType>(x)}, a, b, y, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareAASAKernel, CudaWhereCompareAASAKernel);
+
+template <typename T>
+struct WhereCompareAASSImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType b, CudaType& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+    CompareOp op;
+    CudaType x;
+    CudaType y;
+};
+
+class CudaWhereCompareAASSKernel : public WhereCompareAASSKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, Scalar x, Scalar y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, b, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using CudaType = cuda_internal::DataType<T>;
+            Elementwise<const T, const T, T>(WhereCompareAASSImpl<T>{op, static_cast<CudaType>(x), static_cast<CudaType>(y)}, a, b, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareAASSKernel, CudaWhereCompareAASSKernel);
+
+template <typename T>
+struct WhereCompareASAAImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType x, CudaType y, CudaType& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+    CompareOp op;
+    CudaType b;
+};
+
+class CudaWhereCompareASAAKernel : public WhereCompareASAAKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, const Array& x, const Array& y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, x, y, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using CudaType = cuda_internal::DataType<T>;
+            Elementwise<const T, const T, const T, T>(WhereCompareASAAImpl<T>{op, static_cast<CudaType>(b)}, a, x, y, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareASAAKernel, CudaWhereCompareASAAKernel);
+
+template <typename T>
+struct WhereCompareASASImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType x, CudaType& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+    CompareOp op;
+    CudaType b;
+    CudaType y;
+};
+
+class CudaWhereCompareASASKernel : public WhereCompareASASKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, const Array& x, Scalar y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, x, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using CudaType = cuda_internal::DataType<T>;
+            Elementwise<const T, const T, T>(WhereCompareASASImpl<T>{op, static_cast<CudaType>(b), static_cast<CudaType>(y)}, a, x, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareASASKernel, CudaWhereCompareASASKernel);
+
+template <typename T>
+struct WhereCompareASSAImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType y, CudaType& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+    CompareOp op;
+    CudaType b;
+    CudaType x;
+};
+
+class CudaWhereCompareASSAKernel : public WhereCompareASSAKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, Scalar x, const Array& y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, y, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using CudaType = cuda_internal::DataType<T>;
+            Elementwise<const T, const T, T>(WhereCompareASSAImpl<T>{op, static_cast<CudaType>(b), static_cast<CudaType>(x)}, a, y, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareASSAKernel, CudaWhereCompareASSAKernel);
+
+template <typename T>
+struct WhereCompareASSSImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    __device__ void operator()(int64_t /*i*/, CudaType a, CudaType& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+    CompareOp op;
+    CudaType b;
+    CudaType x;
+    CudaType y;
+};
+
+class CudaWhereCompareASSSKernel : public WhereCompareASSSKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, Scalar x, Scalar y, const Array& out) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, out);
+        CudaSetDeviceScope scope{device.index()};
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using CudaType = cuda_internal::DataType<T>;
+            WhereCompareASSSImpl<T> impl{op, static_cast<CudaType>(b), static_cast<CudaType>(x), static_cast<CudaType>(y)};
+            Elementwise<const T, T>(impl, a, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(WhereCompareASSSKernel, CudaWhereCompareASSSKernel);
+
 }  // namespace
 }  // namespace cuda
 }  // namespace chainerx
@@ -5,6 +5,7 @@
 
 #include <cuda_runtime.h>
 
+#include "chainerx/allocation_tracking.h"
 #include "chainerx/cuda/cuda_runtime.h"
 #include "chainerx/cuda/cuda_set_device_scope.h"
 #include "chainerx/cuda/memory_pool.h"
@@ -17,6 +18,9 @@ namespace chainerx {
 namespace cuda {
 
 std::shared_ptr<void> CudaDevice::Allocate(size_t bytesize) {
+    if (bytesize > 0) {
+        internal::RecordAllocation(bytesize);
+    }
     auto deleter = [weak_pool = std::weak_ptr<MemoryPool>{device_memory_pool_}](void* ptr) {
         if (std::shared_ptr<MemoryPool> pool = weak_pool.lock()) {
             pool->FreeNoExcept(ptr);
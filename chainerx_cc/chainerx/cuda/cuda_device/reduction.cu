@@ -18,6 +18,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/kernels/reduction.h"
 #include "chainerx/kernels/sorting.h"
+#include "chainerx/kernels/statistics.h"
 #include "chainerx/macro.h"
 #include "chainerx/numeric_limits.h"
 #include "chainerx/reduction_kernel_arg.h"
@@ -97,6 +98,32 @@ public:
 
 CHAINERX_CUDA_REGISTER_KERNEL(ArgMinKernel, CudaArgMinKernel);
 
+// Computed in two passes. Unlike the native kernel, NaN is not taken as the index.
+class CudaMaxAndArgMaxKernel : public MaxAndArgMaxKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& out_max, const Array& out_argmax) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, out_max, out_argmax);
+        device.backend().CallKernel<AMaxKernel>(a, axis, out_max);
+        device.backend().CallKernel<ArgMaxKernel>(a, axis, out_argmax);
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(MaxAndArgMaxKernel, CudaMaxAndArgMaxKernel);
+
+// Computed in two passes. Unlike the native kernel, NaN is not taken as the index.
+class CudaMinAndArgMinKernel : public MinAndArgMinKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& out_min, const Array& out_argmin) override {
+        Device& device = a.device();
+        device.CheckDevicesCompatible(a, out_min, out_argmin);
+        device.backend().CallKernel<AMinKernel>(a, axis, out_min);
+        device.backend().CallKernel<ArgMinKernel>(a, axis, out_argmin);
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(MinAndArgMinKernel, CudaMinAndArgMinKernel);
+
 }  // namespace
 
 namespace {
@@ -0,0 +1,42 @@
+#include "chainerx/data_version.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+
+namespace chainerx {
+namespace internal {
+
+constexpr size_t DataVersionDeleter::kInlineStorageSize;
+
+std::shared_ptr<void> MakeVersionedData(std::shared_ptr<void> data) {
+    if (data == nullptr || FindDataVersion(data) != nullptr) {
+        return data;
+    }
+    void* ptr = data.get();
+    return std::shared_ptr<void>{ptr, DataVersionDeleter{std::move(data)}};
+}
+
+uint64_t GetDataVersion(const Array& a) {
+    std::atomic<uint64_t>* version = GetArrayBody(a)->data_version();
+    return version == nullptr ? 0 : version->load(std::memory_order_relaxed);
+}
+
+uint64_t GetDataVersion(const std::shared_ptr<void>& data) {
+    std::atomic<uint64_t>* version = FindDataVersion(data);
+    return version == nullptr ? 0 : version->load(std::memory_order_relaxed);
+}
+
+void BumpDataVersion(const Array& a) {
+    if (std::atomic<uint64_t>* version = GetArrayBody(a)->data_version()) {
+        version->fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "chainerx/array_fwd.h"
+
+namespace chainerx {
+namespace internal {
+
+// Deleter of a data buffer which carries the version of the buffer.
+//
+// The version lives in the control block of the shared_ptr of the buffer, so that all views of the buffer, which share the ownership,
+// share the version without any lookup. It can be found by std::get_deleter (see FindDataVersion).
+class DataVersionDeleter {
+public:
+    // Size of the storage for small buffers allocated together with the control block (see inline_storage()).
+    static constexpr size_t kInlineStorageSize = 64;
+
+    // Deletes nothing. Used for buffers in the inline storage.
+    DataVersionDeleter() = default;
+
+    // Deletes the buffer with the function.
+    explicit DataVersionDeleter(void (*free)(void*)) : free_{free} {}
+
+    // Holds the ownership of the buffer until the deletion.
+    explicit DataVersionDeleter(std::shared_ptr<void> owner) : owner_{std::move(owner)} {}
+
+    // shared_ptr requires copyable deleters. They are copied only before the buffer is shared.
+    DataVersionDeleter(const DataVersionDeleter& other)
+        : version_{other.version_.load(std::memory_order_relaxed)}, free_{other.free_}, owner_{other.owner_} {}
+
+    DataVersionDeleter& operator=(const DataVersionDeleter&) = delete;
+
+    ~DataVersionDeleter() = default;
+
+    void operator()(void* ptr) {
+        if (free_ != nullptr) {
+            free_(ptr);
+        }
+        owner_.reset();
+    }
+
+    std::atomic<uint64_t>& version() { return version_; }
+
+    // Returns the storage of kInlineStorageSize bytes, which lives as long as the buffer is owned.
+    void* inline_storage() { return &inline_storage_; }
+
+private:
+    std::atomic<uint64_t> version_{0};
+    void (*free_)(void*){nullptr};
+    std::shared_ptr<void> owner_{};
+    std::aligned_storage_t<kInlineStorageSize, alignof(std::max_align_t)> inline_storage_;
+};
+
+// Returns the version of the data buffer, or nullptr if the buffer does not carry one.
+inline std::atomic<uint64_t>* FindDataVersion(const std::shared_ptr<void>& data) {
+    DataVersionDeleter* deleter = std::get_deleter<DataVersionDeleter>(data);
+    return deleter == nullptr ? nullptr : &deleter->version();
+}
+
+// Returns the data buffer itself if it carries a version, or otherwise a buffer sharing its ownership which carries a version.
+// Null buffers are returned as they are.
+std::shared_ptr<void> MakeVersionedData(std::shared_ptr<void> data);
+
+// Returns the version of the data buffer of the array.
+//
+// The version starts at 0 and is incremented every time the buffer is written in place by a routine (e.g. IAdd, Fill and CopyTo).
+// Views of the same buffer share the version. Kernels and bindings which write existing buffers bypassing the routines, i.e. the cuDNN
+// BatchNorm updating the running statistics and the __setitem__ fallback of the Python binding, bump it themselves. Writes through other
+// aliases of the buffer, such as NumPy arrays sharing it via the buffer protocol, are not tracked.
+uint64_t GetDataVersion(const Array& a);
+
+// Returns the version of the data buffer.
+uint64_t GetDataVersion(const std::shared_ptr<void>& data);
+
+// Increments the version of the data buffer of the array.
+void BumpDataVersion(const Array& a);
+
+}  // namespace internal
+}  // namespace chainerx
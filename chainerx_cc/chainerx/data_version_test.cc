@@ -0,0 +1,79 @@
+#include "chainerx/data_version.h"
+
+#include <cstdint>
+#include <memory>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class DataVersionTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(DataVersionTest, InplaceRoutines) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array b = testing::BuildArray({2, 3}).WithLinearData<float>();
+    EXPECT_EQ(uint64_t{0}, internal::GetDataVersion(a));
+
+    a += b;
+    EXPECT_EQ(uint64_t{1}, internal::GetDataVersion(a));
+    a *= 2;
+    EXPECT_EQ(uint64_t{2}, internal::GetDataVersion(a));
+    a.Fill(1);
+    EXPECT_EQ(uint64_t{3}, internal::GetDataVersion(a));
+    CopyTo(a, b, CastingMode::kNo, Full({}, true, Dtype::kBool));
+    EXPECT_EQ(uint64_t{4}, internal::GetDataVersion(a));
+
+    // Out-of-place routines do not change the versions of the inputs.
+    Array c = a + b;
+    EXPECT_EQ(uint64_t{4}, internal::GetDataVersion(a));
+    EXPECT_EQ(uint64_t{0}, internal::GetDataVersion(b));
+    EXPECT_EQ(uint64_t{0}, internal::GetDataVersion(c));
+}
+
+TEST_F(DataVersionTest, Views) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array view = a.Transpose();
+    Array copy = a.Copy();
+
+    view += 1;
+    EXPECT_EQ(uint64_t{1}, internal::GetDataVersion(a));
+    EXPECT_EQ(uint64_t{1}, internal::GetDataVersion(view));
+    EXPECT_EQ(uint64_t{1}, internal::GetDataVersion(a.At({1})));
+    EXPECT_EQ(uint64_t{0}, internal::GetDataVersion(copy));
+
+    a.At({0}).Fill(0);
+    EXPECT_EQ(uint64_t{2}, internal::GetDataVersion(view));
+}
+
+TEST_F(DataVersionTest, ForeignData) {
+    std::shared_ptr<void> data{new float[6]{}, std::default_delete<float[]>{}};
+    Array a = FromData({2, 3}, Dtype::kFloat32, data);
+    Array view = a.At({1});
+    EXPECT_EQ(data.get(), a.raw_data());
+
+    view.Fill(1);
+    EXPECT_EQ(uint64_t{1}, internal::GetDataVersion(a));
+    EXPECT_EQ(uint64_t{1}, internal::GetDataVersion(view));
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -0,0 +1,343 @@
+#include "chainerx/graph_inspection.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/allocation_tracking.h"
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/array_node.h"
+#include "chainerx/backward.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/graph.h"
+#include "chainerx/macro.h"
+#include "chainerx/op_node.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace {
+
+using internal::ArrayNode;
+using internal::OpNode;
+
+// Builds a graph snapshot, keeping the mapping from op nodes to their indices in the snapshot.
+class GraphSnapshotBuilder {
+public:
+    void Build(const std::shared_ptr<ArrayNode>& root) {
+        if (root == nullptr) {
+            return;
+        }
+
+        // Traverse the graph from the root towards the leaves.
+        std::vector<const OpNode*> candidate_op_nodes;
+        if (const std::shared_ptr<OpNode>& creator = root->creator_op_node()) {
+            candidate_op_nodes.emplace_back(creator.get());
+            op_node_indices_.emplace(creator.get(), 0);
+        }
+        for (size_t i = 0; i < candidate_op_nodes.size(); ++i) {
+            for (const std::shared_ptr<ArrayNode>& input_array_node : candidate_op_nodes[i]->input_array_nodes()) {
+                if (input_array_node == nullptr) {
+                    continue;
+                }
+                if (const std::shared_ptr<OpNode>& creator = input_array_node->creator_op_node()) {
+                    if (op_node_indices_.emplace(creator.get(), 0).second) {
+                        candidate_op_nodes.emplace_back(creator.get());
+                    }
+                }
+            }
+        }
+
+        // Sort the op nodes in the order of backward, breaking ties with the order of discovery.
+        std::stable_sort(candidate_op_nodes.begin(), candidate_op_nodes.end(), [](const OpNode* lhs, const OpNode* rhs) {
+            return lhs->rank() > rhs->rank();
+        });
+        for (size_t i = 0; i < candidate_op_nodes.size(); ++i) {
+            op_node_indices_[candidate_op_nodes[i]] = i;
+        }
+
+        snapshot_.op_nodes.reserve(candidate_op_nodes.size());
+        for (const OpNode* op_node : candidate_op_nodes) {
+            AddOpNode(*op_node);
+        }
+        if (candidate_op_nodes.empty()) {
+            GetArrayNodeIndex(*root);
+        }
+    }
+
+    GraphSnapshot& snapshot() { return snapshot_; }
+
+    // Returns the index of the op node in the snapshot, or nullopt if it is not in the snapshot.
+    absl::optional<size_t> FindOpNode(const OpNode& op_node) const {
+        auto it = op_node_indices_.find(&op_node);
+        if (it == op_node_indices_.end()) {
+            return absl::nullopt;
+        }
+        return it->second;
+    }
+
+private:
+    size_t GetArrayNodeIndex(const ArrayNode& array_node) {
+        auto pair = array_node_indices_.emplace(&array_node, snapshot_.array_nodes.size());
+        if (pair.second) {
+            absl::optional<size_t> creator_index{};
+            if (std::shared_ptr<const OpNode> creator = array_node.creator_op_node()) {
+                creator_index = FindOpNode(*creator);
+            }
+            snapshot_.array_nodes.emplace_back(ArrayNodeInfo{array_node.shape(), array_node.dtype(), creator_index});
+        }
+        return pair.first->second;
+    }
+
+    void AddOpNode(const OpNode& op_node) {
+        OpNodeInfo info{op_node.name(), op_node.rank(), {}, {}, {}, absl::nullopt};
+
+        for (const std::shared_ptr<ArrayNode>& input_array_node : op_node.input_array_nodes()) {
+            info.inputs.emplace_back(input_array_node == nullptr ? absl::nullopt : absl::make_optional(GetArrayNodeIndex(*input_array_node)));
+        }
+        for (const absl::optional<std::weak_ptr<ArrayNode>>& output_array_node : op_node.output_array_nodes()) {
+            std::shared_ptr<ArrayNode> locked = output_array_node.has_value() ? output_array_node->lock() : nullptr;
+            info.outputs.emplace_back(locked == nullptr ? absl::nullopt : absl::make_optional(GetArrayNodeIndex(*locked)));
+        }
+        for (const internal::RetainedArrayProps& props : op_node.retained_array_props()) {
+            info.retained_arrays.emplace_back(RetainedArrayInfo{props.is_output, props.index, props.shape, props.dtype, props.GetNBytes()});
+        }
+
+        snapshot_.op_nodes.emplace_back(std::move(info));
+    }
+
+    GraphSnapshot snapshot_{};
+    std::unordered_map<const OpNode*, size_t> op_node_indices_;
+    std::unordered_map<const ArrayNode*, size_t> array_node_indices_;
+};
+
+// Records the backward profile of each op node into the snapshot.
+class ProfilingObserver : public internal::OpNodeBackwardObserver {
+public:
+    ProfilingObserver(GraphSnapshotBuilder& builder, internal::AllocationTracker& tracker) : builder_{builder}, tracker_{tracker} {}
+
+    void OnBeginBackward(const OpNode& op_node) override {
+        SynchronizeOutputDevice(op_node);
+        start_allocation_count_ = tracker_.count();
+        start_allocation_bytesize_ = tracker_.bytesize();
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    void OnEndBackward(const OpNode& op_node) override {
+        SynchronizeOutputDevice(op_node);
+        auto end = std::chrono::steady_clock::now();
+
+        absl::optional<size_t> index = builder_.FindOpNode(op_node);
+        if (!index.has_value()) {
+            return;
+        }
+        OpNodeBackwardProfile profile{};
+        profile.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_).count();
+        profile.allocation_count = tracker_.count() - start_allocation_count_;
+        profile.allocation_bytesize = tracker_.bytesize() - start_allocation_bytesize_;
+        builder_.snapshot().op_nodes[*index].backward_profile = profile;
+    }
+
+private:
+    static void SynchronizeOutputDevice(const OpNode& op_node) {
+        if (op_node.output_array_node_count() > 0) {
+            op_node.GetOutputArrayProps(0).device.Synchronize();
+        }
+    }
+
+    GraphSnapshotBuilder& builder_;
+    internal::AllocationTracker& tracker_;
+    std::chrono::steady_clock::time_point start_{};
+    int64_t start_allocation_count_{0};
+    int64_t start_allocation_bytesize_{0};
+};
+
+// Writes a string literal with JSON escapes.
+void DumpJsonString(std::ostream& os, const std::string& s) {
+    os << '"';
+    for (char c : s) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            default:
+                os << c;
+        }
+    }
+    os << '"';
+}
+
+void DumpJsonShape(std::ostream& os, const Shape& shape) {
+    os << '[';
+    for (size_t i = 0; i < shape.size(); ++i) {
+        os << (i == 0 ? "" : ", ") << shape[i];
+    }
+    os << ']';
+}
+
+void DumpJsonIndices(std::ostream& os, const std::vector<absl::optional<size_t>>& indices) {
+    os << '[';
+    for (size_t i = 0; i < indices.size(); ++i) {
+        os << (i == 0 ? "" : ", ");
+        if (indices[i].has_value()) {
+            os << *indices[i];
+        } else {
+            os << "null";
+        }
+    }
+    os << ']';
+}
+
+bool& RetainedArrayRecordingEnabled() {
+    thread_local bool t_enabled{false};
+    return t_enabled;
+}
+
+}  // namespace
+
+RetainedArrayRecordingScope::RetainedArrayRecordingScope() : prev_enabled_{RetainedArrayRecordingEnabled()} {
+    RetainedArrayRecordingEnabled() = true;
+}
+
+RetainedArrayRecordingScope::~RetainedArrayRecordingScope() { RetainedArrayRecordingEnabled() = prev_enabled_; }
+
+namespace internal {
+
+bool IsRetainedArrayRecordingEnabled() { return RetainedArrayRecordingEnabled(); }
+
+}  // namespace internal
+
+int64_t GraphSnapshot::GetRetainedNBytes() const {
+    int64_t nbytes{0};
+    for (const OpNodeInfo& op_node : op_nodes) {
+        for (const RetainedArrayInfo& retained : op_node.retained_arrays) {
+            nbytes += retained.nbytes;
+        }
+    }
+    return nbytes;
+}
+
+void GraphSnapshot::DumpDot(std::ostream& os) const {
+    os << "digraph graph_snapshot {\n";
+    for (size_t i = 0; i < array_nodes.size(); ++i) {
+        const ArrayNodeInfo& array_node = array_nodes[i];
+        os << "  a" << i << " [shape=ellipse, label=\"" << array_node.shape << " " << GetDtypeName(array_node.dtype) << "\"];\n";
+    }
+    for (size_t i = 0; i < op_nodes.size(); ++i) {
+        const OpNodeInfo& op_node = op_nodes[i];
+        os << "  o" << i << " [shape=box, label=\"" << op_node.name << "\\nrank=" << op_node.rank;
+        if (!op_node.retained_arrays.empty()) {
+            int64_t retained_nbytes{0};
+            for (const RetainedArrayInfo& retained : op_node.retained_arrays) {
+                retained_nbytes += retained.nbytes;
+            }
+            os << "\\nretained=" << retained_nbytes << "B";
+        }
+        if (op_node.backward_profile.has_value()) {
+            os << "\\nbackward=" << static_cast<double>(op_node.backward_profile->duration_ns) * 1e-3 << "us"
+               << "\\nallocated=" << op_node.backward_profile->allocation_bytesize << "B";
+        }
+        os << "\"];\n";
+        for (const absl::optional<size_t>& input : op_node.inputs) {
+            if (input.has_value()) {
+                os << "  a" << *input << " -> o" << i << ";\n";
+            }
+        }
+        for (const absl::optional<size_t>& output : op_node.outputs) {
+            if (output.has_value()) {
+                os << "  o" << i << " -> a" << *output << ";\n";
+            }
+        }
+    }
+    os << "}\n";
+}
+
+void GraphSnapshot::DumpJson(std::ostream& os) const {
+    os << "{\"array_nodes\": [";
+    for (size_t i = 0; i < array_nodes.size(); ++i) {
+        const ArrayNodeInfo& array_node = array_nodes[i];
+        os << (i == 0 ? "" : ", ") << "{\"shape\": ";
+        DumpJsonShape(os, array_node.shape);
+        os << ", \"dtype\": \"" << GetDtypeName(array_node.dtype) << "\", \"creator\": ";
+        if (array_node.creator_op_node.has_value()) {
+            os << *array_node.creator_op_node;
+        } else {
+            os << "null";
+        }
+        os << '}';
+    }
+    os << "], \"op_nodes\": [";
+    for (size_t i = 0; i < op_nodes.size(); ++i) {
+        const OpNodeInfo& op_node = op_nodes[i];
+        os << (i == 0 ? "" : ", ") << "{\"name\": ";
+        DumpJsonString(os, op_node.name);
+        os << ", \"rank\": " << op_node.rank << ", \"inputs\": ";
+        DumpJsonIndices(os, op_node.inputs);
+        os << ", \"outputs\": ";
+        DumpJsonIndices(os, op_node.outputs);
+        os << ", \"retained_arrays\": [";
+        for (size_t j = 0; j < op_node.retained_arrays.size(); ++j) {
+            const RetainedArrayInfo& retained = op_node.retained_arrays[j];
+            os << (j == 0 ? "" : ", ") << "{\"kind\": \"" << (retained.is_output ? "output" : "input") << "\", \"index\": " << retained.index
+               << ", \"shape\": ";
+            DumpJsonShape(os, retained.shape);
+            os << ", \"dtype\": \"" << GetDtypeName(retained.dtype) << "\", \"nbytes\": " << retained.nbytes << '}';
+        }
+        os << "], \"backward_profile\": ";
+        if (op_node.backward_profile.has_value()) {
+            const OpNodeBackwardProfile& profile = *op_node.backward_profile;
+            os << "{\"duration_ns\": " << profile.duration_ns << ", \"allocation_count\": " << profile.allocation_count
+               << ", \"allocation_bytesize\": " << profile.allocation_bytesize << '}';
+        } else {
+            os << "null";
+        }
+        os << '}';
+    }
+    os << "]}";
+}
+
+GraphSnapshot SnapshotGraph(const Array& array, const absl::optional<BackpropId>& backprop_id) {
+    BackpropId actual_backprop_id = internal::GetArrayBackpropId(array, backprop_id);
+    GraphSnapshotBuilder builder{};
+    builder.Build(internal::GetArrayBody(array)->GetArrayNode(actual_backprop_id));
+    return std::move(builder.snapshot());
+}
+
+GraphSnapshot ProfileBackward(const Array& output, const absl::optional<BackpropId>& backprop_id, DoubleBackpropOption double_backprop) {
+    BackpropId actual_backprop_id = internal::GetArrayBackpropId(output, backprop_id);
+    GraphSnapshotBuilder builder{};
+    builder.Build(internal::GetArrayBody(output)->GetArrayNode(actual_backprop_id));
+
+    // Reuse the active allocation tracker if any, since allocation tracking scopes cannot be nested.
+    absl::optional<internal::AllocationTracker> own_tracker{};
+    absl::optional<internal::AllocationTrackingScope> scope{};
+    internal::AllocationTracker* tracker = internal::AllocationTrackingScope::GetGlobalTracker();
+    if (tracker == nullptr) {
+        own_tracker.emplace();
+        tracker = &*own_tracker;
+        scope.emplace(*tracker);
+    }
+
+    ProfilingObserver observer{builder, *tracker};
+    std::vector<ConstArrayRef> outputs{output};
+    internal::BackwardWithObserver(outputs, actual_backprop_id, double_backprop, absl::nullopt, observer);
+    return std::move(builder.snapshot());
+}
+
+}  // namespace chainerx
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/backward_fwd.h"
+#include "chainerx/dtype.h"
+#include "chainerx/graph.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+// Timing and allocations of the backward computation of an op node, recorded by ProfileBackward().
+struct OpNodeBackwardProfile {
+    // Wall time spent in the backward functions of the op node and in the accumulation of their gradients, in nanoseconds.
+    int64_t duration_ns{0};
+
+    // Number and total size of device memory allocations during the same period.
+    int64_t allocation_count{0};
+    int64_t allocation_bytesize{0};
+};
+
+// An array node in a graph snapshot.
+struct ArrayNodeInfo {
+    Shape shape;
+    Dtype dtype;
+
+    // Index of the op node which created the array node in GraphSnapshot::op_nodes, or nullopt if the array node is a leaf.
+    absl::optional<size_t> creator_op_node;
+};
+
+// An input or output array retained by an op node for its backward computation.
+struct RetainedArrayInfo {
+    bool is_output;
+
+    // Index of the retained array among the inputs or the outputs of the op node.
+    size_t index;
+
+    Shape shape;
+    Dtype dtype;
+    int64_t nbytes;
+};
+
+// An op node in a graph snapshot.
+struct OpNodeInfo {
+    std::string name;
+    int64_t rank;
+
+    // Indices of the input and output array nodes in GraphSnapshot::array_nodes.
+    // An element is nullopt if the corresponding input does not require grad or if the output array node is already gone.
+    std::vector<absl::optional<size_t>> inputs;
+    std::vector<absl::optional<size_t>> outputs;
+
+    // Empty unless the op node was created in a RetainedArrayRecordingScope.
+    std::vector<RetainedArrayInfo> retained_arrays;
+
+    // Set only in the snapshots returned by ProfileBackward().
+    absl::optional<OpNodeBackwardProfile> backward_profile;
+};
+
+// A snapshot of the computational graph reachable from an array.
+// Op nodes are sorted in descending order of rank, i.e. the order in which backward visits them.
+struct GraphSnapshot {
+    std::vector<ArrayNodeInfo> array_nodes;
+    std::vector<OpNodeInfo> op_nodes;
+
+    // Returns the total size of the arrays retained by the op nodes in bytes.
+    int64_t GetRetainedNBytes() const;
+
+    // Writes the graph in the Graphviz DOT format.
+    void DumpDot(std::ostream& os) const;
+
+    // Writes the graph as a JSON object with "array_nodes" and "op_nodes" members.
+    void DumpJson(std::ostream& os) const;
+};
+
+// Makes op nodes created in the scope record their retained arrays, which are reported in OpNodeInfo::retained_arrays.
+// Outside of the scope, op nodes do not record them so that the forward computation does not pay for the recording.
+class RetainedArrayRecordingScope {
+public:
+    RetainedArrayRecordingScope();
+
+    RetainedArrayRecordingScope(const RetainedArrayRecordingScope&) = delete;
+    RetainedArrayRecordingScope(RetainedArrayRecordingScope&&) = delete;
+    RetainedArrayRecordingScope& operator=(const RetainedArrayRecordingScope&) = delete;
+    RetainedArrayRecordingScope& operator=(RetainedArrayRecordingScope&&) = delete;
+
+    ~RetainedArrayRecordingScope();
+
+private:
+    bool prev_enabled_;
+};
+
+namespace internal {
+
+// Returns whether the current thread is in a RetainedArrayRecordingScope.
+bool IsRetainedArrayRecordingEnabled();
+
+}  // namespace internal
+
+// Takes a snapshot of the graph reachable from the array.
+GraphSnapshot SnapshotGraph(const Array& array, const absl::optional<BackpropId>& backprop_id = absl::nullopt);
+
+// Runs backward from the output in the same way as Backward() and returns the snapshot of the graph taken before backward, where each
+// op node visited by backward has its backward profile.
+// Device synchronization is performed around each op node for accurate timing, so this function is much slower than Backward().
+GraphSnapshot ProfileBackward(
+        const Array& output,
+        const absl::optional<BackpropId>& backprop_id = absl::nullopt,
+        DoubleBackpropOption double_backprop = DoubleBackpropOption::kDisable);
+
+}  // namespace chainerx
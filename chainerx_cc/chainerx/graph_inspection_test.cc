@@ -0,0 +1,143 @@
+#include "chainerx/graph_inspection.h"
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/arithmetic.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class GraphInspectionTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(GraphInspectionTest, SnapshotGraph) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<float>()).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+    Array y = [&a, &b]() {
+        RetainedArrayRecordingScope scope{};
+        return Sum(a * b);
+    }();
+
+    GraphSnapshot snapshot = SnapshotGraph(y);
+
+    ASSERT_EQ(size_t{2}, snapshot.op_nodes.size());
+    const OpNodeInfo& sum = snapshot.op_nodes[0];
+    const OpNodeInfo& mul = snapshot.op_nodes[1];
+    EXPECT_EQ("sum", sum.name);
+    EXPECT_EQ("multiply", mul.name);
+    EXPECT_GT(sum.rank, mul.rank);
+    EXPECT_FALSE(sum.backward_profile.has_value());
+
+    // Sum retains nothing while multiply retains both inputs.
+    EXPECT_TRUE(sum.retained_arrays.empty());
+    ASSERT_EQ(size_t{2}, mul.retained_arrays.size());
+    for (size_t i = 0; i < 2; ++i) {
+        const RetainedArrayInfo& retained = mul.retained_arrays[i];
+        EXPECT_FALSE(retained.is_output);
+        EXPECT_EQ(i, retained.index);
+        EXPECT_EQ(Shape({2, 3}), retained.shape);
+        EXPECT_EQ(Dtype::kFloat32, retained.dtype);
+        EXPECT_EQ(24, retained.nbytes);
+    }
+    EXPECT_EQ(48, snapshot.GetRetainedNBytes());
+
+    // The input of sum is the output of multiply.
+    ASSERT_EQ(size_t{1}, sum.inputs.size());
+    ASSERT_TRUE(sum.inputs[0].has_value());
+    const ArrayNodeInfo& mul_out = snapshot.array_nodes[*sum.inputs[0]];
+    EXPECT_EQ(Shape({2, 3}), mul_out.shape);
+    ASSERT_TRUE(mul_out.creator_op_node.has_value());
+    EXPECT_EQ(size_t{1}, *mul_out.creator_op_node);
+
+    // The inputs of multiply are leaves.
+    ASSERT_EQ(size_t{2}, mul.inputs.size());
+    for (const absl::optional<size_t>& input : mul.inputs) {
+        ASSERT_TRUE(input.has_value());
+        EXPECT_FALSE(snapshot.array_nodes[*input].creator_op_node.has_value());
+    }
+}
+
+TEST_F(GraphInspectionTest, SnapshotGraphWithoutRetainedArrayRecording) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<float>()).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+    Array y = a * b;
+
+    GraphSnapshot snapshot = SnapshotGraph(y);
+
+    ASSERT_EQ(size_t{1}, snapshot.op_nodes.size());
+    EXPECT_TRUE(snapshot.op_nodes[0].retained_arrays.empty());
+    EXPECT_EQ(0, snapshot.GetRetainedNBytes());
+}
+
+TEST_F(GraphInspectionTest, SnapshotGraphWithoutGraph) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    GraphSnapshot snapshot = SnapshotGraph(a);
+    EXPECT_TRUE(snapshot.op_nodes.empty());
+    EXPECT_TRUE(snapshot.array_nodes.empty());
+    EXPECT_EQ(0, snapshot.GetRetainedNBytes());
+}
+
+TEST_F(GraphInspectionTest, ProfileBackward) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<float>()).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+    Array y = Sum(a * b);
+
+    GraphSnapshot snapshot = ProfileBackward(y);
+
+    ASSERT_EQ(size_t{2}, snapshot.op_nodes.size());
+    for (const OpNodeInfo& op_node : snapshot.op_nodes) {
+        ASSERT_TRUE(op_node.backward_profile.has_value()) << op_node.name;
+        EXPECT_GE(op_node.backward_profile->duration_ns, 0);
+    }
+
+    // The gradient of sum is a broadcast view, while multiply allocates its input gradients.
+    EXPECT_EQ(0, snapshot.op_nodes[0].backward_profile->allocation_count);
+    EXPECT_GT(snapshot.op_nodes[1].backward_profile->allocation_count, 0);
+    EXPECT_GT(snapshot.op_nodes[1].backward_profile->allocation_bytesize, 0);
+
+    // Gradients are computed as in Backward().
+    EXPECT_TRUE(a.GetGrad().has_value());
+    EXPECT_TRUE(b.GetGrad().has_value());
+}
+
+TEST_F(GraphInspectionTest, Dump) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<float>()).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+    GraphSnapshot snapshot = SnapshotGraph(Sum(a * b));
+
+    std::ostringstream dot;
+    snapshot.DumpDot(dot);
+    EXPECT_EQ(0U, dot.str().find("digraph"));
+    EXPECT_NE(std::string::npos, dot.str().find("sum"));
+    EXPECT_NE(std::string::npos, dot.str().find("multiply"));
+
+    std::ostringstream json;
+    snapshot.DumpJson(json);
+    EXPECT_EQ('{', json.str().front());
+    EXPECT_NE(std::string::npos, json.str().find("\"array_nodes\""));
+    EXPECT_NE(std::string::npos, json.str().find("\"op_nodes\""));
+    EXPECT_NE(std::string::npos, json.str().find("\"multiply\""));
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -20,7 +20,11 @@ public:
     }
 
     CHAINERX_HOST_DEVICE IndexIterator<kNdim>& operator++() {
+#ifdef __CUDA_ARCH__
         Set(raw_index_ + step_);
+#else
+        Advance();
+#endif
         return *this;
     }
 
@@ -88,6 +92,24 @@ private:
 #endif
     }
 
+    // Advances raw_index_ by step_ and updates index_ by propagating carries from the last dimension, which is equivalent to
+    // Set(raw_index_ + step_) but avoids the division per dimension in the common case where step_ is smaller than the extent of the
+    // last dimension.
+    CHAINERX_HOST_DEVICE void Advance() {
+        CHAINERX_ASSERT(total_size_ > 0);
+        raw_index_ += step_;
+        int64_t carry = step_;
+        for (int8_t j = kNdim; --j >= 0;) {
+            int64_t i = index_[j] + carry;  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            if (i < shape_[j]) {
+                index_[j] = i;  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                return;
+            }
+            carry = i / shape_[j];
+            index_[j] = i - carry * shape_[j];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+    }
+
     const int64_t* shape_;
     int64_t total_size_{};
     int64_t raw_index_{};
@@ -224,7 +246,11 @@ public:
     }
 
     CHAINERX_HOST_DEVICE IndexIterator<kDynamicNdim>& operator++() {
+#ifdef __CUDA_ARCH__
         Set(raw_index_ + step_);
+#else
+        Advance();
+#endif
         return *this;
     }
 
@@ -294,6 +320,24 @@ private:
 #endif
     }
 
+    // Advances raw_index_ by step_ and updates index_ by propagating carries from the last dimension, which is equivalent to
+    // Set(raw_index_ + step_) but avoids the division per dimension in the common case where step_ is smaller than the extent of the
+    // last dimension.
+    CHAINERX_HOST_DEVICE void Advance() {
+        CHAINERX_ASSERT(total_size_ > 0);
+        raw_index_ += step_;
+        int64_t carry = step_;
+        for (int8_t j = ndim_; --j >= 0;) {
+            int64_t i = index_[j] + carry;  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            if (i < shape_[j]) {
+                index_[j] = i;  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                return;
+            }
+            carry = i / shape_[j];
+            index_[j] = i - carry * shape_[j];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+    }
+
     const int64_t* shape_;
     int8_t ndim_{};
     int64_t total_size_{};
@@ -129,6 +129,24 @@ TEST(IndexIteratorTest, Rank3) {
     EXPECT_TRUE(static_cast<bool>(it));
 }
 
+TEST(IndexIteratorTest, Rank3Step) {
+    // Steps larger than the last dimensions carry over multiple dimensions at once.
+    const std::array<int64_t, 3> shape = {2, 3, 4};
+    for (int64_t step : {1, 3, 5, 7, 13, 30}) {
+        for (int64_t start = 0; start < step; ++start) {
+            IndexIterator<3> it(&shape[0], 24, start, step);
+            int64_t i = start;
+            for (; it; ++it, i += step) {
+                EXPECT_EQ(i, it.raw_index());
+                EXPECT_EQ((i / 12) % 2, it.index()[0]);
+                EXPECT_EQ((i / 4) % 3, it.index()[1]);
+                EXPECT_EQ(i % 4, it.index()[2]);
+            }
+            EXPECT_EQ(i, it.raw_index());
+        }
+    }
+}
+
 TEST(DynamicIndexIteratorTest, Rank0) {
     IndexIterator<> it(nullptr, 0, 1, 0, 1);
     EXPECT_EQ(0, it.ndim());
@@ -254,5 +272,23 @@ TEST(DynamicIndexIteratorTest, Rank3) {
     EXPECT_TRUE(static_cast<bool>(it));
 }
 
+TEST(DynamicIndexIteratorTest, Rank3Step) {
+    // Steps larger than the last dimensions carry over multiple dimensions at once.
+    const std::array<int64_t, 3> shape = {2, 3, 4};
+    for (int64_t step : {1, 3, 5, 7, 13, 30}) {
+        for (int64_t start = 0; start < step; ++start) {
+            IndexIterator<> it(&shape[0], 3, 24, start, step);
+            int64_t i = start;
+            for (; it; ++it, i += step) {
+                EXPECT_EQ(i, it.raw_index());
+                EXPECT_EQ((i / 12) % 2, it.index()[0]);
+                EXPECT_EQ((i / 4) % 3, it.index()[1]);
+                EXPECT_EQ(i % 4, it.index()[2]);
+            }
+            EXPECT_EQ(i, it.raw_index());
+        }
+    }
+}
+
 }  // namespace
 }  // namespace chainerx
@@ -0,0 +1,280 @@
+#include "chainerx/kernel_call_recording.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/constant.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/hash_combine.h"
+#include "chainerx/macro.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+
+namespace chainerx {
+
+bool operator==(const KernelCallArraySignature& lhs, const KernelCallArraySignature& rhs) {
+    return lhs.dtype == rhs.dtype && lhs.shape == rhs.shape && lhs.strides == rhs.strides && lhs.is_contiguous == rhs.is_contiguous;
+}
+
+bool operator==(const KernelCallSignature& lhs, const KernelCallSignature& rhs) {
+    return lhs.kernel_name == rhs.kernel_name && lhs.arrays == rhs.arrays;
+}
+
+size_t KernelCallSignatureHash::operator()(const KernelCallSignature& signature) const {
+    size_t seed = std::hash<std::string>{}(signature.kernel_name);
+    for (const KernelCallArraySignature& array : signature.arrays) {
+        internal::HashCombine(seed, std::hash<int>{}(static_cast<int>(array.dtype)));
+        for (int64_t dim : array.shape) {
+            internal::HashCombine(seed, std::hash<int64_t>{}(dim));
+        }
+        for (int64_t stride : array.strides) {
+            internal::HashCombine(seed, std::hash<int64_t>{}(stride));
+        }
+    }
+    return seed;
+}
+
+void KernelCallProfile::Add(const KernelCallSignature& signature, int64_t count) { counts_[signature] += count; }
+
+std::vector<std::pair<KernelCallSignature, int64_t>> KernelCallProfile::GetHottest(size_t n) const {
+    std::vector<std::pair<KernelCallSignature, int64_t>> hottest{counts_.begin(), counts_.end()};
+    auto by_count = [](const std::pair<KernelCallSignature, int64_t>& lhs, const std::pair<KernelCallSignature, int64_t>& rhs) {
+        return lhs.second > rhs.second;
+    };
+    if (n < hottest.size()) {
+        std::partial_sort(hottest.begin(), hottest.begin() + n, hottest.end(), by_count);
+        hottest.resize(n);
+    } else {
+        std::sort(hottest.begin(), hottest.end(), by_count);
+    }
+    return hottest;
+}
+
+int64_t KernelCallProfile::GetTotalCount() const {
+    int64_t total{0};
+    for (const auto& pair : counts_) {
+        total += pair.second;
+    }
+    return total;
+}
+
+namespace {
+
+// Returns the ndim of the shape after squashing dimensions which are contiguous in all strides, in the same manner as SquashShape.
+int8_t GetSquashedNdim(const Shape& shape, const std::vector<const Strides*>& strides) {
+    int8_t ndim = shape.ndim();
+    if (ndim <= 1) {
+        return ndim;
+    }
+    Shape compressed = shape;
+    int8_t squashed_ndim{0};
+    for (int8_t i = 1; i < ndim; ++i) {
+        if (compressed[i - 1] == 1) {
+            // Do nothing.
+        } else if (std::all_of(strides.begin(), strides.end(), [&compressed, i](const Strides* s) {
+                       return (*s)[i] * compressed[i] == (*s)[i - 1];
+                   })) {
+            compressed[i] *= compressed[i - 1];
+            compressed[i - 1] = 1;
+        } else {
+            ++squashed_ndim;
+        }
+    }
+    if (compressed.back() != 1) {
+        ++squashed_ndim;
+    }
+    return squashed_ndim;
+}
+
+}  // namespace
+
+std::vector<int64_t> KernelCallProfile::GetSquashedNdimCounts() const {
+    std::vector<int64_t> ndim_counts(kMaxNdim + 1);
+    for (const auto& pair : counts_) {
+        const std::vector<KernelCallArraySignature>& arrays = pair.first.arrays;
+        if (arrays.empty()) {
+            continue;
+        }
+        const Shape& shape = std::max_element(arrays.begin(), arrays.end(), [](const auto& lhs, const auto& rhs) {
+                                 return lhs.shape.ndim() < rhs.shape.ndim();
+                             })->shape;
+        std::vector<const Strides*> strides{};
+        for (const KernelCallArraySignature& array : arrays) {
+            if (array.shape == shape) {
+                strides.emplace_back(&array.strides);
+            }
+        }
+        ndim_counts[GetSquashedNdim(shape, strides)] += pair.second;
+    }
+    return ndim_counts;
+}
+
+// Each line holds a signature and its count:
+//
+//     <count> <kernel name> <number of arrays> (<dtype> <ndim> <dims...> <strides...> <contiguity>)...
+void KernelCallProfile::Save(std::ostream& os) const {
+    for (const std::pair<KernelCallSignature, int64_t>& pair : GetHottest(counts_.size())) {
+        const KernelCallSignature& signature = pair.first;
+        os << pair.second << ' ' << signature.kernel_name << ' ' << signature.arrays.size();
+        for (const KernelCallArraySignature& array : signature.arrays) {
+            os << ' ' << GetDtypeName(array.dtype) << ' ' << static_cast<int>(array.shape.ndim());
+            for (int64_t dim : array.shape) {
+                os << ' ' << dim;
+            }
+            for (int64_t stride : array.strides) {
+                os << ' ' << stride;
+            }
+            os << ' ' << (array.is_contiguous ? 1 : 0);
+        }
+        os << '\n';
+    }
+}
+
+KernelCallProfile KernelCallProfile::Load(std::istream& is) {
+    KernelCallProfile profile{};
+
+    int64_t count{};
+    while (is >> count) {
+        KernelCallSignature signature{};
+        size_t n_arrays{};
+        if (!(is >> signature.kernel_name >> n_arrays)) {
+            throw ChainerxError{"Malformed kernel call profile."};
+        }
+        for (size_t i = 0; i < n_arrays; ++i) {
+            std::string dtype_name{};
+            int ndim{};
+            if (!(is >> dtype_name >> ndim) || ndim < 0 || ndim > kMaxNdim) {
+                throw ChainerxError{"Malformed kernel call profile."};
+            }
+
+            KernelCallArraySignature array{GetDtype(dtype_name), {}, {}, false};
+            std::vector<int64_t> dims(2 * ndim);
+            for (int64_t& dim : dims) {
+                is >> dim;
+            }
+            int contiguity{};
+            if (!(is >> contiguity)) {
+                throw ChainerxError{"Malformed kernel call profile."};
+            }
+            array.shape = Shape{dims.begin(), dims.begin() + ndim};
+            array.strides = Strides{dims.begin() + ndim, dims.end()};
+            array.is_contiguous = contiguity != 0;
+            signature.arrays.emplace_back(std::move(array));
+        }
+        profile.Add(signature, count);
+    }
+    if (!is.eof()) {
+        throw ChainerxError{"Malformed kernel call profile."};
+    }
+    return profile;
+}
+
+namespace {
+
+uint64_t GetNextRecorderId() {
+    static std::atomic<uint64_t> next_id{1};
+    return next_id++;
+}
+
+}  // namespace
+
+KernelCallRecorder::KernelCallRecorder(int64_t sampling_interval) : sampling_interval_{sampling_interval}, id_{GetNextRecorderId()} {
+    if (sampling_interval < 1) {
+        throw ChainerxError{"Sampling interval must be positive: ", sampling_interval};
+    }
+}
+
+bool KernelCallRecorder::ShouldSample() {
+    // The counter is per-thread to avoid contention. It restarts when the thread calls another recorder, so that the calls to a recorder
+    // are sampled in the same phase regardless of the calls made to the previous recorders.
+    thread_local uint64_t t_recorder_id{0};
+    thread_local int64_t t_call_count{0};
+    if (t_recorder_id != id_) {
+        t_recorder_id = id_;
+        t_call_count = 0;
+    }
+    return ++t_call_count % sampling_interval_ == 0;
+}
+
+void KernelCallRecorder::Record(const KernelCallSignature& signature) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    profile_.Add(signature);
+}
+
+KernelCallProfile KernelCallRecorder::GetProfile() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return profile_;
+}
+
+void KernelCallRecorder::Reset() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    profile_ = KernelCallProfile{};
+}
+
+std::atomic<KernelCallRecorder*> KernelCallRecordingScope::recorder_{nullptr};
+
+std::atomic<int64_t> KernelCallRecordingScope::holder_count_{0};
+
+KernelCallRecordingScope::KernelCallRecordingScope(KernelCallRecorder& recorder) {
+    KernelCallRecorder* expected{nullptr};
+    bool exchanged = recorder_.compare_exchange_strong(expected, &recorder, std::memory_order_acq_rel);
+    CHAINERX_ASSERT(exchanged);  // nested use is not supported
+}
+
+KernelCallRecordingScope::~KernelCallRecordingScope() {
+    recorder_.store(nullptr);
+    // Wait for the kernel calls which have taken the recorder. Holders created from now on see no recorder.
+    while (holder_count_.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+void PrewarmMemoryPool(Device& device, const KernelCallProfile& profile, size_t n) {
+    for (const std::pair<KernelCallSignature, int64_t>& pair : profile.GetHottest(n)) {
+        std::vector<std::shared_ptr<void>> chunks;
+        for (const KernelCallArraySignature& array : pair.first.arrays) {
+            int64_t lower{};
+            int64_t upper{};
+            std::tie(lower, upper) = GetDataRange(array.shape, array.strides, GetItemSize(array.dtype));
+            chunks.emplace_back(device.Allocate(static_cast<size_t>(upper - lower)));
+        }
+    }
+}
+
+namespace internal {
+
+void KernelCallArgSignatures<Array>::Append(std::vector<KernelCallArraySignature>& arrays, const Array& arg) {
+    arrays.push_back({arg.dtype(), arg.shape(), arg.strides(), arg.IsContiguous()});
+}
+
+void KernelCallArgSignatures<absl::optional<Array>>::Append(
+        std::vector<KernelCallArraySignature>& arrays, const absl::optional<Array>& arg) {
+    if (arg.has_value()) {
+        KernelCallArgSignatures<Array>::Append(arrays, *arg);
+    }
+}
+
+void KernelCallArgSignatures<std::vector<Array>>::Append(std::vector<KernelCallArraySignature>& arrays, const std::vector<Array>& arg) {
+    for (const Array& a : arg) {
+        KernelCallArgSignatures<Array>::Append(arrays, a);
+    }
+}
+
+}  // namespace internal
+}  // namespace chainerx
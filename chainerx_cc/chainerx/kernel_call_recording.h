@@ -0,0 +1,207 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/dtype.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+
+namespace chainerx {
+
+class Device;
+
+// Dtype, shape and memory layout of an array passed to a kernel.
+struct KernelCallArraySignature {
+    Dtype dtype;
+    Shape shape;
+    Strides strides;
+    bool is_contiguous;
+};
+
+bool operator==(const KernelCallArraySignature& lhs, const KernelCallArraySignature& rhs);
+
+inline bool operator!=(const KernelCallArraySignature& lhs, const KernelCallArraySignature& rhs) { return !(lhs == rhs); }
+
+// The key kernel name and the array arguments of a kernel call, in the order of the parameters of the kernel.
+// Arguments other than arrays (e.g. axes and scalars) are not part of the signature.
+struct KernelCallSignature {
+    std::string kernel_name;
+    std::vector<KernelCallArraySignature> arrays;
+};
+
+bool operator==(const KernelCallSignature& lhs, const KernelCallSignature& rhs);
+
+inline bool operator!=(const KernelCallSignature& lhs, const KernelCallSignature& rhs) { return !(lhs == rhs); }
+
+struct KernelCallSignatureHash {
+    size_t operator()(const KernelCallSignature& signature) const;
+};
+
+// Number of sampled calls for each kernel call signature.
+class KernelCallProfile {
+public:
+    void Add(const KernelCallSignature& signature, int64_t count = 1);
+
+    // Returns at most n signatures in descending order of their counts.
+    std::vector<std::pair<KernelCallSignature, int64_t>> GetHottest(size_t n) const;
+
+    // Returns the total number of sampled calls.
+    int64_t GetTotalCount() const;
+
+    // Returns the number of sampled calls for each squashed ndim, indexed from 0 to kMaxNdim.
+    // The squashed ndim of a call is that of the largest array argument, squashed together with the other arguments of the same shape
+    // as native elementwise kernels do. It can be used to choose CHAINERX_NATIVE_MAX_STATIC_NDIM for the workload.
+    std::vector<int64_t> GetSquashedNdimCounts() const;
+
+    bool empty() const { return counts_.empty(); }
+
+    // Writes the profile in a line-based text format which can be read by Load().
+    void Save(std::ostream& os) const;
+
+    // Reads a profile written by Save().
+    // Throws ChainerxError if the input is malformed.
+    static KernelCallProfile Load(std::istream& is);
+
+private:
+    std::unordered_map<KernelCallSignature, int64_t, KernelCallSignatureHash> counts_;
+};
+
+// Samples kernel calls dispatched by backends while a KernelCallRecordingScope is active.
+// Every sampling_interval-th call to this recorder on each thread is recorded, so that the overhead can be bounded in production workloads.
+// This class is thread safe.
+class KernelCallRecorder {
+public:
+    explicit KernelCallRecorder(int64_t sampling_interval = 1);
+
+    int64_t sampling_interval() const { return sampling_interval_; }
+
+    // Returns whether the current call should be recorded.
+    bool ShouldSample();
+
+    void Record(const KernelCallSignature& signature);
+
+    // Returns a copy of the profile recorded so far.
+    KernelCallProfile GetProfile() const;
+
+    void Reset();
+
+private:
+    int64_t sampling_interval_;
+
+    // Identifies the recorder in the per-thread call counts, which outlive the recorder.
+    uint64_t id_;
+
+    mutable std::mutex mutex_;
+
+    KernelCallProfile profile_;
+};
+
+// A scope object to record kernel calls.
+// Kernel calls made through Backend::CallKernel() on any thread within the scope are reported to the recorder specified in the
+// constructor. Only one kernel call recording scope can exist at any given moment.
+class KernelCallRecordingScope {
+public:
+    explicit KernelCallRecordingScope(KernelCallRecorder& recorder);
+    ~KernelCallRecordingScope();
+
+    KernelCallRecordingScope(const KernelCallRecordingScope&) = delete;
+    KernelCallRecordingScope& operator=(const KernelCallRecordingScope&) = delete;
+    KernelCallRecordingScope(KernelCallRecordingScope&& other) = delete;
+    KernelCallRecordingScope& operator=(KernelCallRecordingScope&& other) = delete;
+
+    // Holds the global kernel call recorder, if any.
+    // The scope which installed the recorder waits for all holders to be destroyed before it is destroyed, so that the recorder can be
+    // destroyed right after the scope.
+    class RecorderHolder {
+    public:
+        RecorderHolder() {
+            // Calls outside any scope do not touch the shared count of holders.
+            if (recorder_.load(std::memory_order_acquire) == nullptr) {
+                return;
+            }
+            ++holder_count_;
+            recorder_ptr_ = recorder_.load();
+            if (recorder_ptr_ == nullptr) {
+                --holder_count_;
+            }
+        }
+
+        ~RecorderHolder() {
+            if (recorder_ptr_ != nullptr) {
+                --holder_count_;
+            }
+        }
+
+        RecorderHolder(const RecorderHolder&) = delete;
+        RecorderHolder& operator=(const RecorderHolder&) = delete;
+        RecorderHolder(RecorderHolder&& other) = delete;
+        RecorderHolder& operator=(RecorderHolder&& other) = delete;
+
+        KernelCallRecorder* get() const { return recorder_ptr_; }
+
+    private:
+        KernelCallRecorder* recorder_ptr_{nullptr};
+    };
+
+private:
+    // The global kernel call recorder.
+    static std::atomic<KernelCallRecorder*> recorder_;
+
+    // The number of holders which may be using the global kernel call recorder.
+    static std::atomic<int64_t> holder_count_;
+};
+
+// Pre-populates the memory pool of the device with chunks for the arrays of the hottest n signatures in the profile, so that the first
+// calls with these signatures do not have to allocate fresh memory from the device.
+// The chunks of each signature are allocated together and released before the next signature.
+void PrewarmMemoryPool(Device& device, const KernelCallProfile& profile, size_t n);
+
+namespace internal {
+
+// Appends the signatures of the arrays in a kernel argument. Arguments of other types are ignored.
+template <typename T>
+struct KernelCallArgSignatures {
+    static void Append(std::vector<KernelCallArraySignature>& /*arrays*/, const T& /*arg*/) {}
+};
+
+template <>
+struct KernelCallArgSignatures<Array> {
+    static void Append(std::vector<KernelCallArraySignature>& arrays, const Array& arg);
+};
+
+template <>
+struct KernelCallArgSignatures<absl::optional<Array>> {
+    static void Append(std::vector<KernelCallArraySignature>& arrays, const absl::optional<Array>& arg);
+};
+
+template <>
+struct KernelCallArgSignatures<std::vector<Array>> {
+    static void Append(std::vector<KernelCallArraySignature>& arrays, const std::vector<Array>& arg);
+};
+
+template <typename... Args>
+void RecordKernelCall(KernelCallRecorder& recorder, const char* kernel_name, const Args&... args) {
+    if (!recorder.ShouldSample()) {
+        return;
+    }
+    KernelCallSignature signature{kernel_name, {}};
+    (void)std::initializer_list<int>{(KernelCallArgSignatures<std::decay_t<Args>>::Append(signature.arrays, args), 0)...};
+    recorder.Record(signature);
+}
+
+}  // namespace internal
+}  // namespace chainerx
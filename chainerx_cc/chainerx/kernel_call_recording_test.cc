@@ -0,0 +1,219 @@
+#include "chainerx/kernel_call_recording.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/constant.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/arithmetic.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+#include "chainerx/testing/allocation_count.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class KernelCallRecordingTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+    Device& device() { return device_session_->device(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(KernelCallRecordingTest, Record) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array b = testing::BuildArray({2, 3}).WithLinearData<float>().WithPadding(1);
+    Array c = testing::BuildArray({4}).WithLinearData<int32_t>();
+
+    KernelCallRecorder recorder{};
+    {
+        KernelCallRecordingScope scope{recorder};
+        a + b;
+        a + b;
+        c + c;
+    }
+    // Calls outside the scope are not recorded.
+    a + b;
+
+    KernelCallProfile profile = recorder.GetProfile();
+    EXPECT_EQ(3, profile.GetTotalCount());
+
+    std::vector<std::pair<KernelCallSignature, int64_t>> hottest = profile.GetHottest(10);
+    ASSERT_EQ(size_t{2}, hottest.size());
+
+    const KernelCallSignature& add_float = hottest[0].first;
+    EXPECT_EQ(2, hottest[0].second);
+    EXPECT_EQ("Add", add_float.kernel_name);
+    // Two inputs and the output.
+    ASSERT_EQ(size_t{3}, add_float.arrays.size());
+    EXPECT_EQ(Dtype::kFloat32, add_float.arrays[0].dtype);
+    EXPECT_EQ(Shape({2, 3}), add_float.arrays[0].shape);
+    EXPECT_EQ(Strides({12, 4}), add_float.arrays[0].strides);
+    EXPECT_TRUE(add_float.arrays[0].is_contiguous);
+    EXPECT_EQ(b.strides(), add_float.arrays[1].strides);
+    EXPECT_FALSE(add_float.arrays[1].is_contiguous);
+
+    EXPECT_EQ(1, hottest[1].second);
+    EXPECT_EQ(Dtype::kInt32, hottest[1].first.arrays[0].dtype);
+
+    ASSERT_EQ(size_t{1}, profile.GetHottest(1).size());
+    EXPECT_EQ(add_float, profile.GetHottest(1)[0].first);
+}
+
+TEST_F(KernelCallRecordingTest, Sampling) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+
+    KernelCallRecorder recorder{4};
+    {
+        KernelCallRecordingScope scope{recorder};
+        for (int i = 0; i < 20; ++i) {
+            a + a;
+        }
+    }
+    EXPECT_EQ(5, recorder.GetProfile().GetTotalCount());
+
+    recorder.Reset();
+    EXPECT_TRUE(recorder.GetProfile().empty());
+
+    EXPECT_THROW(KernelCallRecorder{0}, ChainerxError);
+}
+
+TEST_F(KernelCallRecordingTest, SamplingPerRecorder) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+
+    // The calls to the previous recorder do not shift the phase of sampling.
+    KernelCallRecorder first{2};
+    {
+        KernelCallRecordingScope scope{first};
+        a + a;
+    }
+    KernelCallRecorder second{2};
+    {
+        KernelCallRecordingScope scope{second};
+        a + a;
+    }
+    EXPECT_EQ(0, first.GetProfile().GetTotalCount());
+    EXPECT_EQ(0, second.GetProfile().GetTotalCount());
+}
+
+TEST_F(KernelCallRecordingTest, MultiThread) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+
+    KernelCallRecorder recorder{};
+    {
+        KernelCallRecordingScope scope{recorder};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([this, &a]() {
+                SetDefaultContext(&device().context());
+                SetDefaultDevice(&device());
+                for (int j = 0; j < 10; ++j) {
+                    a + a;
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+    std::vector<std::pair<KernelCallSignature, int64_t>> hottest = recorder.GetProfile().GetHottest(10);
+    ASSERT_EQ(size_t{1}, hottest.size());
+    EXPECT_EQ(40, hottest[0].second);
+}
+
+TEST_F(KernelCallRecordingTest, DestroyWhileCalling) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+
+    // Recorders are destroyed right after their scopes while other threads keep calling kernels.
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([this, &a, &done]() {
+            SetDefaultContext(&device().context());
+            SetDefaultDevice(&device());
+            while (!done.load()) {
+                a + a;
+            }
+        });
+    }
+    for (int i = 0; i < 100; ++i) {
+        auto recorder = std::make_unique<KernelCallRecorder>();
+        {
+            KernelCallRecordingScope scope{*recorder};
+            a + a;
+        }
+        EXPECT_LE(1, recorder->GetProfile().GetTotalCount());
+        recorder.reset();
+    }
+    done.store(true);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST_F(KernelCallRecordingTest, SaveLoad) {
+    KernelCallProfile profile{};
+    profile.Add({"Add", {{Dtype::kFloat32, {2, 3}, {12, 4}, true}, {Dtype::kFloat32, {2, 3}, {16, 4}, false}}}, 5);
+    profile.Add({"Sum", {{Dtype::kInt64, {}, {}, true}}}, 3);
+    profile.Add({"Arange", {}}, 1);
+
+    std::stringstream ss;
+    profile.Save(ss);
+    KernelCallProfile loaded = KernelCallProfile::Load(ss);
+
+    EXPECT_EQ(profile.GetHottest(10), loaded.GetHottest(10));
+
+    std::istringstream malformed{"3 Add 1 float32 2 2 3"};
+    EXPECT_THROW(KernelCallProfile::Load(malformed), ChainerxError);
+}
+
+TEST_F(KernelCallRecordingTest, GetSquashedNdimCounts) {
+    KernelCallProfile profile{};
+    // Contiguous arrays squash to 1 dimension.
+    profile.Add({"Add", {{Dtype::kFloat32, {2, 3}, {12, 4}, true}, {Dtype::kFloat32, {2, 3}, {12, 4}, true}}}, 5);
+    // A padded argument keeps both dimensions.
+    profile.Add({"Add", {{Dtype::kFloat32, {2, 3}, {12, 4}, true}, {Dtype::kFloat32, {2, 3}, {16, 4}, false}}}, 3);
+    // Smaller arguments, e.g. reduction outputs, do not prevent squashing.
+    profile.Add({"Sum", {{Dtype::kFloat32, {2, 1, 3, 4}, {48, 48, 16, 4}, true}, {Dtype::kFloat32, {2}, {4}, true}}}, 2);
+    profile.Add({"Arange", {}}, 1);
+
+    std::vector<int64_t> expected(kMaxNdim + 1);
+    expected[1] = 5 + 2;
+    expected[2] = 3;
+    EXPECT_EQ(expected, profile.GetSquashedNdimCounts());
+}
+
+TEST_F(KernelCallRecordingTest, PrewarmMemoryPool) {
+    KernelCallProfile profile{};
+    profile.Add({"Add", {{Dtype::kFloat32, {2, 3}, {12, 4}, true}, {Dtype::kFloat32, {2, 3}, {16, 4}, false}}}, 5);
+    profile.Add({"Sum", {{Dtype::kInt64, {4}, {8}, true}}}, 3);
+
+    testing::AllocationCount allocations = testing::CountAllocations([this, &profile]() { PrewarmMemoryPool(device(), profile, 1); });
+    EXPECT_EQ(2, allocations.count);
+    EXPECT_EQ(24 + 28, allocations.bytesize);
+}
+
+}  // namespace
+}  // namespace chainerx
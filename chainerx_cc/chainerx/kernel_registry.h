@@ -7,6 +7,7 @@
 
 #include "chainerx/error.h"
 #include "chainerx/kernel.h"
+#include "chainerx/lock_profiling.h"
 #include "chainerx/macro.h"
 
 namespace chainerx {
@@ -46,14 +47,15 @@ public:
     explicit KernelRegistry(KernelRegistry* parent) : parent_{parent} {}
 
     // Registers a kernel.
-    // Registers an instance of KernelType with the type_index of KeyKernelType as the key.
+    // Registers KernelType with the type_index of KeyKernelType as the key.
     // KernelType must be a subclass of KeyKernelType.
+    // The kernel is instantiated lazily on the first lookup, so that registrations during static initialization stay cheap.
     template <typename KeyKernelType, typename KernelType>
     void RegisterKernel() {
         static_assert(std::is_base_of<KeyKernelType, KernelType>::value, "KernelType must be a subclass of KeyKernelType.");
-        std::lock_guard<std::mutex> lock{*mutex_};
+        std::lock_guard<internal::ProfiledMutex> lock{*mutex_};
         std::type_index key{internal::GetKeyKernelTypeIndex<KeyKernelType>()};
-        auto pair = kernels_.emplace(key, std::make_unique<KernelType>());
+        auto pair = kernels_.emplace(key, KernelEntry{&CreateKernel<KernelType>, nullptr});
         if (!pair.second) {
             throw ChainerxError{"Duplicate kernel: ", internal::GetKeyKernelName<KeyKernelType>()};
         }
@@ -64,10 +66,14 @@ public:
     Kernel& GetKernel() {
         std::type_index key{internal::GetKeyKernelTypeIndex<KeyKernelType>()};
         {
-            std::lock_guard<std::mutex> lock{*mutex_};
+            std::lock_guard<internal::ProfiledMutex> lock{*mutex_};
             auto it = kernels_.find(key);
             if (it != kernels_.end()) {
-                return *it->second;
+                KernelEntry& entry = it->second;
+                if (entry.kernel == nullptr) {
+                    entry.kernel = entry.factory();
+                }
+                return *entry.kernel;
             }
         }
         if (parent_ != nullptr) {
@@ -77,11 +83,24 @@ public:
     }
 
 private:
-    std::unique_ptr<std::mutex> mutex_{std::make_unique<std::mutex>()};
+    using KernelFactory = std::unique_ptr<Kernel> (*)();
+
+    // A registered kernel and its instance, which is created on the first lookup.
+    struct KernelEntry {
+        KernelFactory factory;
+        std::unique_ptr<Kernel> kernel;
+    };
+
+    template <typename KernelType>
+    static std::unique_ptr<Kernel> CreateKernel() {
+        return std::make_unique<KernelType>();
+    }
+
+    std::unique_ptr<internal::ProfiledMutex> mutex_{std::make_unique<internal::ProfiledMutex>(LockSite::kKernelRegistry)};
 
     KernelRegistry* parent_{};
 
-    std::unordered_map<std::type_index, std::unique_ptr<Kernel>> kernels_{};
+    std::unordered_map<std::type_index, KernelEntry> kernels_{};
 };
 
 namespace internal {
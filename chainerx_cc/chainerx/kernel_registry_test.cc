@@ -41,6 +41,15 @@ public:
     virtual std::string Call(const std::string& a, float b) { return a + std::to_string(b); }
 };
 
+class MyCountingKernel : public Kernel {
+public:
+    MyCountingKernel() { ++instance_count; }
+
+    static int instance_count;
+};
+
+int MyCountingKernel::instance_count = 0;
+
 }  // namespace
 
 namespace internal {
@@ -49,6 +58,7 @@ CHAINERX_REGISTER_KEY_KERNEL(MyChildKernel, "mychildkernel");
 CHAINERX_REGISTER_KEY_KERNEL(MyParentKernel, "myparentkernel");
 CHAINERX_REGISTER_KEY_KERNEL(MyChildKernel2, "mychildkernel2");
 CHAINERX_REGISTER_KEY_KERNEL(MyParentKernel2, "myparentkernel2");
+CHAINERX_REGISTER_KEY_KERNEL(MyCountingKernel, "mycountingkernel");
 }  // namespace internal
 
 namespace {
@@ -66,6 +76,22 @@ TEST(KernelRegistryTest, KernelRegistry) {
     EXPECT_EQ(mykernel.Call(3, " is 3"), "3 is 3");
 }
 
+TEST(KernelRegistryTest, LazyInstantiation) {
+    KernelRegistry kernel_registry{};
+    MyCountingKernel::instance_count = 0;
+
+    kernel_registry.RegisterKernel<MyCountingKernel, MyCountingKernel>();
+    EXPECT_EQ(0, MyCountingKernel::instance_count);
+
+    Kernel& kernel1 = kernel_registry.GetKernel<MyCountingKernel>();
+    EXPECT_EQ(1, MyCountingKernel::instance_count);
+
+    // The same instance is returned by subsequent lookups.
+    Kernel& kernel2 = kernel_registry.GetKernel<MyCountingKernel>();
+    EXPECT_EQ(1, MyCountingKernel::instance_count);
+    EXPECT_EQ(&kernel1, &kernel2);
+}
+
 TEST(KernelRegistryTest, KernelRegistryHierarchy) {
     KernelRegistry parent_kernel_registry{};
     KernelRegistry kernel_registry1{&parent_kernel_registry};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "chainerx/array.h"
+#include "chainerx/kernel.h"
+
+namespace chainerx {
+namespace activation_detail {
+
+// Constants shared by the activation routines and the native and CUDA kernels.
+constexpr double kInvSqrt2 = 0.70710678118654752440;  // 1 / sqrt(2)
+constexpr double kInvSqrt2Pi = 0.39894228040143267794;  // 1 / sqrt(2 * pi)
+constexpr double kSqrt2OverPi = 0.79788456080286535588;  // sqrt(2 / pi)
+constexpr double kGeluTanhCoeff = 0.044715;
+
+}  // namespace activation_detail
+
+// Elementwise activations computed in a single pass.
+//
+// x and out may be the same array, so that the activations can be applied in place to the outputs of other kernels.
+// The gradient kernels compute gx = gout * f'(x).
+
+// Computes the Gaussian error linear unit x * Phi(x), where Phi is the cumulative distribution function of the standard normal
+// distribution. If approximate is true, Phi(x) is approximated by 0.5 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))).
+class GeluKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, bool approximate, const Array& out) = 0;
+};
+
+class GeluGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& gout, bool approximate, const Array& out) = 0;
+};
+
+// Computes x * sigmoid(x).
+class SiluKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& out) = 0;
+};
+
+class SiluGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& gout, const Array& out) = 0;
+};
+
+// Computes x * tanh(softplus(x)).
+class MishKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& out) = 0;
+};
+
+class MishGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& gout, const Array& out) = 0;
+};
+
+// Computes x * min(max(x + 3, 0), 6) / 6.
+class HardSwishKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& out) = 0;
+};
+
+class HardSwishGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& gout, const Array& out) = 0;
+};
+
+}  // namespace chainerx
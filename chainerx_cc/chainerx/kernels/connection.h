@@ -17,6 +17,8 @@ namespace chainerx {
 // w: (out_channels, in_channels, k_1, k_2, ..., k_n)
 // b: (out_channels)
 //
+// Kernel elements are applied to input elements dilate apart along each spatial dimension.
+//
 // Returns an array of shape (batch_size, out_channels, out_1, out_2, ..., out_n).
 class ConvKernel : public Kernel {
 public:
@@ -26,6 +28,7 @@ public:
             const absl::optional<Array>& b,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             bool cover_all,
             Dtype out_dtype,
             const absl::optional<Array>& out) = 0;
@@ -37,6 +40,8 @@ public:
 // w: (in_channels, out_channels, k_1, k_2, ..., k_n)
 // b: (out_channels)
 //
+// Kernel elements are applied to output elements dilate apart along each spatial dimension.
+//
 // Returns an array of shape (batch_size, out_channels, out_1, out_2, ..., out_n).
 class ConvTransposeKernel : public Kernel {
 public:
@@ -46,6 +51,7 @@ public:
             const absl::optional<Array>& b,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             const Dims& out_size,
             Dtype out_dtype,
             const absl::optional<Array>& out) = 0;
@@ -60,6 +66,7 @@ public:
             const Array& gy,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             bool cover_all,
             const absl::optional<Array>& out) = 0;
 };
@@ -2,10 +2,15 @@
 
 #include <cstdint>
 
+#include <absl/types/optional.h>
+
 #include "chainerx/array.h"
 #include "chainerx/array_index.h"
 #include "chainerx/kernel.h"
+#include "chainerx/macro.h"
 #include "chainerx/routines/indexing.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/scalar.h"
 
 namespace chainerx {
 
@@ -19,6 +24,30 @@ public:
     virtual void Call(const Array& a, const Array& indices, int8_t axis, const Array& out, IndexBoundsMode mode) = 0;
 };
 
+// Reduces the rows of the table at indices into the rows of out, as EmbeddingBag does.
+// indices and offsets are contiguous int64 arrays. weights, if given, has the dtype of the table and is only used with kSum.
+// reduction is one of kSum, kMax and kMin. For kMax and kMin, out_arg receives the row of the table each element of out is taken from,
+// or -1 for empty bags.
+class EmbeddingBagKernel : public Kernel {
+public:
+    virtual void Call(
+            const Array& table,
+            const Array& indices,
+            const Array& offsets,
+            const absl::optional<Array>& weights,
+            SegmentReduction reduction,
+            const Array& out,
+            const absl::optional<Array>& out_arg) = 0;
+};
+
+// Adds the rows of gout, multiplied by weights if given, to the rows of out at the indices in their bags.
+// This is the transpose of the sum of EmbeddingBagKernel.
+class EmbeddingBagGradKernel : public Kernel {
+public:
+    virtual void Call(
+            const Array& gout, const Array& indices, const Array& offsets, const absl::optional<Array>& weights, const Array& out) = 0;
+};
+
 class WhereKernel : public Kernel {
 public:
     virtual void Call(const Array& condition, const Array& x, const Array& y, const Array& out) = 0;
@@ -39,4 +68,68 @@ public:
     virtual void Call(const Array& condition, Scalar x, Scalar y, const Array& out) = 0;
 };
 
+// Evaluates the comparison of WhereCompare kernels on elements.
+template <typename T>
+CHAINERX_HOST_DEVICE bool ApplyCompareOp(CompareOp op, T a, T b) {
+    switch (op) {
+        case CompareOp::kEqual:
+            return a == b;
+        case CompareOp::kNotEqual:
+            return a != b;
+        case CompareOp::kGreater:
+            return a > b;
+        case CompareOp::kGreaterEqual:
+            return a >= b;
+        case CompareOp::kLess:
+            return a < b;
+        case CompareOp::kLessEqual:
+            return a <= b;
+    }
+    return false;
+}
+
+// Compares a and b and assigns either x or y according to the result, without materializing the boolean condition.
+// Formally, it calculates: out = a op b ? x : y
+// The letters in the names of the kernels indicate whether b, x and y are arrays (A) or scalars (S).
+// All arrays have the shape and the dtype of the output, in which a and b are compared. Scalars are cast to the dtype of the output.
+class WhereCompareAAAAKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, const Array& b, const Array& x, const Array& y, const Array& out) = 0;
+};
+
+class WhereCompareAAASKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, const Array& b, const Array& x, Scalar y, const Array& out) = 0;
+};
+
+class WhereCompareAASAKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, const Array& b, Scalar x, const Array& y, const Array& out) = 0;
+};
+
+class WhereCompareAASSKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, const Array& b, Scalar x, Scalar y, const Array& out) = 0;
+};
+
+class WhereCompareASAAKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, Scalar b, const Array& x, const Array& y, const Array& out) = 0;
+};
+
+class WhereCompareASASKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, Scalar b, const Array& x, Scalar y, const Array& out) = 0;
+};
+
+class WhereCompareASSAKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, Scalar b, Scalar x, const Array& y, const Array& out) = 0;
+};
+
+class WhereCompareASSSKernel : public Kernel {
+public:
+    virtual void Call(CompareOp op, const Array& a, Scalar b, Scalar x, Scalar y, const Array& out) = 0;
+};
+
 }  // namespace chainerx
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/float16.h"
+#include "chainerx/kernel.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+namespace manipulation_detail {
+
+template <typename InT, typename OutT>
+struct UnpackCompute {
+    using type = std::common_type_t<InT, OutT>;
+};
+
+template <typename OutT>
+struct UnpackCompute<Float16, OutT> {
+    using type = float;
+};
+
+template <typename InT>
+struct UnpackCompute<InT, Float16> {
+    using type = float;
+};
+
+template <>
+struct UnpackCompute<Float16, Float16> {
+    using type = float;
+};
+
+// Type in which the Unpack kernels multiply the elements by the scale.
+// It is float if either type is Float16, and otherwise the wider of the two.
+template <typename InT, typename OutT>
+using UnpackComputeType = typename UnpackCompute<InT, OutT>::type;
+
+}  // namespace manipulation_detail
+
+// Copies the elements of the arrays in row-major order into consecutive ranges of out, casting them to the dtype of out.
+//
+// out must be a contiguous 1-dimensional array whose size is the total size of the arrays.
+// The arrays may have arbitrary strides and dtypes and need to reside on the device of out.
+class PackKernel : public Kernel {
+public:
+    virtual void Call(const std::vector<Array>& arrays, const Array& out) = 0;
+};
+
+// Copies consecutive ranges of a, multiplied by scale, into the output arrays in row-major order.
+// The products are computed in manipulation_detail::UnpackComputeType and then cast to the dtypes of the outputs.
+//
+// a must be a contiguous 1-dimensional array whose size is the total size of the outputs.
+class UnpackKernel : public Kernel {
+public:
+    virtual void Call(const Array& a, Scalar scale, const std::vector<Array>& outs) = 0;
+};
+
+}  // namespace chainerx
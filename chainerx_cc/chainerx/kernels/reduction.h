@@ -5,6 +5,7 @@
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
 #include "chainerx/kernel.h"
+#include "chainerx/routines/reduction.h"
 
 namespace chainerx {
 
@@ -30,4 +31,21 @@ public:
     virtual void Call(const Array& a, const Axes& axis, const Array& out) = 0;
 };
 
+// Reduces the rows of the matrix data into the rows of the matrix out given by segment_ids, and adds the number of rows reduced into
+// each row of out to counts.
+// If include_out is false, the initial values of the rows of out into which any row is reduced are discarded.
+// data and out have the same dtype, and segment_ids and counts are contiguous int64 arrays. kMean is not supported.
+// If sorted is true, segment_ids must be non-decreasing.
+class SegmentReduceKernel : public Kernel {
+public:
+    virtual void Call(
+            const Array& data,
+            const Array& segment_ids,
+            SegmentReduction reduction,
+            bool sorted,
+            bool include_out,
+            const Array& out,
+            const Array& counts) = 0;
+};
+
 }  // namespace chainerx
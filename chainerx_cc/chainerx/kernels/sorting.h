@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tuple>
+
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
 #include "chainerx/kernel.h"
@@ -16,6 +18,21 @@ public:
     virtual void Call(const Array& a, const Axes& axis, const Array& out) = 0;
 };
 
+// Calculates the maximum along specified axes and its index, in a single pass.
+// NaN is propagated as in AMaxKernel, and out_argmax holds the smallest index of the maximum (or of NaN) along the axes.
+// The outputs must be contiguous.
+class MaxAndArgMaxKernel : public Kernel {
+public:
+    virtual void Call(const Array& a, const Axes& axis, const Array& out_max, const Array& out_argmax) = 0;
+};
+
+// Calculates the minimum along specified axes and its index, in a single pass.
+// See MaxAndArgMaxKernel for the details.
+class MinAndArgMinKernel : public Kernel {
+public:
+    virtual void Call(const Array& a, const Axes& axis, const Array& out_min, const Array& out_argmin) = 0;
+};
+
 class NanArgMaxKernel : public Kernel {
 public:
     virtual void Call(const Array& a, const Axes& axis, const Array& out) = 0;
@@ -26,4 +43,19 @@ public:
     virtual void Call(const Array& a, const Axes& axis, const Array& out) = 0;
 };
 
+// Returns the sorted unique elements of the 1-dimensional array a and the int64 arrays of their first indices, the inverse indices and
+// the counts, as Unique does.
+class UniqueKernel : public Kernel {
+public:
+    virtual std::tuple<Array, Array, Array, Array> Call(const Array& a) = 0;
+};
+
+// Searches the elements in the rows of the matrix v in the corresponding rows of the matrix a, each of which is sorted, and stores the
+// insertion indices into the int64 matrix out of the shape of v.
+// a and v have the same dtype.
+class SearchsortedKernel : public Kernel {
+public:
+    virtual void Call(const Array& a, const Array& v, bool right, const Array& out) = 0;
+};
+
 }  // namespace chainerx
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "chainerx/array.h"
+#include "chainerx/kernel.h"
+
+namespace chainerx {
+
+// Computes the product of the sparse matrix in the CSR format, with the non-zero elements data at the columns indices and the row
+// pointers indptr, and the dense matrix b into out.
+// data, b and out have the same dtype, and indices and indptr are int64.
+class CsrMatmulKernel : public Kernel {
+public:
+    virtual void Call(const Array& data, const Array& indices, const Array& indptr, const Array& b, const Array& out) = 0;
+};
+
+// Computes the dot products of the rows of a and b at the non-zero positions of the sparse matrix in the CSR format, i.e.
+// out[p] = a[i, :] . b[indices[p], :] for indptr[i] <= p < indptr[i + 1].
+// a, b and out have the same dtype, and indices and indptr are int64.
+class CsrSampledDotKernel : public Kernel {
+public:
+    virtual void Call(const Array& indices, const Array& indptr, const Array& a, const Array& b, const Array& out) = 0;
+};
+
+// Sorts the non-zero elements of a sparse matrix in the COO format by their rows, keeping the order of the elements in the same row.
+// out_indptr is set to the row pointers of the CSR format, and out_order to the indices of the elements in the sorted order.
+// row, out_indptr and out_order are int64.
+class CooToCsrKernel : public Kernel {
+public:
+    virtual void Call(const Array& row, const Array& out_indptr, const Array& out_order) = 0;
+};
+
+}  // namespace chainerx
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
+
+#include <absl/types/optional.h>
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
@@ -22,4 +25,29 @@ public:
     virtual void Call(const Array& src, const Axes& axis, const Array& out) = 0;
 };
 
+// Counts the occurrences of the non-negative integers of the 1-dimensional int64 array x into the 1-dimensional array out, which has
+// more elements than the maximum of x. If weights are given, they are summed instead of ones.
+// weights and out have the same dtype.
+class BincountKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const absl::optional<Array>& weights, const Array& out) = 0;
+};
+
+// Counts the elements of the 1-dimensional array a in the bins given by the monotonically increasing edges into the 1-dimensional array
+// out, which has one element less than edges. Elements outside of the edges are ignored, and the last bin includes its right edge.
+// If weights are given, they are summed instead of ones.
+// a and edges have the same dtype, and weights and out have the same dtype.
+class HistogramKernel : public Kernel {
+public:
+    virtual void Call(const Array& a, const Array& edges, const absl::optional<Array>& weights, const Array& out) = 0;
+};
+
+// Calculates the quantiles q in [0, 1] of each row of the matrix a into the matrix out of shape (q.size(), a.shape()[0]), linearly
+// interpolated between the nearest elements. NaNs are ignored if ignore_nan is true, and otherwise result in NaN, as do empty rows.
+// a and out have the same floating point dtype.
+class QuantileKernel : public Kernel {
+public:
+    virtual void Call(const Array& a, const std::vector<double>& q, bool ignore_nan, const Array& out) = 0;
+};
+
 }  // namespace chainerx
@@ -0,0 +1,76 @@
+#include "chainerx/lock_profiling.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace {
+
+struct LockWaitCounter {
+    std::atomic<int64_t> contended_count{0};
+    std::atomic<int64_t> wait_ns{0};
+};
+
+std::array<LockWaitCounter, kLockSiteCount>& GetLockWaitCounters() {
+    static std::array<LockWaitCounter, kLockSiteCount> counters{};
+    return counters;
+}
+
+LockWaitCounter& GetLockWaitCounter(LockSite site) {
+    auto index = static_cast<size_t>(site);
+    CHAINERX_ASSERT(index < kLockSiteCount);
+    return GetLockWaitCounters()[index];
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, LockSite site) {
+    switch (site) {
+        case LockSite::kKernelRegistry:
+            return os << "KernelRegistry";
+        case LockSite::kContext:
+            return os << "Context";
+        case LockSite::kBackendDevices:
+            return os << "BackendDevices";
+    }
+    CHAINERX_NEVER_REACH();
+}
+
+LockWaitStats GetLockWaitStats(LockSite site) {
+    const LockWaitCounter& counter = GetLockWaitCounter(site);
+    LockWaitStats stats{};
+    stats.contended_count = counter.contended_count.load(std::memory_order_relaxed);
+    stats.wait_ns = counter.wait_ns.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ResetLockWaitStats() {
+    for (LockWaitCounter& counter : GetLockWaitCounters()) {
+        counter.contended_count.store(0, std::memory_order_relaxed);
+        counter.wait_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+namespace internal {
+
+void RecordLockWait(LockSite site, int64_t wait_ns) {
+    LockWaitCounter& counter = GetLockWaitCounter(site);
+    counter.contended_count.fetch_add(1, std::memory_order_relaxed);
+    counter.wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+}
+
+void ProfiledMutex::LockContended() {
+    auto start = std::chrono::steady_clock::now();
+    mutex_.lock();
+    auto end = std::chrono::steady_clock::now();
+    RecordLockWait(site_, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+namespace chainerx {
+
+// Groups of internal mutexes whose contention is accounted together.
+enum class LockSite {
+    kKernelRegistry = 0,  // Mutexes of KernelRegistry, including the global registries of the backends.
+    kContext,  // Mutexes of Context, guarding backends and backprop IDs.
+    kBackendDevices,  // Mutexes of Backend, guarding device creation.
+};
+
+constexpr int kLockSiteCount = 3;
+
+std::ostream& operator<<(std::ostream& os, LockSite site);
+
+// Contention statistics of the mutexes of a lock site.
+// Only acquisitions that had to block are counted; uncontended acquisitions are not recorded.
+struct LockWaitStats {
+    // Number of acquisitions that found the mutex held by another thread.
+    int64_t contended_count{0};
+
+    // Total time spent blocking in those acquisitions, in nanoseconds.
+    int64_t wait_ns{0};
+};
+
+// Returns the accumulated contention statistics of the lock site.
+// This function is thread safe.
+LockWaitStats GetLockWaitStats(LockSite site);
+
+// Resets the contention statistics of all lock sites.
+void ResetLockWaitStats();
+
+namespace internal {
+
+// Records a blocked acquisition of a mutex of the lock site.
+void RecordLockWait(LockSite site, int64_t wait_ns);
+
+// A mutex that records the time threads spend waiting for it.
+// The uncontended path is a single try_lock, so the overhead is only paid by acquisitions that would block anyway.
+// Satisfies the Lockable requirements and can be used with std::lock_guard and std::unique_lock.
+class ProfiledMutex {
+public:
+    explicit ProfiledMutex(LockSite site) : site_{site} {}
+
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex(ProfiledMutex&&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(ProfiledMutex&&) = delete;
+
+    void lock() {
+        if (mutex_.try_lock()) {
+            return;
+        }
+        LockContended();
+    }
+
+    bool try_lock() { return mutex_.try_lock(); }
+
+    void unlock() { mutex_.unlock(); }
+
+private:
+    void LockContended();
+
+    std::mutex mutex_;
+    LockSite site_;
+};
+
+}  // namespace internal
+}  // namespace chainerx
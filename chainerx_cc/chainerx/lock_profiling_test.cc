@@ -0,0 +1,69 @@
+#include "chainerx/lock_profiling.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace {
+
+TEST(LockProfilingTest, Uncontended) {
+    ResetLockWaitStats();
+    internal::ProfiledMutex mutex{LockSite::kContext};
+    {
+        std::lock_guard<internal::ProfiledMutex> lock{mutex};
+    }
+    LockWaitStats stats = GetLockWaitStats(LockSite::kContext);
+    EXPECT_EQ(0, stats.contended_count);
+    EXPECT_EQ(0, stats.wait_ns);
+}
+
+TEST(LockProfilingTest, Contended) {
+    ResetLockWaitStats();
+    internal::ProfiledMutex mutex{LockSite::kBackendDevices};
+    std::atomic<bool> waiting{false};
+
+    std::unique_lock<internal::ProfiledMutex> lock{mutex};
+    std::thread thread{[&mutex, &waiting]() {
+        waiting = true;
+        std::lock_guard<internal::ProfiledMutex> inner_lock{mutex};
+    }};
+    while (!waiting) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    lock.unlock();
+    thread.join();
+
+    LockWaitStats stats = GetLockWaitStats(LockSite::kBackendDevices);
+    EXPECT_EQ(1, stats.contended_count);
+    EXPECT_GT(stats.wait_ns, 0);
+
+    // Other sites are not affected.
+    EXPECT_EQ(0, GetLockWaitStats(LockSite::kKernelRegistry).contended_count);
+
+    ResetLockWaitStats();
+    EXPECT_EQ(0, GetLockWaitStats(LockSite::kBackendDevices).contended_count);
+    EXPECT_EQ(0, GetLockWaitStats(LockSite::kBackendDevices).wait_ns);
+}
+
+TEST(LockProfilingTest, TryLock) {
+    internal::ProfiledMutex mutex{LockSite::kKernelRegistry};
+    EXPECT_TRUE(mutex.try_lock());
+    std::thread thread{[&mutex]() { EXPECT_FALSE(mutex.try_lock()); }};
+    thread.join();
+    mutex.unlock();
+}
+
+TEST(LockProfilingTest, LockSiteToString) {
+    std::ostringstream os;
+    os << LockSite::kKernelRegistry << " " << LockSite::kContext << " " << LockSite::kBackendDevices;
+    EXPECT_EQ("KernelRegistry Context BackendDevices", os.str());
+}
+
+}  // namespace
+}  // namespace chainerx
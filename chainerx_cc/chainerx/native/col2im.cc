@@ -1,23 +1,29 @@
 #include "chainerx/native/col2im.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
-#include <vector>
+#include <functional>
+#include <iterator>
+#include <numeric>
+
+#include <absl/types/optional.h>
 
 #include "chainerx/array.h"
-#include "chainerx/array_index.h"
+#include "chainerx/backend.h"
+#include "chainerx/backend_util.h"
 #include "chainerx/constant.h"
 #include "chainerx/device.h"
 #include "chainerx/dims.h"
 #include "chainerx/dtype.h"
-#include "chainerx/indexable_array.h"
-#include "chainerx/indexer.h"
+#include "chainerx/kernels/creation.h"
 #include "chainerx/macro.h"
-#include "chainerx/native/data_type.h"
+#include "chainerx/native/im2col.h"
+#include "chainerx/native/parallel.h"
+#include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
-#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
-#include "chainerx/slice.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
@@ -25,87 +31,132 @@ namespace native_internal {
 
 namespace {
 
+// Accumulates the patches of col into the contiguous zero-initialized out.
+// Patch elements which fall in the padding are skipped, so that no padded output needs to be allocated. Rows of col along the last patch
+// dimension are accumulated as contiguous runs if the stride is 1 and col is contiguous along the last axis. Each (batch, channel) plane of
+// out is only written from the corresponding plane of col, so that the planes are accumulated in parallel. Kernel element k along an image
+// dimension is accumulated into the image index o * stride + k * dilate - pad.
 template <typename T, int8_t kKernelNdim>
-void Col2ImImpl(const Array& col, const Array& out, const Dims& stride, const Indexer<2>& batch_channel_indexer) {
-    static constexpr int8_t kColNdim = 2 + 2 * kKernelNdim;
-    static constexpr int8_t kOutNdim = 2 + kKernelNdim;
+void Col2ImImpl(const Array& col, const Array& out, const Dims& stride, const Dims& pad, const Dims& dilate) {
+    static_assert(kKernelNdim > 0, "Kernels of ndim 0 are copied.");
+    static constexpr int8_t kLast = kKernelNdim - 1;
 
     CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(stride.size()));
-    CHAINERX_ASSERT(kColNdim == col.ndim());
-    CHAINERX_ASSERT(kOutNdim == out.ndim());
-
-    Indexer<kKernelNdim> kernel_indexer{Shape{col.shape().begin() + 2, col.shape().begin() + 2 + kKernelNdim}};
-    Indexer<kKernelNdim> in_image_dims_indexer{Shape{col.shape().begin() + 2 + kKernelNdim, col.shape().end()}};
-    Indexer<kColNdim> col_indexer{col.shape()};
-    Indexer<kOutNdim> out_indexer{out.shape()};
-    IndexableArray<const T, kColNdim> col_iarray{col};
-    IndexableArray<T, kOutNdim> out_iarray{out};
-
-    // Indices over the output image.
-    NdimIndex out_image_index{kKernelNdim};
-
-    auto it_kernel = kernel_indexer.It(0);
-    auto it_in_image_dims = in_image_dims_indexer.It(0);
-    auto it_col = col_indexer.It(0);
-    auto it_out = out_indexer.It(0);
-
-    for (auto it_batch_channel = batch_channel_indexer.It(0); it_batch_channel; ++it_batch_channel) {
-        it_col.CopyIndex(it_batch_channel);
-        it_out.CopyIndex(it_batch_channel);
-
-        for (it_kernel.Restart(); it_kernel; ++it_kernel) {
-            it_col.CopyIndex(it_kernel, 2);
-
-            for (it_in_image_dims.Restart(); it_in_image_dims; ++it_in_image_dims) {
+    CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(pad.size()));
+    CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(dilate.size()));
+    CHAINERX_ASSERT(2 + 2 * kKernelNdim == col.ndim());
+    CHAINERX_ASSERT(2 + kKernelNdim == out.ndim());
+    CHAINERX_ASSERT(out.IsContiguous());
+
+    const Shape& col_shape = col.shape();
+    const Strides& col_strides = col.strides();
+    const Shape& out_shape = out.shape();
+    const Strides& out_strides = out.strides();
+    Dims kernel_size(col_shape.begin() + 2, col_shape.begin() + 2 + kKernelNdim);
+    Dims in_image_dims(col_shape.begin() + 2 + kKernelNdim, col_shape.end());
+    int64_t kernel_total_size = std::accumulate(kernel_size.begin(), kernel_size.end(), int64_t{1}, std::multiplies<>());
+    int64_t row_size = in_image_dims[kLast];
+    int64_t row_count = std::accumulate(in_image_dims.begin(), in_image_dims.begin() + kLast, int64_t{1}, std::multiplies<>());
+    int64_t last_out_dim = out_shape[2 + kLast];
+    int64_t last_stride = stride[kLast];
+    int64_t last_col_stride = col_strides[2 + 2 * kKernelNdim - 1];
+    bool contiguous_rows = last_stride == 1 && last_col_stride == static_cast<int64_t>(sizeof(T));
+
+    int64_t channels = out_shape[1];
+    int64_t plane_size = kernel_total_size * row_count * row_size;
+
+    const auto* col_data = static_cast<const uint8_t*>(internal::GetRawOffsetData(col));
+    auto* out_data = static_cast<uint8_t*>(internal::GetRawOffsetData(out));
+
+    ParallelFor(out_shape[0] * channels, im2col_detail::GetPlaneGrainSize(plane_size), [&](int64_t begin, int64_t end) {
+        for (int64_t plane = begin; plane < end; ++plane) {
+            int64_t batch = plane / channels;
+            int64_t channel = plane % channels;
+            uint8_t* out_plane = out_data + batch * out_strides[0] + channel * out_strides[1];
+
+            std::array<int64_t, kKernelNdim> kernel_index{};
+            for (int64_t k = 0; k < kernel_total_size; ++k, im2col_detail::IncrementIndex(kernel_index, kernel_size, kKernelNdim)) {
+                int64_t last_offset = kernel_index[kLast] * dilate[kLast] - pad[kLast];
+                std::array<int64_t, 2> inside = im2col_detail::GetInsideRange(last_out_dim, row_size, last_stride, last_offset);
+
+                const uint8_t* col_kernel = col_data + batch * col_strides[0] + channel * col_strides[1];
                 for (int8_t i = 0; i < kKernelNdim; ++i) {
-                    out_image_index.index()[i] = it_in_image_dims.index()[i] * stride[i] + it_kernel.index()[i];
+                    col_kernel += kernel_index[i] * col_strides[2 + i];
                 }
-                it_col.CopyIndex(it_in_image_dims, 2 + kKernelNdim);
-                it_out.CopyIndex(out_image_index, 2);
 
-                native_internal::StorageToDataType<T>(out_iarray[it_out]) +=
-                        native_internal::StorageToDataType<const T>(col_iarray[it_col]);
+                std::array<int64_t, kKernelNdim> in_index{};
+                for (int64_t row = 0; row < row_count; ++row, im2col_detail::IncrementIndex(in_index, in_image_dims, kLast)) {
+                    const uint8_t* col_row = col_kernel;
+                    uint8_t* out_row = out_plane;
+                    bool is_inside = true;
+                    for (int8_t i = 0; i < kLast; ++i) {
+                        int64_t out_index = in_index[i] * stride[i] + kernel_index[i] * dilate[i] - pad[i];
+                        if (out_index < 0 || out_index >= out_shape[2 + i]) {
+                            is_inside = false;
+                            break;
+                        }
+                        col_row += in_index[i] * col_strides[2 + kKernelNdim + i];
+                        out_row += out_index * out_strides[2 + i];
+                    }
+                    if (!is_inside) {
+                        continue;
+                    }
+
+                    auto* out_run = reinterpret_cast<T*>(out_row);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    if (contiguous_rows) {
+                        const auto* col_run = reinterpret_cast<const T*>(col_row);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                        for (int64_t o = inside[0]; o < inside[1]; ++o) {
+                            out_run[o + last_offset] += col_run[o];
+                        }
+                    } else {
+                        for (int64_t o = inside[0]; o < inside[1]; ++o) {
+                            const uint8_t* col_element = col_row + o * last_col_stride;
+                            out_run[o * last_stride + last_offset] +=
+                                    *reinterpret_cast<const T*>(col_element);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                        }
+                    }
+                }
             }
         }
-    }
+    });
 }
 
 }  // namespace
 
-Array Col2Im(const Array& col, const Dims& stride, const Dims& pad, const Dims& out_size) {
+Array Col2Im(const Array& col, const Dims& stride, const Dims& pad, const Dims& out_size, const absl::optional<Dims>& dilate) {
     int64_t batch_size = col.shape()[0];
     int64_t channels = col.shape()[1];
     auto ndim = static_cast<int8_t>(stride.size());
     CHAINERX_ASSERT(ndim * 2 + 2 == col.ndim());
+    Dims real_dilate = internal::GetDilateOrDefault(dilate, ndim);
 
-    Shape padded_shape{batch_size, channels};
-    for (int8_t i = 0; i < ndim; ++i) {
-        padded_shape.emplace_back(out_size[i] + 2 * pad[i] + stride[i] - 1);
+    Shape out_shape{batch_size, channels};
+    std::copy(out_size.begin(), out_size.end(), std::back_inserter(out_shape));
+    Array out = Zeros(out_shape, col.dtype(), col.device());
+    CHAINERX_ASSERT(ndim + 2 == out.ndim());
+
+    if (ndim == 0) {
+        col.device().backend().CallKernel<CopyKernel>(col, out);
+        return out;
     }
-    Array padded_out = Zeros(padded_shape, col.dtype(), col.device());
-    CHAINERX_ASSERT(ndim + 2 == padded_out.ndim());
 
     // Write to the output array
     VisitDtype(col.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
-        Indexer<2> batch_channel_indexer{Shape{batch_size, channels}};
 
         static_assert(4 * 2 + 2 == kMaxNdim, "4 is the maximum kernel ndim whose col ndim does not exceed kMaxNdim");
         switch (ndim) {
-            case 0:
-                Col2ImImpl<T, 0>(col, padded_out, stride, batch_channel_indexer);
-                break;
             case 1:
-                Col2ImImpl<T, 1>(col, padded_out, stride, batch_channel_indexer);
+                Col2ImImpl<T, 1>(col, out, stride, pad, real_dilate);
                 break;
             case 2:
-                Col2ImImpl<T, 2>(col, padded_out, stride, batch_channel_indexer);
+                Col2ImImpl<T, 2>(col, out, stride, pad, real_dilate);
                 break;
             case 3:
-                Col2ImImpl<T, 3>(col, padded_out, stride, batch_channel_indexer);
+                Col2ImImpl<T, 3>(col, out, stride, pad, real_dilate);
                 break;
             case 4:
-                Col2ImImpl<T, 4>(col, padded_out, stride, batch_channel_indexer);
+                Col2ImImpl<T, 4>(col, out, stride, pad, real_dilate);
                 break;
             default:
                 CHAINERX_NEVER_REACH();  // Never col.ndim() > kMaxNdim
@@ -113,11 +164,7 @@ Array Col2Im(const Array& col, const Dims& stride, const Dims& pad, const Dims&
         }
     });
 
-    std::vector<ArrayIndex> slice{ArrayIndex{Slice{}}, ArrayIndex{Slice{}}};  // All batch and channel dimensions.
-    for (int8_t i = 0; i < ndim; ++i) {
-        slice.emplace_back(Slice{pad[i], pad[i] + out_size[i]});
-    }
-    return padded_out.At(slice);
+    return out;
 }
 
 }  // namespace native_internal
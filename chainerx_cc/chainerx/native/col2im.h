@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <absl/types/optional.h>
+
 #include "chainerx/array.h"
 #include "chainerx/constant.h"
 #include "chainerx/dims.h"
@@ -10,7 +12,9 @@ namespace chainerx {
 namespace native {
 namespace native_internal {
 
-Array Col2Im(const Array& col, const Dims& stride, const Dims& pad, const Dims& out_size);
+// Accumulates the patches of col, which is of the shape returned by Im2Col, into an array of shape (batch_size, channel, out_size...).
+Array Col2Im(
+        const Array& col, const Dims& stride, const Dims& pad, const Dims& out_size, const absl::optional<Dims>& dilate = absl::nullopt);
 
 }  // namespace native_internal
 }  // namespace native
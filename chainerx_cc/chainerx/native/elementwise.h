@@ -9,6 +9,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/native/data_type.h"
+#include "chainerx/native/static_ndim.h"
 #include "chainerx/shape.h"
 #include "chainerx/squash_dims.h"
 
@@ -39,23 +40,13 @@ void Elementwise(Op&& op, const Arrays&... args) {
     const Shape& squashed = std::get<0>(squashed_result);
     const Axes& keep = std::get<1>(squashed_result);
 
-    // TODO(hvy): Reconsider the number of statically-optimized kernels in terms of speed and binary size trade-offs.
-    switch (squashed.ndim()) {
-        case 1:
-            elementwise_detail::LaunchElementwiseKernel<1, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
-            break;
-        case 2:
-            elementwise_detail::LaunchElementwiseKernel<2, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
-            break;
-        case 3:
-            elementwise_detail::LaunchElementwiseKernel<3, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
-            break;
-        case 4:
-            elementwise_detail::LaunchElementwiseKernel<4, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
-            break;
-        default:
-            elementwise_detail::LaunchElementwiseKernel<kDynamicNdim, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
-            break;
+    // Squashed shapes of ndim up to native_internal::kMaxStaticNdim (configurable at build time) get statically-optimized kernels.
+    // The remaining ones use the dynamic kernel, whose index iterator advances by carrying instead of dividing per element.
+    bool launched = native_internal::VisitStaticNdim<1, native_internal::kMaxStaticNdim>(squashed.ndim(), [&](auto ndim) {
+        elementwise_detail::LaunchElementwiseKernel<decltype(ndim)::value, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
+    });
+    if (!launched) {
+        elementwise_detail::LaunchElementwiseKernel<kDynamicNdim, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
     }
 }
 
@@ -1,24 +1,28 @@
 #include "chainerx/native/im2col.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
-#include <vector>
+#include <functional>
+#include <numeric>
+
+#include <absl/types/optional.h>
 
 #include "chainerx/array.h"
-#include "chainerx/array_index.h"
 #include "chainerx/backend.h"
+#include "chainerx/backend_util.h"
 #include "chainerx/constant.h"
 #include "chainerx/device.h"
 #include "chainerx/dims.h"
-#include "chainerx/indexable_array.h"
-#include "chainerx/indexer.h"
+#include "chainerx/dtype.h"
 #include "chainerx/kernels/creation.h"
 #include "chainerx/macro.h"
+#include "chainerx/native/parallel.h"
 #include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
-#include "chainerx/slice.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
@@ -26,84 +30,118 @@ namespace native_internal {
 
 namespace {
 
+// Writes the patches of x to the contiguous out.
+// Image indices in the padding, including the extra border of cover_all, are filled with pad_value, so that no padded copy of the input is
+// needed. Rows of out along the last patch dimension are copied as contiguous runs if the stride is 1 and x is contiguous along the last
+// axis. Each (batch, channel) plane is written to its own region of out, so that the planes are processed in parallel. Kernel element k along
+// an image dimension reads the image index o * stride + k * dilate - pad.
 template <typename T, int8_t kKernelNdim>
 void Im2ColImpl(
         const Array& x,
         const Array& out,
         const Dims& kernel_size,
         const Dims& stride,
+        const Dims& pad,
+        const Dims& dilate,
         const Dims& out_dims,
-        const Indexer<2>& batch_channel_indexer) {
-    static constexpr int8_t kInNdim = 2 + kKernelNdim;
-    static constexpr int8_t kOutNdim = 2 + 2 * kKernelNdim;
+        T pad_value) {
+    static_assert(kKernelNdim > 0, "Kernels of ndim 0 are copied.");
+    static constexpr int8_t kLast = kKernelNdim - 1;
 
     CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(kernel_size.size()));
     CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(stride.size()));
+    CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(pad.size()));
+    CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(dilate.size()));
     CHAINERX_ASSERT(kKernelNdim == static_cast<int8_t>(out_dims.size()));
-    CHAINERX_ASSERT(kInNdim == x.ndim());
-    CHAINERX_ASSERT(kOutNdim == out.ndim());
-
-    Indexer<kKernelNdim> kernel_indexer{Shape{kernel_size.begin(), kernel_size.end()}};
-    Indexer<kKernelNdim> out_dims_indexer{Shape{out_dims.begin(), out_dims.end()}};
-    Indexer<kInNdim> x_indexer{x.shape()};
-    Indexer<kOutNdim> out_indexer{out.shape()};
-    IndexableArray<const T, kInNdim> x_iarray{x};
-    IndexableArray<T, kOutNdim> out_iarray{out};
-
-    NdimIndex img_index{kKernelNdim};
-
-    auto it_kernel = kernel_indexer.It(0);
-    auto it_out_dims = out_dims_indexer.It(0);
-    auto it_x = x_indexer.It(0);
-    auto it_out = out_indexer.It(0);
-
-    for (auto it_batch_channel = batch_channel_indexer.It(0); it_batch_channel; ++it_batch_channel) {
-        it_x.CopyIndex(it_batch_channel);
-        it_out.CopyIndex(it_batch_channel);
-
-        for (it_kernel.Restart(); it_kernel; ++it_kernel) {
-            it_out.CopyIndex(it_kernel, 2);
-
-            for (it_out_dims.Restart(); it_out_dims; ++it_out_dims) {
-                for (int i = 0; i < kKernelNdim; ++i) {
-                    img_index.index()[i] = it_out_dims.index()[i] * stride[i] + it_kernel.index()[i];
+    CHAINERX_ASSERT(2 + kKernelNdim == x.ndim());
+    CHAINERX_ASSERT(2 + 2 * kKernelNdim == out.ndim());
+    CHAINERX_ASSERT(out.IsContiguous());
+
+    const Shape& x_shape = x.shape();
+    const Strides& x_strides = x.strides();
+    int64_t kernel_total_size = std::accumulate(kernel_size.begin(), kernel_size.end(), int64_t{1}, std::multiplies<>());
+    int64_t row_size = out_dims[kLast];
+    int64_t row_count = std::accumulate(out_dims.begin(), out_dims.begin() + kLast, int64_t{1}, std::multiplies<>());
+    int64_t last_in_dim = x_shape[2 + kLast];
+    int64_t last_stride = stride[kLast];
+    int64_t last_x_stride = x_strides[2 + kLast];
+    bool contiguous_rows = last_stride == 1 && last_x_stride == static_cast<int64_t>(sizeof(T));
+
+    int64_t channels = x_shape[1];
+    int64_t plane_size = kernel_total_size * row_count * row_size;
+
+    const auto* x_data = static_cast<const uint8_t*>(internal::GetRawOffsetData(x));
+    auto* out_data = static_cast<T*>(internal::GetRawOffsetData(out));
+
+    ParallelFor(x_shape[0] * channels, im2col_detail::GetPlaneGrainSize(plane_size), [&](int64_t begin, int64_t end) {
+        for (int64_t plane = begin; plane < end; ++plane) {
+            int64_t batch = plane / channels;
+            int64_t channel = plane % channels;
+            const uint8_t* x_plane = x_data + batch * x_strides[0] + channel * x_strides[1];
+            T* out_row = out_data + plane * plane_size;
+
+            std::array<int64_t, kKernelNdim> kernel_index{};
+            for (int64_t k = 0; k < kernel_total_size; ++k, im2col_detail::IncrementIndex(kernel_index, kernel_size, kKernelNdim)) {
+                int64_t last_offset = kernel_index[kLast] * dilate[kLast] - pad[kLast];
+                std::array<int64_t, 2> inside = im2col_detail::GetInsideRange(last_in_dim, row_size, last_stride, last_offset);
+
+                std::array<int64_t, kKernelNdim> out_index{};
+                for (int64_t row = 0; row < row_count; ++row, out_row += row_size) {
+                    const uint8_t* x_row = x_plane;
+                    bool is_inside = true;
+                    for (int8_t i = 0; i < kLast; ++i) {
+                        int64_t x_index = out_index[i] * stride[i] + kernel_index[i] * dilate[i] - pad[i];
+                        if (x_index < 0 || x_index >= x_shape[2 + i]) {
+                            is_inside = false;
+                            break;
+                        }
+                        x_row += x_index * x_strides[2 + i];
+                    }
+                    im2col_detail::IncrementIndex(out_index, out_dims, kLast);
+                    if (!is_inside) {
+                        std::fill_n(out_row, row_size, pad_value);
+                        continue;
+                    }
+
+                    std::fill(out_row, out_row + inside[0], pad_value);
+                    if (contiguous_rows) {
+                        const auto* x_row_data = reinterpret_cast<const T*>(x_row);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                        std::copy(x_row_data + inside[0] + last_offset, x_row_data + inside[1] + last_offset, out_row + inside[0]);
+                    } else {
+                        for (int64_t o = inside[0]; o < inside[1]; ++o) {
+                            const uint8_t* x_element = x_row + (o * last_stride + last_offset) * last_x_stride;
+                            out_row[o] = *reinterpret_cast<const T*>(x_element);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                        }
+                    }
+                    std::fill(out_row + inside[1], out_row + row_size, pad_value);
                 }
-                it_x.CopyIndex(img_index, 2);
-                it_out.CopyIndex(it_out_dims, 2 + kKernelNdim);
-
-                out_iarray[it_out] = x_iarray[it_x];
             }
         }
-    }
+    });
 }
 
 }  // namespace
 
-Array Im2Col(const Array& x, const Dims& kernel_size, const Dims& stride, const Dims& pad, bool cover_all, Scalar pad_value) {
+Array Im2Col(
+        const Array& x,
+        const Dims& kernel_size,
+        const Dims& stride,
+        const Dims& pad,
+        bool cover_all,
+        Scalar pad_value,
+        const absl::optional<Dims>& dilate) {
     auto ndim = static_cast<int8_t>(kernel_size.size());  // Number of input image dimensions.
     CHAINERX_ASSERT(ndim == static_cast<int8_t>(stride.size()));
     CHAINERX_ASSERT(ndim == static_cast<int8_t>(pad.size()));
+    Dims real_dilate = internal::GetDilateOrDefault(dilate, ndim);
     CHAINERX_ASSERT(ndim + 2 == x.ndim());  // Batch and channel dimensions.
 
     Device& device = x.device();
 
-    // Create a padded copy of the input image.
-    // TODO(hvy): Use the Pad function when implemented.
-    Shape padded_shape = x.shape();
-    std::vector<ArrayIndex> unpadded_slice{ArrayIndex{Slice{}}, ArrayIndex{Slice{}}};  // All batch and channel dimensions.
-    for (int64_t i = 0; i < ndim; ++i) {
-        padded_shape[i + 2] += pad[i] * 2 + (cover_all ? stride[i] - 1 : 0);  // Pad on both sides.
-        unpadded_slice.emplace_back(Slice{pad[i], pad[i] + x.shape()[i + 2]});
-    }
-    Array padded_x = static_cast<int64_t>(pad_value) == int64_t{0} ? Zeros(padded_shape, x.dtype(), device)
-                                                                   : Full(padded_shape, pad_value, x.dtype(), device);
-    device.backend().CallKernel<CopyKernel>(x, padded_x.At(unpadded_slice));
-    CHAINERX_ASSERT(ndim + 2 == padded_x.ndim());
-
     // Create the output array.
     Dims out_dims;  // Number of patches along each axis
     for (int8_t i = 0; i < ndim; ++i) {
-        out_dims.emplace_back(internal::GetConvOutDim(x.shape()[i + 2], kernel_size[i], stride[i], pad[i], cover_all));
+        out_dims.emplace_back(internal::GetConvOutDim(x.shape()[i + 2], kernel_size[i], stride[i], pad[i], cover_all, real_dilate[i]));
         CHAINERX_ASSERT(out_dims.back() > 0);
     }
     CHAINERX_ASSERT(ndim == static_cast<int8_t>(out_dims.size()));
@@ -117,27 +155,29 @@ Array Im2Col(const Array& x, const Dims& kernel_size, const Dims& stride, const
     Array out = Empty(out_shape, x.dtype(), device);
     CHAINERX_ASSERT(ndim * 2 + 2 == out.ndim());
 
+    if (ndim == 0) {
+        device.backend().CallKernel<CopyKernel>(x, out);
+        return out;
+    }
+
     // Write to the output array.
     VisitDtype(x.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
-        Indexer<2> batch_channel_indexer{Shape{batch_size, channels}};
+        auto value = static_cast<T>(pad_value);
 
         static_assert(4 * 2 + 2 == kMaxNdim, "4 is the maximum kernel ndim whose output ndim does not exceed kMaxNdim");
         switch (ndim) {
-            case 0:
-                Im2ColImpl<T, 0>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
-                break;
             case 1:
-                Im2ColImpl<T, 1>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                Im2ColImpl<T, 1>(x, out, kernel_size, stride, pad, real_dilate, out_dims, value);
                 break;
             case 2:
-                Im2ColImpl<T, 2>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                Im2ColImpl<T, 2>(x, out, kernel_size, stride, pad, real_dilate, out_dims, value);
                 break;
             case 3:
-                Im2ColImpl<T, 3>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                Im2ColImpl<T, 3>(x, out, kernel_size, stride, pad, real_dilate, out_dims, value);
                 break;
             case 4:
-                Im2ColImpl<T, 4>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                Im2ColImpl<T, 4>(x, out, kernel_size, stride, pad, real_dilate, out_dims, value);
                 break;
             default:
                 CHAINERX_NEVER_REACH();  // Never out.ndim() > kMaxNdim
@@ -1,18 +1,59 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
+#include <absl/types/optional.h>
+
 #include "chainerx/array.h"
 #include "chainerx/constant.h"
 #include "chainerx/dims.h"
+#include "chainerx/native/parallel.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
 namespace native {
 namespace native_internal {
 
-Array Im2Col(const Array& x, const Dims& kernel_size, const Dims& stride, const Dims& pad, bool cover_all, Scalar pad_value = 0);
+// Extracts the patches of x into an array of shape (batch_size, channel, k_1, ..., k_n, out_1, ..., out_n).
+// If dilate is given, kernel elements are dilate apart along each image dimension. Otherwise they are adjacent.
+Array Im2Col(
+        const Array& x,
+        const Dims& kernel_size,
+        const Dims& stride,
+        const Dims& pad,
+        bool cover_all,
+        Scalar pad_value = 0,
+        const absl::optional<Dims>& dilate = absl::nullopt);
+
+namespace im2col_detail {
+
+// Returns the minimum number of the (batch, channel) planes of the given number of col elements per chunk, which Im2Col and Col2Im
+// process in parallel.
+inline int64_t GetPlaneGrainSize(int64_t plane_size) { return std::max(int64_t{1}, kParallelGrainSize / std::max(int64_t{1}, plane_size)); }
+
+// Increments a row-major index over the first ndim dimensions of the shape, wrapping around to all zeros after the last index.
+template <size_t N>
+void IncrementIndex(std::array<int64_t, N>& index, const Dims& shape, int8_t ndim) {
+    for (int8_t i = ndim; --i >= 0;) {
+        if (++index[i] < shape[i]) {
+            return;
+        }
+        index[i] = 0;
+    }
+}
+
+// Returns the range [begin, end) of patch positions o along an image dimension of size in_dim for which the image index
+// o * stride + offset lies within the image, clamped to [0, out_dim). Positions outside the range fall in the padding.
+inline std::array<int64_t, 2> GetInsideRange(int64_t in_dim, int64_t out_dim, int64_t stride, int64_t offset) {
+    int64_t begin = std::min(out_dim, (std::max(-offset, int64_t{0}) + stride - 1) / stride);
+    int64_t end = std::max(begin, std::min(out_dim, (std::max(in_dim - offset, int64_t{0}) + stride - 1) / stride));
+    return {begin, end};
+}
 
+}  // namespace im2col_detail
 }  // namespace native_internal
 }  // namespace native
 }  // namespace chainerx
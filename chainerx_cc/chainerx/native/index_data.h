@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+#include "chainerx/array.h"
+#include "chainerx/backend_util.h"
+#include "chainerx/dtype.h"
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace native {
+namespace native_internal {
+
+// Returns the data of a contiguous int64 array of indices, e.g. the indices and the offsets of sparse matrices and embedding bags.
+inline const int64_t* GetIndexData(const Array& a) {
+    CHAINERX_ASSERT(a.dtype() == Dtype::kInt64);
+    CHAINERX_ASSERT(a.IsContiguous());
+    return static_cast<const int64_t*>(internal::GetRawOffsetData(a));
+}
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
@@ -25,16 +25,16 @@ namespace native {
 
 class NativeMaxPoolGradState : public MaxPoolGradState {
 public:
-    NativeMaxPoolGradState(Array x, Array col, Axes axes) : x_{std::move(x)}, col_{std::move(col)}, axes_{std::move(axes)} {}
+    NativeMaxPoolGradState(Array x, Array indices) : x_{std::move(x)}, indices_{std::move(indices)} {}
 
     const Array& x() const { return x_; }
-    const Array& col() const { return col_; }
-    const Axes& axes() const { return axes_; }
+
+    // Indices of the maxima within the flattened kernel windows, of the same shape as the output.
+    const Array& indices() const { return indices_; }
 
 private:
     Array x_{};
-    Array col_{};
-    Axes axes_{};
+    Array indices_{};
 };
 
 class NativeMaxPoolGradGradState : public MaxPoolGradGradState {
@@ -0,0 +1,201 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/kernels/activation.h"
+#include "chainerx/native/elementwise.h"
+#include "chainerx/native/kernel_regist.h"
+
+namespace chainerx {
+
+namespace internal {
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Gelu)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(GeluGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Silu)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(SiluGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Mish)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(MishGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(HardSwish)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(HardSwishGrad)
+}  // namespace internal
+
+namespace native {
+namespace {
+
+// Type in which the activations are computed. Float16 values are computed in float.
+template <typename T>
+using ComputeType = std::conditional_t<std::is_same<T, chainerx::Float16>{}, float, T>;
+
+using activation_detail::kGeluTanhCoeff;
+using activation_detail::kInvSqrt2;
+using activation_detail::kInvSqrt2Pi;
+using activation_detail::kSqrt2OverPi;
+
+template <typename U>
+U Sigmoid(U x) {
+    return U{1} / (U{1} + std::exp(-x));
+}
+
+template <typename U>
+U Softplus(U x) {
+    return std::max(x, U{0}) + std::log1p(std::exp(-std::abs(x)));
+}
+
+template <typename U>
+U Gelu(U x) {
+    return U{0.5} * x * (U{1} + std::erf(x * static_cast<U>(kInvSqrt2)));
+}
+
+template <typename U>
+U GeluGrad(U x) {
+    return U{0.5} * (U{1} + std::erf(x * static_cast<U>(kInvSqrt2))) + x * std::exp(U{-0.5} * x * x) * static_cast<U>(kInvSqrt2Pi);
+}
+
+template <typename U>
+U GeluTanh(U x) {
+    U t = std::tanh(static_cast<U>(kSqrt2OverPi) * (x + static_cast<U>(kGeluTanhCoeff) * x * x * x));
+    return U{0.5} * x * (U{1} + t);
+}
+
+template <typename U>
+U GeluTanhGrad(U x) {
+    U t = std::tanh(static_cast<U>(kSqrt2OverPi) * (x + static_cast<U>(kGeluTanhCoeff) * x * x * x));
+    U dinner = static_cast<U>(kSqrt2OverPi) * (U{1} + static_cast<U>(3 * kGeluTanhCoeff) * x * x);
+    return U{0.5} * (U{1} + t) + U{0.5} * x * (U{1} - t * t) * dinner;
+}
+
+template <typename U>
+U Silu(U x) {
+    return x * Sigmoid(x);
+}
+
+template <typename U>
+U SiluGrad(U x) {
+    U s = Sigmoid(x);
+    return s * (U{1} + x * (U{1} - s));
+}
+
+template <typename U>
+U Mish(U x) {
+    return x * std::tanh(Softplus(x));
+}
+
+template <typename U>
+U MishGrad(U x) {
+    U t = std::tanh(Softplus(x));
+    return t + x * Sigmoid(x) * (U{1} - t * t);
+}
+
+template <typename U>
+U HardSwish(U x) {
+    return x * std::min(std::max(x + U{3}, U{0}), U{6}) / U{6};
+}
+
+template <typename U>
+U HardSwishGrad(U x) {
+    if (x < U{-3}) {
+        return U{0};
+    }
+    if (x > U{3}) {
+        return U{1};
+    }
+    return (U{2} * x + U{3}) / U{6};
+}
+
+class NativeGeluKernel : public GeluKernel {
+public:
+    void Call(const Array& x, bool approximate, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ComputeType<T>;
+            if (approximate) {
+                struct Impl {
+                    void operator()(int64_t /*i*/, T x, T& out) { out = static_cast<T>(GeluTanh(static_cast<U>(x))); }
+                };
+                Elementwise<const T, T>(Impl{}, x_cast, out);
+            } else {
+                struct Impl {
+                    void operator()(int64_t /*i*/, T x, T& out) { out = static_cast<T>(Gelu(static_cast<U>(x))); }
+                };
+                Elementwise<const T, T>(Impl{}, x_cast, out);
+            }
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(GeluKernel, NativeGeluKernel);
+
+class NativeGeluGradKernel : public GeluGradKernel {
+public:
+    void Call(const Array& x, const Array& gout, bool approximate, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, gout, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        const Array& gout_cast = gout.dtype() == out.dtype() ? gout : gout.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ComputeType<T>;
+            if (approximate) {
+                struct Impl {
+                    void operator()(int64_t /*i*/, T x, T gout, T& out) {
+                        out = static_cast<T>(static_cast<U>(gout) * GeluTanhGrad(static_cast<U>(x)));
+                    }
+                };
+                Elementwise<const T, const T, T>(Impl{}, x_cast, gout_cast, out);
+            } else {
+                struct Impl {
+                    void operator()(int64_t /*i*/, T x, T gout, T& out) {
+                        out = static_cast<T>(static_cast<U>(gout) * GeluGrad(static_cast<U>(x)));
+                    }
+                };
+                Elementwise<const T, const T, T>(Impl{}, x_cast, gout_cast, out);
+            }
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(GeluGradKernel, NativeGeluGradKernel);
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(SiluKernel, {
+    using U = ComputeType<T>;
+    out = static_cast<T>(Silu(static_cast<U>(x)));
+});
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(SiluGradKernel, {
+    using U = ComputeType<T>;
+    out = static_cast<T>(static_cast<U>(x2) * SiluGrad(static_cast<U>(x1)));
+});
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(MishKernel, {
+    using U = ComputeType<T>;
+    out = static_cast<T>(Mish(static_cast<U>(x)));
+});
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(MishGradKernel, {
+    using U = ComputeType<T>;
+    out = static_cast<T>(static_cast<U>(x2) * MishGrad(static_cast<U>(x1)));
+});
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(HardSwishKernel, {
+    using U = ComputeType<T>;
+    out = static_cast<T>(HardSwish(static_cast<U>(x)));
+});
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(HardSwishGradKernel, {
+    using U = ComputeType<T>;
+    out = static_cast<T>(static_cast<U>(x2) * HardSwishGrad(static_cast<U>(x1)));
+});
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -46,6 +46,7 @@ public:
             const absl::optional<Array>& b,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             bool cover_all,
             Dtype out_dtype,
             const absl::optional<Array>& out) override {
@@ -61,7 +62,7 @@ public:
         std::copy_n(w.shape().begin() + 2, ndim, std::back_inserter(kernel_size));
 
         // Convert to colum representation of shape (batch_size, channel, k_1, k_2, ..., k_n, out_1, out_2, ..., out_n).
-        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, 0);
+        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, 0, dilate);
 
         // Compute the tensor dot product of col and w, reducing (channel, k_1, k_2, ..., k_n).
         Axes axes;
@@ -99,6 +100,7 @@ public:
             const Array& gy,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             bool cover_all,
             const absl::optional<Array>& out) override {
         CHAINERX_ASSERT(x.ndim() == w_shape.ndim());
@@ -114,7 +116,7 @@ public:
         Dims kernel_size{w_shape.begin() + 2, w_shape.end()};
 
         // Im2Col
-        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, 0);
+        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, 0, dilate);
 
         // TensorDot
         Axes out_axes{0};
@@ -137,6 +139,7 @@ public:
             const absl::optional<Array>& b,
             const Dims& stride,
             const Dims& pad,
+            const Dims& dilate,
             const Dims& out_size,
             Dtype out_dtype,
             const absl::optional<Array>& out) override {
@@ -148,7 +151,7 @@ public:
         Array col = TensorDot(w, x, {0}, {1}, out_dtype);  // shape: out_channel, k_1, ..., k_n, batch_size, out_1, ..., out_n
         col = RollAxis(col, x.ndim() - 1);  // batch axis is rolled to the top
 
-        Array actual_out = native_internal::Col2Im(col, stride, pad, out_size);  // shape: batch_size, out_channel, out_size...
+        Array actual_out = native_internal::Col2Im(col, stride, pad, out_size, dilate);  // shape: batch_size, out_channel, out_size...
 
         // Add bias, if given.
         if (b.has_value()) {
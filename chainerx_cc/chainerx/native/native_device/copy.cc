@@ -1,18 +1,31 @@
 #include "chainerx/native/native_device.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
+#include "chainerx/arithmetic_ops.h"
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/indexable_array.h"
+#include "chainerx/indexer.h"
 #include "chainerx/kernels/creation.h"
+#include "chainerx/kernels/manipulation.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 
 namespace internal {
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Copy)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Pack)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Unpack)
 }  // namespace internal
 
 namespace native {
@@ -36,6 +49,98 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(CopyKernel, NativeCopyKernel);
 
+// Returns the offsets of the arrays in the packed array, followed by the total size.
+std::vector<int64_t> GetPackedOffsets(const std::vector<Array>& arrays) {
+    std::vector<int64_t> offsets{0};
+    offsets.reserve(arrays.size() + 1);
+    for (const Array& a : arrays) {
+        offsets.emplace_back(offsets.back() + a.GetTotalSize());
+    }
+    return offsets;
+}
+
+// Calls func(k, begin, end) in parallel for the ranges [begin, end) of the elements of the arrays, in row-major order, which cover the
+// packed array.
+// A chunk of the packed array may span several arrays, so that a single parallel loop handles many small arrays as well as a large one.
+template <typename Func>
+void PackedParallelFor(const std::vector<int64_t>& offsets, Func&& func) {
+    ParallelFor(offsets.back(), kParallelGrainSize, [&offsets, &func](int64_t begin, int64_t end) {
+        auto k = static_cast<size_t>(std::upper_bound(offsets.begin(), offsets.end(), begin) - offsets.begin() - 1);
+        for (; k + 1 < offsets.size() && offsets[k] < end; ++k) {
+            func(k, std::max(begin, offsets[k]) - offsets[k], std::min(end, offsets[k + 1]) - offsets[k]);
+        }
+    });
+}
+
+class NativePackKernel : public PackKernel {
+public:
+    void Call(const std::vector<Array>& arrays, const Array& out) override {
+        CHAINERX_ASSERT(out.ndim() == 1);
+        CHAINERX_ASSERT(out.IsContiguous());
+        for (const Array& a : arrays) {
+            out.device().CheckDevicesCompatible(a, out);
+        }
+        std::vector<int64_t> offsets = GetPackedOffsets(arrays);
+        CHAINERX_ASSERT(offsets.back() == out.GetTotalSize());
+
+        PackedParallelFor(offsets, [&](size_t k, int64_t begin, int64_t end) {
+            const Array& a = arrays[k];
+            auto do_pack = [&](auto in_pt, auto out_pt) {
+                using InT = typename decltype(in_pt)::type;
+                using OutT = typename decltype(out_pt)::type;
+                IndexableArray<const InT> a_iarray{a};
+                IndexableArray<OutT, 1> out_iarray{out};
+                Indexer<> a_indexer{a.shape()};
+                auto it = a_indexer.It(begin);
+                for (int64_t i = begin; i < end; ++i, ++it) {
+                    int64_t out_i = offsets[k] + i;
+                    native_internal::StorageToDataType<OutT>(out_iarray[&out_i]) =
+                            static_cast<OutT>(native_internal::StorageToDataType<const InT>(a_iarray[it]));
+                }
+            };
+            VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_pack, out_pt); });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(PackKernel, NativePackKernel);
+
+class NativeUnpackKernel : public UnpackKernel {
+public:
+    void Call(const Array& a, Scalar scale, const std::vector<Array>& outs) override {
+        CHAINERX_ASSERT(a.ndim() == 1);
+        CHAINERX_ASSERT(a.IsContiguous());
+        for (const Array& out : outs) {
+            a.device().CheckDevicesCompatible(a, out);
+        }
+        std::vector<int64_t> offsets = GetPackedOffsets(outs);
+        CHAINERX_ASSERT(offsets.back() == a.GetTotalSize());
+
+        PackedParallelFor(offsets, [&](size_t k, int64_t begin, int64_t end) {
+            const Array& out = outs[k];
+            auto do_unpack = [&](auto in_pt, auto out_pt) {
+                using InT = typename decltype(in_pt)::type;
+                using OutT = typename decltype(out_pt)::type;
+                using ComputeT = manipulation_detail::UnpackComputeType<InT, OutT>;
+                auto compute_scale = static_cast<ComputeT>(scale);
+                IndexableArray<const InT, 1> a_iarray{a};
+                IndexableArray<OutT> out_iarray{out};
+                Indexer<> out_indexer{out.shape()};
+                auto it = out_indexer.It(begin);
+                for (int64_t i = begin; i < end; ++i, ++it) {
+                    int64_t a_i = offsets[k] + i;
+                    auto value = static_cast<ComputeT>(native_internal::StorageToDataType<const InT>(a_iarray[&a_i]));
+                    native_internal::StorageToDataType<OutT>(out_iarray[it]) =
+                            static_cast<OutT>(ArithmeticOps<ComputeT>::Multiply(value, compute_scale));
+                }
+            };
+            VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_unpack, out_pt); });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(UnpackKernel, NativeUnpackKernel);
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
@@ -19,6 +19,7 @@
 #include "chainerx/native/data_type.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/packed_weight_cache.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/shape.h"
 
@@ -55,17 +56,11 @@ struct GemmInputLayout {
     // Configure leading dimension and transposition accordingly, and makes the array C contiguous if necessary
     Array Configure(const Array& a) {
         CHAINERX_ASSERT(a.ndim() == 2);
-        // Row-major
-        // Note that this condition is slightly relaxed than Array::IsContiguous() which requires
-        // a.strides()[0] == a.GetItemSize() * a.shape()[1]
-        if (a.strides()[1] == a.GetItemSize() && a.strides()[0] / a.GetItemSize() >= a.shape()[1] &&
-            a.strides()[0] % a.GetItemSize() == 0) {
+        if (IsRowMajor(a)) {
             ld = a.strides()[0] / a.GetItemSize();
             return a;
         }
-        // Column-major
-        if (a.strides()[0] == a.GetItemSize() && a.strides()[1] / a.GetItemSize() >= a.shape()[0] &&
-            a.strides()[1] % a.GetItemSize() == 0) {
+        if (IsColumnMajor(a)) {
             ld = a.strides()[1] / a.GetItemSize();
             trans = CblasTrans;
             return a;
@@ -74,8 +69,34 @@ struct GemmInputLayout {
         ld = a.shape()[1];
         return AsContiguous(a);
     }
+
+    // Note that this condition is slightly relaxed than Array::IsContiguous() which requires
+    // a.strides()[0] == a.GetItemSize() * a.shape()[1]
+    static bool IsRowMajor(const Array& a) {
+        return a.strides()[1] == a.GetItemSize() && a.strides()[0] / a.GetItemSize() >= a.shape()[1] &&
+               a.strides()[0] % a.GetItemSize() == 0;
+    }
+
+    static bool IsColumnMajor(const Array& a) {
+        return a.strides()[0] == a.GetItemSize() && a.strides()[1] / a.GetItemSize() >= a.shape()[0] &&
+               a.strides()[1] % a.GetItemSize() == 0;
+    }
 };
 
+// Returns the second operand cast to dtype in a layout which Gemm consumes without copying.
+// The second operand is the weight in Linear, Conv and the RNNs, so the conversion is cached while a PackedWeightCacheScope is active.
+// An operand already of dtype in such a layout needs no conversion and is returned as it is, without going through the cache.
+Array PackGemmWeight(const Array& b, Dtype dtype) {
+    CHAINERX_ASSERT(b.ndim() == 2);
+    if (b.dtype() == dtype && (GemmInputLayout::IsRowMajor(b) || GemmInputLayout::IsColumnMajor(b))) {
+        return b;
+    }
+    return native_internal::PackWeight(b, dtype, [dtype](const Array& w) {
+        Array w_cast = w.AsType(dtype, false);
+        return GemmInputLayout::IsRowMajor(w_cast) || GemmInputLayout::IsColumnMajor(w_cast) ? w_cast : AsContiguous(w_cast);
+    });
+}
+
 void Gemm(const Array& a, const Array& b, const Array& out) {
     CHAINERX_ASSERT(a.ndim() == 2);
     CHAINERX_ASSERT(b.ndim() == 2);
@@ -158,13 +179,13 @@ public:
 
 #ifdef CHAINERX_ENABLE_BLAS
         if (out.dtype() == Dtype::kFloat32 || out.dtype() == Dtype::kFloat64) {
-            Gemm(a.dtype() == out.dtype() ? a : a.AsType(out.dtype()), b.dtype() == out.dtype() ? b : b.AsType(out.dtype()), out);
+            Gemm(a.dtype() == out.dtype() ? a : a.AsType(out.dtype()), PackGemmWeight(b, out.dtype()), out);
             return;
         }
 
         if (out.dtype() == Dtype::kFloat16) {
             Array a32 = a.AsType(Dtype::kFloat32, false);
-            Array b32 = b.AsType(Dtype::kFloat32, false);
+            Array b32 = PackGemmWeight(b, Dtype::kFloat32);
             Array acc = out.AsType(Dtype::kFloat32);
             Gemm(a32, b32, acc);
 
@@ -176,7 +197,9 @@ public:
 #endif  // CHAINERX_ENABLE_BLAS
 
         const Array& a_cast = a.dtype() == out.dtype() ? a : a.AsType(out.dtype());
-        const Array& b_cast = b.dtype() == out.dtype() ? b : b.AsType(out.dtype());
+        const Array& b_cast = b.dtype() == out.dtype()
+                ? b
+                : native_internal::PackWeight(b, out.dtype(), [dtype = out.dtype()](const Array& w) { return w.AsType(dtype); });
 
         out.Fill(0);
         VisitDtype(out.dtype(), [&](auto pt) {
@@ -1,17 +1,31 @@
 #include "chainerx/native/native_device.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <absl/types/optional.h>
 
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/float16.h"
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/kernels/indexing.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/native/data_type.h"
+#include "chainerx/native/index_data.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+#include "chainerx/numeric.h"
 #include "chainerx/routines/indexing.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -19,10 +33,20 @@ namespace chainerx {
 namespace internal {
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(AddAt)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Take)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(EmbeddingBag)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(EmbeddingBagGrad)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Where)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereAAS)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereASA)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereASS)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareAAAA)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareAAAS)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareAASA)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareAASS)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareASAA)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareASAS)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareASSA)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(WhereCompareASSS)
 }  // namespace internal
 
 namespace native {
@@ -281,6 +305,333 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(WhereASSKernel, NativeWhereASSKernel);
 
+class NativeWhereCompareAAAAKernel : public WhereCompareAAAAKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, const Array& x, const Array& y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, b, x, y, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T b, T x, T y, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+            };
+            Elementwise<const T, const T, const T, const T, T>(Impl{op}, a, b, x, y, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareAAAAKernel, NativeWhereCompareAAAAKernel);
+
+class NativeWhereCompareAAASKernel : public WhereCompareAAASKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, const Array& x, Scalar y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, b, x, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T b, T x, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+                T y;
+            };
+            Elementwise<const T, const T, const T, T>(Impl{op, static_cast<T>(y)}, a, b, x, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareAAASKernel, NativeWhereCompareAAASKernel);
+
+class NativeWhereCompareAASAKernel : public WhereCompareAASAKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, Scalar x, const Array& y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, b, y, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T b, T y, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+                T x;
+            };
+            Elementwise<const T, const T, const T, T>(Impl{op, static_cast<T>(x)}, a, b, y, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareAASAKernel, NativeWhereCompareAASAKernel);
+
+class NativeWhereCompareAASSKernel : public WhereCompareAASSKernel {
+public:
+    void Call(CompareOp op, const Array& a, const Array& b, Scalar x, Scalar y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, b, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T b, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+                T x;
+                T y;
+            };
+            Elementwise<const T, const T, T>(Impl{op, static_cast<T>(x), static_cast<T>(y)}, a, b, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareAASSKernel, NativeWhereCompareAASSKernel);
+
+class NativeWhereCompareASAAKernel : public WhereCompareASAAKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, const Array& x, const Array& y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, x, y, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T x, T y, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+                T b;
+            };
+            Elementwise<const T, const T, const T, T>(Impl{op, static_cast<T>(b)}, a, x, y, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareASAAKernel, NativeWhereCompareASAAKernel);
+
+class NativeWhereCompareASASKernel : public WhereCompareASASKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, const Array& x, Scalar y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, x, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T x, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+                T b;
+                T y;
+            };
+            Elementwise<const T, const T, T>(Impl{op, static_cast<T>(b), static_cast<T>(y)}, a, x, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareASASKernel, NativeWhereCompareASASKernel);
+
+class NativeWhereCompareASSAKernel : public WhereCompareASSAKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, Scalar x, const Array& y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, y, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T y, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+                T b;
+                T x;
+            };
+            Elementwise<const T, const T, T>(Impl{op, static_cast<T>(b), static_cast<T>(x)}, a, y, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareASSAKernel, NativeWhereCompareASSAKernel);
+
+class NativeWhereCompareASSSKernel : public WhereCompareASSSKernel {
+public:
+    void Call(CompareOp op, const Array& a, Scalar b, Scalar x, Scalar y, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, out);
+        VisitDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, T a, T& out) { out = ApplyCompareOp(op, a, b) ? x : y; }
+                CompareOp op;
+                T b;
+                T x;
+                T y;
+            };
+            Elementwise<const T, T>(Impl{op, static_cast<T>(b), static_cast<T>(x), static_cast<T>(y)}, a, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(WhereCompareASSSKernel, NativeWhereCompareASSSKernel);
+
+// Returns the position in indices where the bag ends.
+int64_t GetBagEnd(const int64_t* offsets, int64_t bag_count, int64_t index_count, int64_t bag) {
+    return bag + 1 < bag_count ? offsets[bag + 1] : index_count;
+}
+
+class NativeEmbeddingBagKernel : public EmbeddingBagKernel {
+public:
+    void Call(
+            const Array& table,
+            const Array& indices,
+            const Array& offsets,
+            const absl::optional<Array>& weights,
+            SegmentReduction reduction,
+            const Array& out,
+            const absl::optional<Array>& out_arg) override {
+        table.device().CheckDevicesCompatible(table, indices, offsets, out);
+        CHAINERX_ASSERT(table.dtype() == out.dtype());
+        CHAINERX_ASSERT(table.ndim() == 2);
+        CHAINERX_ASSERT(out.ndim() == 2);
+        CHAINERX_ASSERT(table.shape()[1] == out.shape()[1]);
+        CHAINERX_ASSERT(offsets.GetTotalSize() == out.shape()[0]);
+        CHAINERX_ASSERT(!weights.has_value() || (reduction == SegmentReduction::kSum && weights->dtype() == table.dtype()));
+        CHAINERX_ASSERT((reduction == SegmentReduction::kSum) != out_arg.has_value());
+
+        int64_t bag_count = out.shape()[0];
+        int64_t dim = out.shape()[1];
+        int64_t index_count = indices.GetTotalSize();
+        const int64_t* indices_data = native_internal::GetIndexData(indices);
+        const int64_t* offsets_data = native_internal::GetIndexData(offsets);
+        int64_t* arg_data = out_arg.has_value() ? const_cast<int64_t*>(native_internal::GetIndexData(*out_arg)) : nullptr;  // NOLINT
+        int64_t bag_grain_size = std::max(int64_t{1}, kParallelGrainSize * bag_count / std::max(int64_t{1}, index_count * dim));
+
+        VisitNumericDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 2> table_iarray{table};
+            IndexableArray<T, 2> out_iarray{out};
+            absl::optional<IndexableArray<const T, 1>> weights_iarray{};
+            if (weights.has_value()) {
+                weights_iarray.emplace(*weights);
+            }
+            auto load_weight = [&weights_iarray](int64_t p) {
+                return weights_iarray.has_value() ? static_cast<AccT>(native_internal::StorageToDataType<const T>((*weights_iarray)[&p]))
+                                                  : AccT{1};
+            };
+
+            // The rows of each bag are accumulated on a single thread.
+            ParallelFor(bag_count, bag_grain_size, [&](int64_t begin, int64_t end) {
+                std::vector<AccT> accum(dim);
+                for (int64_t bag = begin; bag < end; ++bag) {
+                    int64_t bag_begin = offsets_data[bag];
+                    int64_t bag_end = GetBagEnd(offsets_data, bag_count, index_count, bag);
+                    int64_t* arg_row = arg_data == nullptr ? nullptr : arg_data + bag * dim;
+                    std::fill(accum.begin(), accum.end(), AccT{0});
+                    if (arg_row != nullptr) {
+                        std::fill(arg_row, arg_row + dim, int64_t{-1});
+                    }
+                    for (int64_t p = bag_begin; p < bag_end; ++p) {
+                        int64_t table_index[] = {indices_data[p], 0};
+                        if (reduction == SegmentReduction::kSum) {
+                            AccT weight = load_weight(p);
+                            for (int64_t& j = table_index[1]; j < dim; ++j) {
+                                auto value = static_cast<AccT>(native_internal::StorageToDataType<const T>(table_iarray[table_index]));
+                                accum[j] += weight * value;
+                            }
+                            continue;
+                        }
+                        // Maxima and minima are taken from the first of the equal rows, and NaNs are propagated.
+                        bool is_max = reduction == SegmentReduction::kMax;
+                        for (int64_t& j = table_index[1]; j < dim; ++j) {
+                            auto value = static_cast<AccT>(native_internal::StorageToDataType<const T>(table_iarray[table_index]));
+                            bool is_better = IsNan(value) || (is_max ? value > accum[j] : value < accum[j]);
+                            if (p == bag_begin || (!IsNan(accum[j]) && is_better)) {
+                                accum[j] = value;
+                                arg_row[j] = table_index[0];
+                            }
+                        }
+                    }
+                    int64_t out_index[] = {bag, 0};
+                    for (int64_t& j = out_index[1]; j < dim; ++j) {
+                        native_internal::StorageToDataType<T>(out_iarray[out_index]) = static_cast<T>(accum[j]);
+                    }
+                }
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(EmbeddingBagKernel, NativeEmbeddingBagKernel);
+
+class NativeEmbeddingBagGradKernel : public EmbeddingBagGradKernel {
+public:
+    void Call(const Array& gout, const Array& indices, const Array& offsets, const absl::optional<Array>& weights, const Array& out)
+            override {
+        gout.device().CheckDevicesCompatible(gout, indices, offsets, out);
+        CHAINERX_ASSERT(gout.dtype() == out.dtype());
+        CHAINERX_ASSERT(gout.ndim() == 2);
+        CHAINERX_ASSERT(out.ndim() == 2);
+        CHAINERX_ASSERT(gout.shape()[1] == out.shape()[1]);
+        CHAINERX_ASSERT(offsets.GetTotalSize() == gout.shape()[0]);
+        CHAINERX_ASSERT(!weights.has_value() || weights->dtype() == out.dtype());
+
+        int64_t bag_count = gout.shape()[0];
+        int64_t dim = gout.shape()[1];
+        int64_t row_count = out.shape()[0];
+        int64_t index_count = indices.GetTotalSize();
+        const int64_t* indices_data = native_internal::GetIndexData(indices);
+        const int64_t* offsets_data = native_internal::GetIndexData(offsets);
+        int64_t row_grain_size = std::max(int64_t{1}, kParallelGrainSize * row_count / std::max(int64_t{1}, index_count * dim));
+
+        // Bucket the positions in indices by the row of out which they scatter to, keeping their order within each row.
+        std::vector<int64_t> position_bags(index_count);
+        for (int64_t bag = 0; bag < bag_count; ++bag) {
+            std::fill(
+                    position_bags.begin() + offsets_data[bag],
+                    position_bags.begin() + GetBagEnd(offsets_data, bag_count, index_count, bag),
+                    bag);
+        }
+        std::vector<int64_t> row_offsets(row_count + 1);
+        for (int64_t p = 0; p < index_count; ++p) {
+            ++row_offsets[indices_data[p] + 1];
+        }
+        std::partial_sum(row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+        std::vector<int64_t> row_positions(index_count);
+        {
+            std::vector<int64_t> row_ends(row_offsets.begin(), row_offsets.end() - 1);
+            for (int64_t p = 0; p < index_count; ++p) {
+                row_positions[row_ends[indices_data[p]]++] = p;
+            }
+        }
+
+        VisitNumericDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 2> gout_iarray{gout};
+            IndexableArray<T, 2> out_iarray{out};
+            absl::optional<IndexableArray<const T, 1>> weights_iarray{};
+            if (weights.has_value()) {
+                weights_iarray.emplace(*weights);
+            }
+            auto load_weight = [&weights_iarray](int64_t p) {
+                return weights_iarray.has_value() ? static_cast<AccT>(native_internal::StorageToDataType<const T>((*weights_iarray)[&p]))
+                                                  : AccT{1};
+            };
+
+            // Each row of out is accumulated on a single thread from the rows of gout which scatter to it.
+            ParallelFor(row_count, row_grain_size, [&](int64_t begin, int64_t end) {
+                std::vector<AccT> accum(dim);
+                for (int64_t row = begin; row < end; ++row) {
+                    if (row_offsets[row] == row_offsets[row + 1]) {
+                        continue;
+                    }
+                    int64_t out_index[] = {row, 0};
+                    for (int64_t j = 0; j < dim; ++j) {
+                        out_index[1] = j;
+                        accum[j] = static_cast<AccT>(native_internal::StorageToDataType<T>(out_iarray[out_index]));
+                    }
+                    for (int64_t q = row_offsets[row]; q < row_offsets[row + 1]; ++q) {
+                        int64_t p = row_positions[q];
+                        AccT weight = load_weight(p);
+                        int64_t gout_index[] = {position_bags[p], 0};
+                        for (int64_t& j = gout_index[1]; j < dim; ++j) {
+                            accum[j] += weight * static_cast<AccT>(native_internal::StorageToDataType<const T>(gout_iarray[gout_index]));
+                        }
+                    }
+                    for (int64_t j = 0; j < dim; ++j) {
+                        out_index[1] = j;
+                        native_internal::StorageToDataType<T>(out_iarray[out_index]) = static_cast<T>(accum[j]);
+                    }
+                }
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(EmbeddingBagGradKernel, NativeEmbeddingBagGradKernel);
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
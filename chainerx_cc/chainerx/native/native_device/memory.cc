@@ -5,17 +5,32 @@
 #include <cstring>
 #include <memory>
 
+#include "chainerx/allocation_tracking.h"
+#include "chainerx/data_version.h"
 #include "chainerx/device.h"
 #include "chainerx/macro.h"
 
 namespace chainerx {
 namespace native {
+namespace {
+
+void DeleteBuffer(void* ptr) { delete[] static_cast<uint8_t*>(ptr); }
+
+}  // namespace
 
 std::shared_ptr<void> NativeDevice::Allocate(size_t bytesize) {
     if (bytesize == 0) {
         return std::shared_ptr<void>{nullptr};
     }
-    return std::shared_ptr<uint8_t>{new uint8_t[bytesize], std::default_delete<uint8_t[]>()};
+    internal::RecordAllocation(bytesize);
+
+    // Buffers carry their data versions in the deleters. Small buffers, which are common for scalars and small tensors, are placed in the
+    // storage of the deleter to take a single allocation instead of separate ones for the buffer and the control block.
+    if (bytesize <= internal::DataVersionDeleter::kInlineStorageSize) {
+        std::shared_ptr<void> holder{nullptr, internal::DataVersionDeleter{}};
+        return std::shared_ptr<void>{holder, std::get_deleter<internal::DataVersionDeleter>(holder)->inline_storage()};
+    }
+    return std::shared_ptr<void>{new uint8_t[bytesize], internal::DataVersionDeleter{&DeleteBuffer}};
 }
 
 void NativeDevice::MemoryCopyFrom(void* dst, const void* src, size_t bytesize, Device& src_device) {
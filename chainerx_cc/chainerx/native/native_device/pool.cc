@@ -18,6 +18,7 @@
 #include "chainerx/kernels/indexing.h"
 #include "chainerx/kernels/pooling.h"
 #include "chainerx/kernels/reduction.h"
+#include "chainerx/kernels/sorting.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/col2im.h"
 #include "chainerx/native/elementwise.h"
@@ -84,10 +85,17 @@ public:
         axes.resize(kernel_size.size());
         std::iota(axes.begin(), axes.end(), 2);
 
-        Array actual_out = col.Max(axes);
+        if (!return_state) {
+            return std::make_tuple(col.Max(axes), nullptr);
+        }
+
+        // Record the indices of the maxima in the same pass so that the backward does not have to scan the columns again.
+        Shape out_shape = internal::ReduceShape(col.shape(), axes, false);
+        Array actual_out = Empty(out_shape, x.dtype(), x.device());
+        Array indices = Empty(out_shape, Dtype::kInt64, x.device());
+        x.device().backend().CallKernel<MaxAndArgMaxKernel>(col, axes, actual_out, indices);
 
-        std::unique_ptr<MaxPoolGradState> state =
-                return_state ? std::make_unique<NativeMaxPoolGradState>(x, std::move(col), std::move(axes)) : nullptr;
+        std::unique_ptr<MaxPoolGradState> state = std::make_unique<NativeMaxPoolGradState>(x, std::move(indices));
 
         return std::make_tuple(std::move(actual_out), std::move(state));
     }
@@ -116,10 +124,7 @@ public:
         CHAINERX_ASSERT(state != nullptr);
         NativeMaxPoolGradState& native_state = dynamic_cast<NativeMaxPoolGradState&>(*state);
         const Array& x = native_state.x();
-        const Array& col = native_state.col();
-        const Axes& axes = native_state.axes();
-
-        Array indices = col.ArgMax(axes);
+        const Array& indices = native_state.indices();
         CHAINERX_ASSERT(indices.shape() == gout.shape());
 
         // Compute flattened col gradients.
@@ -144,7 +149,7 @@ public:
                 {x.shape().begin() + 2, x.shape().end()});
 
         std::unique_ptr<MaxPoolGradGradState> grad_grad_state =
-                return_state ? std::make_unique<NativeMaxPoolGradGradState>(std::move(indices), std::move(offset), x.dtype()) : nullptr;
+                return_state ? std::make_unique<NativeMaxPoolGradGradState>(indices, std::move(offset), x.dtype()) : nullptr;
 
         return std::make_tuple(std::move(actual_gx), std::move(grad_grad_state));
     }
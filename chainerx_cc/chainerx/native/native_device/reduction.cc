@@ -1,16 +1,24 @@
 #include "chainerx/native/native_device.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <type_traits>
+#include <vector>
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
+#include "chainerx/backend_util.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/indexable_array.h"
 #include "chainerx/kernels/reduction.h"
 #include "chainerx/kernels/sorting.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/data_type.h"
+#include "chainerx/native/index_data.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
 #include "chainerx/native/reduce.h"
 #include "chainerx/numeric.h"
 #include "chainerx/numeric_limits.h"
@@ -21,11 +29,14 @@ namespace chainerx {
 namespace internal {
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ArgMax)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ArgMin)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(MaxAndArgMax)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(MinAndArgMin)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(NanArgMax)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(NanArgMin)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Sum)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Cumsum)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Nansum)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(SegmentReduce)
 }  // namespace internal
 
 namespace native {
@@ -93,6 +104,72 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(ArgMinKernel, NativeArgMinKernel);
 
+// Reduction of a value and its index, where kMax selects the maximum or the minimum.
+// NaN precedes any other value and ties are broken by the smaller index, so that the result does not depend on the order of reduction.
+template <typename T, bool kMax>
+struct ExtremumAndIndexImpl {
+    struct ExtremumAndIndex {
+        T value;
+        int64_t index;
+    };
+
+    ExtremumAndIndex Identity() { return {T{}, -1}; }
+    ExtremumAndIndex MapIn(T in, int64_t index) { return {in, index}; }
+    void Reduce(ExtremumAndIndex next, ExtremumAndIndex& accum) {
+        if (accum.index < 0 || (next.index >= 0 && Precedes(next, accum))) {
+            accum = next;
+        }
+    }
+    T MapOut(ExtremumAndIndex accum) { return accum.value; }
+    int64_t MapOut2(ExtremumAndIndex accum) { return accum.index; }
+
+    static bool Precedes(ExtremumAndIndex a, ExtremumAndIndex b) {
+        bool a_is_nan = chainerx::IsNan(a.value);
+        bool b_is_nan = chainerx::IsNan(b.value);
+        if (a_is_nan || b_is_nan) {
+            return a_is_nan && (!b_is_nan || a.index < b.index);
+        }
+        if (a.value == b.value) {
+            return a.index < b.index;
+        }
+        return kMax ? b.value < a.value : a.value < b.value;
+    }
+};
+
+class NativeMaxAndArgMaxKernel : public MaxAndArgMaxKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& out_max, const Array& out_argmax) override {
+        CHAINERX_ASSERT(std::all_of(axis.begin(), axis.end(), [&a](int8_t i) { return a.shape()[i] > 0; }));
+        CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out_max.shape(), false));
+        CHAINERX_ASSERT(out_argmax.dtype() == Dtype::kInt64);
+        a.device().CheckDevicesCompatible(a, out_max, out_argmax);
+
+        VisitDtype(a.dtype(), [&a, &axis, &out_max, &out_argmax](auto pt) {
+            using T = typename decltype(pt)::type;
+            Reduce<T, T, int64_t>(a, axis, out_max, out_argmax, ExtremumAndIndexImpl<T, true>{});
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(MaxAndArgMaxKernel, NativeMaxAndArgMaxKernel);
+
+class NativeMinAndArgMinKernel : public MinAndArgMinKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& out_min, const Array& out_argmin) override {
+        CHAINERX_ASSERT(std::all_of(axis.begin(), axis.end(), [&a](int8_t i) { return a.shape()[i] > 0; }));
+        CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out_min.shape(), false));
+        CHAINERX_ASSERT(out_argmin.dtype() == Dtype::kInt64);
+        a.device().CheckDevicesCompatible(a, out_min, out_argmin);
+
+        VisitDtype(a.dtype(), [&a, &axis, &out_min, &out_argmin](auto pt) {
+            using T = typename decltype(pt)::type;
+            Reduce<T, T, int64_t>(a, axis, out_min, out_argmin, ExtremumAndIndexImpl<T, false>{});
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(MinAndArgMinKernel, NativeMinAndArgMinKernel);
+
 class NativeSumKernel : public SumKernel {
 public:
     void Call(const Array& a, const Axes& axis, const Array& out) override {
@@ -230,6 +307,170 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(NanArgMinKernel, NativeNanArgMinKernel);
 
+// Reduces next into accum, propagating NaNs in maxima and minima.
+template <typename AccT>
+void ReduceSegmentValue(SegmentReduction reduction, AccT next, AccT& accum) {
+    switch (reduction) {
+        case SegmentReduction::kSum:
+            accum += next;
+            break;
+        case SegmentReduction::kMax:
+            if (IsNan(next) || next > accum) {
+                accum = next;
+            }
+            break;
+        case SegmentReduction::kMin:
+            if (IsNan(next) || next < accum) {
+                accum = next;
+            }
+            break;
+        default:
+            CHAINERX_NEVER_REACH();
+    }
+}
+
+class NativeSegmentReduceKernel : public SegmentReduceKernel {
+public:
+    void Call(
+            const Array& data,
+            const Array& segment_ids,
+            SegmentReduction reduction,
+            bool sorted,
+            bool include_out,
+            const Array& out,
+            const Array& counts) override {
+        data.device().CheckDevicesCompatible(data, segment_ids, out, counts);
+        CHAINERX_ASSERT(reduction != SegmentReduction::kMean);
+        CHAINERX_ASSERT(data.dtype() == out.dtype());
+        CHAINERX_ASSERT(data.ndim() == 2);
+        CHAINERX_ASSERT(out.ndim() == 2);
+        CHAINERX_ASSERT(data.shape()[1] == out.shape()[1]);
+        CHAINERX_ASSERT(segment_ids.dtype() == Dtype::kInt64 && segment_ids.IsContiguous());
+        CHAINERX_ASSERT(counts.dtype() == Dtype::kInt64 && counts.IsContiguous());
+        CHAINERX_ASSERT(segment_ids.GetTotalSize() == data.shape()[0]);
+        CHAINERX_ASSERT(counts.GetTotalSize() == out.shape()[0]);
+
+        int64_t n = data.shape()[0];
+        int64_t num_segments = out.shape()[0];
+        int64_t inner_size = data.shape()[1];
+        const int64_t* ids = native_internal::GetIndexData(segment_ids);
+        auto* counts_data = static_cast<int64_t*>(internal::GetRawOffsetData(counts));
+        int64_t row_grain_size = std::max(int64_t{1}, kParallelGrainSize / std::max(int64_t{1}, inner_size));
+
+        VisitNumericDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 2> data_iarray{data};
+            IndexableArray<T, 2> out_iarray{out};
+            auto load_data = [&data_iarray](int64_t i, int64_t j) {
+                int64_t index[] = {i, j};
+                return static_cast<AccT>(native_internal::StorageToDataType<const T>(data_iarray[index]));
+            };
+            auto out_at = [&out_iarray](int64_t i, int64_t j) -> decltype(auto) {
+                int64_t index[] = {i, j};
+                return native_internal::StorageToDataType<T>(out_iarray[index]);
+            };
+
+            if (sorted) {
+                // Each chunk of rows is extended to whole segments, so that each segment is reduced on a single thread.
+                ParallelFor(n, row_grain_size, [&](int64_t begin, int64_t end) {
+                    while (begin > 0 && begin < n && ids[begin] == ids[begin - 1]) {
+                        ++begin;
+                    }
+                    while (end > 0 && end < n && ids[end] == ids[end - 1]) {
+                        ++end;
+                    }
+                    std::vector<AccT> accum(inner_size);
+                    for (int64_t first = begin; first < end;) {
+                        int64_t segment = ids[first];
+                        int64_t last = first + 1;
+                        while (last < end && ids[last] == segment) {
+                            ++last;
+                        }
+                        for (int64_t j = 0; j < inner_size; ++j) {
+                            accum[j] = include_out ? static_cast<AccT>(out_at(segment, j)) : load_data(first, j);
+                        }
+                        for (int64_t i = include_out ? first : first + 1; i < last; ++i) {
+                            for (int64_t j = 0; j < inner_size; ++j) {
+                                ReduceSegmentValue(reduction, load_data(i, j), accum[j]);
+                            }
+                        }
+                        for (int64_t j = 0; j < inner_size; ++j) {
+                            out_at(segment, j) = static_cast<T>(accum[j]);
+                        }
+                        counts_data[segment] += last - first;
+                        first = last;
+                    }
+                });
+                return;
+            }
+
+            // Unsorted rows are reduced into a private buffer per chunk, which are then merged in parallel over segments.
+            // Chunks are only used if the buffers are small compared to the data.
+            int64_t chunk_count = GetParallelChunkCount(n, row_grain_size);
+            if ((chunk_count - 1) * num_segments > n) {
+                chunk_count = 1;
+            }
+            std::vector<std::vector<AccT>> chunk_accums(chunk_count, std::vector<AccT>(num_segments * inner_size));
+            std::vector<std::vector<int64_t>> chunk_counts(chunk_count, std::vector<int64_t>(num_segments));
+            ParallelFor(chunk_count, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+                for (int64_t chunk = chunk_begin; chunk < chunk_end; ++chunk) {
+                    std::vector<AccT>& accum = chunk_accums[chunk];
+                    std::vector<int64_t>& count = chunk_counts[chunk];
+                    for (int64_t i = n * chunk / chunk_count; i < n * (chunk + 1) / chunk_count; ++i) {
+                        int64_t segment = ids[i];
+                        AccT* accum_row = &accum[segment * inner_size];
+                        if (count[segment]++ == 0) {
+                            for (int64_t j = 0; j < inner_size; ++j) {
+                                accum_row[j] = load_data(i, j);
+                            }
+                        } else {
+                            for (int64_t j = 0; j < inner_size; ++j) {
+                                ReduceSegmentValue(reduction, load_data(i, j), accum_row[j]);
+                            }
+                        }
+                    }
+                }
+            });
+            ParallelFor(num_segments, std::max(int64_t{1}, row_grain_size / chunk_count), [&](int64_t begin, int64_t end) {
+                std::vector<AccT> accum(inner_size);
+                for (int64_t segment = begin; segment < end; ++segment) {
+                    int64_t total_count = 0;
+                    if (include_out) {
+                        for (int64_t j = 0; j < inner_size; ++j) {
+                            accum[j] = static_cast<AccT>(out_at(segment, j));
+                        }
+                    }
+                    for (int64_t chunk = 0; chunk < chunk_count; ++chunk) {
+                        int64_t count = chunk_counts[chunk][segment];
+                        if (count == 0) {
+                            continue;
+                        }
+                        const AccT* accum_row = &chunk_accums[chunk][segment * inner_size];
+                        for (int64_t j = 0; j < inner_size; ++j) {
+                            if (!include_out && total_count == 0) {
+                                accum[j] = accum_row[j];
+                            } else {
+                                ReduceSegmentValue(reduction, accum_row[j], accum[j]);
+                            }
+                        }
+                        total_count += count;
+                    }
+                    if (total_count > 0) {
+                        for (int64_t j = 0; j < inner_size; ++j) {
+                            out_at(segment, j) = static_cast<T>(accum[j]);
+                        }
+                        counts_data[segment] += total_count;
+                    }
+                }
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SegmentReduceKernel, NativeSegmentReduceKernel);
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
@@ -0,0 +1,178 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/backend_util.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/indexable_array.h"
+#include "chainerx/kernels/sorting.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+#include "chainerx/numeric.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+namespace internal {
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Unique)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Searchsorted)
+}  // namespace internal
+
+namespace native {
+namespace {
+
+// Returns whether x is sorted before y, with NaNs at the end.
+template <typename T>
+bool SortsBefore(T x, T y) {
+    return !IsNan(x) && (IsNan(y) || x < y);
+}
+
+class NativeUniqueKernel : public UniqueKernel {
+public:
+    std::tuple<Array, Array, Array, Array> Call(const Array& a) override {
+        CHAINERX_ASSERT(a.ndim() == 1);
+
+        int64_t n = a.GetTotalSize();
+        Device& device = a.device();
+        Array out_inverse = Empty(Shape{n}, Dtype::kInt64, device);
+        Array out_unique{};
+        Array out_index{};
+        Array out_counts{};
+
+        VisitDtype(a.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 1> a_iarray{a};
+            std::vector<AccT> values(n);
+            for (int64_t i = 0; i < n; ++i) {
+                values[i] = static_cast<AccT>(native_internal::StorageToDataType<const T>(a_iarray[&i]));
+            }
+
+            // Indices are sorted by their values and then by themselves, so that the first occurrences come first.
+            auto index_less = [&values](int64_t i, int64_t j) {
+                return SortsBefore<AccT>(values[i], values[j]) || (!SortsBefore<AccT>(values[j], values[i]) && i < j);
+            };
+            std::vector<int64_t> order(n);
+            std::iota(order.begin(), order.end(), int64_t{0});
+
+            // Chunks are sorted in parallel and then merged pairwise in parallel.
+            int64_t chunk_count = GetParallelChunkCount(n, kParallelGrainSize);
+            auto chunk_begin = [n, chunk_count](int64_t chunk) { return n * chunk / chunk_count; };
+            ParallelFor(chunk_count, 1, [&](int64_t begin, int64_t end) {
+                for (int64_t chunk = begin; chunk < end; ++chunk) {
+                    std::sort(order.begin() + chunk_begin(chunk), order.begin() + chunk_begin(chunk + 1), index_less);
+                }
+            });
+            for (int64_t width = 1; width < chunk_count; width *= 2) {
+                int64_t pair_count = (chunk_count + 2 * width - 1) / (2 * width);
+                ParallelFor(pair_count, 1, [&](int64_t begin, int64_t end) {
+                    for (int64_t pair = begin; pair < end; ++pair) {
+                        int64_t first = 2 * width * pair;
+                        int64_t middle = std::min(first + width, chunk_count);
+                        int64_t last = std::min(first + 2 * width, chunk_count);
+                        std::inplace_merge(
+                                order.begin() + chunk_begin(first),
+                                order.begin() + chunk_begin(middle),
+                                order.begin() + chunk_begin(last),
+                                index_less);
+                    }
+                });
+            }
+
+            // Runs of equal values in the sorted order are the unique elements.
+            auto* inverse_data = static_cast<int64_t*>(internal::GetRawOffsetData(out_inverse));
+            std::vector<int64_t> run_starts;
+            for (int64_t k = 0; k < n; ++k) {
+                AccT value = values[order[k]];
+                if (k == 0 || SortsBefore<AccT>(values[order[k - 1]], value)) {
+                    run_starts.emplace_back(k);
+                }
+                inverse_data[order[k]] = static_cast<int64_t>(run_starts.size()) - 1;
+            }
+
+            auto unique_count = static_cast<int64_t>(run_starts.size());
+            out_unique = Empty(Shape{unique_count}, a.dtype(), device);
+            out_index = Empty(Shape{unique_count}, Dtype::kInt64, device);
+            out_counts = Empty(Shape{unique_count}, Dtype::kInt64, device);
+            IndexableArray<T, 1> unique_iarray{out_unique};
+            auto* index_data = static_cast<int64_t*>(internal::GetRawOffsetData(out_index));
+            auto* counts_data = static_cast<int64_t*>(internal::GetRawOffsetData(out_counts));
+            for (int64_t u = 0; u < unique_count; ++u) {
+                int64_t start = run_starts[u];
+                int64_t end = u + 1 < unique_count ? run_starts[u + 1] : n;
+                native_internal::StorageToDataType<T>(unique_iarray[&u]) = static_cast<T>(values[order[start]]);
+                index_data[u] = order[start];
+                counts_data[u] = end - start;
+            }
+        });
+
+        return std::make_tuple(std::move(out_unique), std::move(out_index), std::move(out_inverse), std::move(out_counts));
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(UniqueKernel, NativeUniqueKernel);
+
+class NativeSearchsortedKernel : public SearchsortedKernel {
+public:
+    void Call(const Array& a, const Array& v, bool right, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, v, out);
+        CHAINERX_ASSERT(a.dtype() == v.dtype());
+        CHAINERX_ASSERT(out.dtype() == Dtype::kInt64);
+        CHAINERX_ASSERT(a.ndim() == 2);
+        CHAINERX_ASSERT(v.ndim() == 2);
+        CHAINERX_ASSERT(a.shape()[0] == v.shape()[0]);
+        CHAINERX_ASSERT(v.shape() == out.shape());
+
+        int64_t row_count = v.shape()[0];
+        int64_t size = a.shape()[1];
+        int64_t value_count = v.shape()[1];
+
+        VisitDtype(a.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 2> a_iarray{a};
+            IndexableArray<const T, 2> v_iarray{v};
+            IndexableArray<int64_t, 2> out_iarray{out};
+
+            ParallelFor(row_count * value_count, kParallelGrainSize, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    int64_t v_index[] = {i / value_count, i % value_count};
+                    auto value = static_cast<AccT>(native_internal::StorageToDataType<const T>(v_iarray[v_index]));
+
+                    // The bisection has no branches on the comparisons.
+                    int64_t a_index[] = {v_index[0], 0};
+                    int64_t first = 0;
+                    int64_t count = size;
+                    while (count > 0) {
+                        int64_t half = count / 2;
+                        a_index[1] = first + half;
+                        auto pivot = static_cast<AccT>(native_internal::StorageToDataType<const T>(a_iarray[a_index]));
+                        bool after = right ? !SortsBefore(value, pivot) : SortsBefore(pivot, value);
+                        first = after ? first + half + 1 : first;
+                        count = after ? count - half - 1 : half;
+                    }
+                    out_iarray[v_index] = first;
+                }
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SearchsortedKernel, NativeSearchsortedKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,164 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/indexable_array.h"
+#include "chainerx/kernels/sparse.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
+#include "chainerx/native/index_data.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+
+namespace chainerx {
+
+namespace internal {
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(CsrMatmul)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(CsrSampledDot)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(CooToCsr)
+}  // namespace internal
+
+namespace native {
+namespace {
+
+// Returns the minimum number of rows to run on a thread, given the total number of multiply-adds.
+int64_t GetSparseRowGrainSize(int64_t rows, int64_t total_work) {
+    return std::max(int64_t{1}, kParallelGrainSize * rows / std::max(int64_t{1}, total_work));
+}
+
+class NativeCsrMatmulKernel : public CsrMatmulKernel {
+public:
+    void Call(const Array& data, const Array& indices, const Array& indptr, const Array& b, const Array& out) override {
+        data.device().CheckDevicesCompatible(data, indices, indptr, b, out);
+        CHAINERX_ASSERT(data.dtype() == out.dtype());
+        CHAINERX_ASSERT(b.dtype() == out.dtype());
+        CHAINERX_ASSERT(b.ndim() == 2);
+        CHAINERX_ASSERT(out.ndim() == 2);
+        CHAINERX_ASSERT(b.shape()[1] == out.shape()[1]);
+        CHAINERX_ASSERT(indptr.GetTotalSize() == out.shape()[0] + 1);
+
+        int64_t m = out.shape()[0];
+        int64_t n = out.shape()[1];
+        const int64_t* indices_data = native_internal::GetIndexData(indices);
+        const int64_t* indptr_data = native_internal::GetIndexData(indptr);
+
+        VisitNumericDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 1> data_iarray{data};
+            IndexableArray<const T, 2> b_iarray{b};
+            IndexableArray<T, 2> out_iarray{out};
+
+            // Each row of the output is accumulated on a single thread.
+            ParallelFor(m, GetSparseRowGrainSize(m, data.GetTotalSize() * n), [&](int64_t begin, int64_t end) {
+                std::vector<AccT> acc(n);
+                for (int64_t i = begin; i < end; ++i) {
+                    std::fill(acc.begin(), acc.end(), AccT{0});
+                    for (int64_t p = indptr_data[i]; p < indptr_data[i + 1]; ++p) {
+                        auto value = static_cast<AccT>(native_internal::StorageToDataType<const T>(data_iarray[&p]));
+                        int64_t b_index[] = {indices_data[p], 0};
+                        for (int64_t& j = b_index[1]; j < n; ++j) {
+                            acc[j] += value * static_cast<AccT>(native_internal::StorageToDataType<const T>(b_iarray[b_index]));
+                        }
+                    }
+                    int64_t out_index[] = {i, 0};
+                    for (int64_t& j = out_index[1]; j < n; ++j) {
+                        native_internal::StorageToDataType<T>(out_iarray[out_index]) = static_cast<T>(acc[j]);
+                    }
+                }
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(CsrMatmulKernel, NativeCsrMatmulKernel);
+
+class NativeCsrSampledDotKernel : public CsrSampledDotKernel {
+public:
+    void Call(const Array& indices, const Array& indptr, const Array& a, const Array& b, const Array& out) override {
+        a.device().CheckDevicesCompatible(indices, indptr, a, b, out);
+        CHAINERX_ASSERT(a.dtype() == out.dtype());
+        CHAINERX_ASSERT(b.dtype() == out.dtype());
+        CHAINERX_ASSERT(a.ndim() == 2);
+        CHAINERX_ASSERT(b.ndim() == 2);
+        CHAINERX_ASSERT(a.shape()[1] == b.shape()[1]);
+        CHAINERX_ASSERT(indptr.GetTotalSize() == a.shape()[0] + 1);
+        CHAINERX_ASSERT(indices.GetTotalSize() == out.GetTotalSize());
+
+        int64_t m = a.shape()[0];
+        int64_t n = a.shape()[1];
+        const int64_t* indices_data = native_internal::GetIndexData(indices);
+        const int64_t* indptr_data = native_internal::GetIndexData(indptr);
+
+        VisitNumericDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 2> a_iarray{a};
+            IndexableArray<const T, 2> b_iarray{b};
+            IndexableArray<T, 1> out_iarray{out};
+
+            ParallelFor(m, GetSparseRowGrainSize(m, out.GetTotalSize() * n), [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    for (int64_t p = indptr_data[i]; p < indptr_data[i + 1]; ++p) {
+                        AccT acc{0};
+                        int64_t a_index[] = {i, 0};
+                        int64_t b_index[] = {indices_data[p], 0};
+                        for (int64_t j = 0; j < n; ++j) {
+                            a_index[1] = j;
+                            b_index[1] = j;
+                            acc += static_cast<AccT>(native_internal::StorageToDataType<const T>(a_iarray[a_index])) *
+                                   static_cast<AccT>(native_internal::StorageToDataType<const T>(b_iarray[b_index]));
+                        }
+                        native_internal::StorageToDataType<T>(out_iarray[&p]) = static_cast<T>(acc);
+                    }
+                }
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(CsrSampledDotKernel, NativeCsrSampledDotKernel);
+
+class NativeCooToCsrKernel : public CooToCsrKernel {
+public:
+    void Call(const Array& row, const Array& out_indptr, const Array& out_order) override {
+        row.device().CheckDevicesCompatible(row, out_indptr, out_order);
+        CHAINERX_ASSERT(row.GetTotalSize() == out_order.GetTotalSize());
+
+        int64_t m = out_indptr.GetTotalSize() - 1;
+        int64_t nnz = row.GetTotalSize();
+        const int64_t* row_data = native_internal::GetIndexData(row);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        auto* indptr_data = const_cast<int64_t*>(native_internal::GetIndexData(out_indptr));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        auto* order_data = const_cast<int64_t*>(native_internal::GetIndexData(out_order));
+
+        // Counting sort by rows.
+        std::fill(indptr_data, indptr_data + m + 1, int64_t{0});
+        for (int64_t p = 0; p < nnz; ++p) {
+            ++indptr_data[row_data[p] + 1];
+        }
+        for (int64_t i = 0; i < m; ++i) {
+            indptr_data[i + 1] += indptr_data[i];
+        }
+        std::vector<int64_t> next(indptr_data, indptr_data + m);
+        for (int64_t p = 0; p < nnz; ++p) {
+            order_data[next[row_data[p]]++] = p;
+        }
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(CooToCsrKernel, NativeCooToCsrKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
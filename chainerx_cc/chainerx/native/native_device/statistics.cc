@@ -1,14 +1,24 @@
 #include "chainerx/native/native_device.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <absl/types/optional.h>
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/indexable_array.h"
 #include "chainerx/kernels/statistics.h"
 #include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
 #include "chainerx/native/reduce.h"
 #include "chainerx/numeric.h"
 #include "chainerx/numeric_limits.h"
@@ -19,6 +29,9 @@ namespace chainerx {
 namespace internal {
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(AMax)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(AMin)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Bincount)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Histogram)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Quantile)
 }  // namespace internal
 
 namespace native {
@@ -74,6 +87,206 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(AMinKernel, NativeAMinKernel);
 
+// Sums the weights of n elements in their bins into the 1-dimensional array out of dtype T.
+// get_bin(i) returns the bin of the i-th element, or -1 if it is ignored, and get_weight(i) returns its weight.
+// Each thread counts a chunk of the elements in its own histogram, and the histograms are then merged in parallel over the bins. Chunks
+// are only used if their histograms are small compared to the elements.
+template <typename T, typename GetBin, typename GetWeight>
+void AccumulateHistogram(int64_t n, const Array& out, GetBin&& get_bin, GetWeight&& get_weight) {
+    using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+    int64_t bin_count = out.GetTotalSize();
+    int64_t chunk_count = GetParallelChunkCount(n, kParallelGrainSize);
+    if ((chunk_count - 1) * bin_count > n) {
+        chunk_count = 1;
+    }
+    std::vector<std::vector<AccT>> histograms(chunk_count, std::vector<AccT>(bin_count));
+    ParallelFor(chunk_count, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+        for (int64_t chunk = chunk_begin; chunk < chunk_end; ++chunk) {
+            std::vector<AccT>& histogram = histograms[chunk];
+            for (int64_t i = n * chunk / chunk_count; i < n * (chunk + 1) / chunk_count; ++i) {
+                int64_t bin = get_bin(i);
+                if (bin >= 0) {
+                    histogram[bin] += static_cast<AccT>(get_weight(i));
+                }
+            }
+        }
+    });
+
+    IndexableArray<T, 1> out_iarray{out};
+    ParallelFor(bin_count, std::max(int64_t{1}, kParallelGrainSize / chunk_count), [&](int64_t begin, int64_t end) {
+        for (int64_t bin = begin; bin < end; ++bin) {
+            AccT sum{0};
+            for (const std::vector<AccT>& histogram : histograms) {
+                sum += histogram[bin];
+            }
+            native_internal::StorageToDataType<T>(out_iarray[&bin]) = static_cast<T>(sum);
+        }
+    });
+}
+
+// Sums the weights, or ones if they are not given, of n elements in their bins into out.
+template <typename GetBin>
+void AccumulateHistogram(int64_t n, const absl::optional<Array>& weights, const Array& out, GetBin&& get_bin) {
+    if (!weights.has_value()) {
+        CHAINERX_ASSERT(out.dtype() == Dtype::kInt64);
+        AccumulateHistogram<int64_t>(n, out, get_bin, [](int64_t /*i*/) { return int64_t{1}; });
+        return;
+    }
+    CHAINERX_ASSERT(weights->dtype() == out.dtype());
+    VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+        using T = typename decltype(pt)::type;
+        IndexableArray<const T, 1> weights_iarray{*weights};
+        AccumulateHistogram<T>(
+                n, out, get_bin, [&weights_iarray](int64_t i) { return native_internal::StorageToDataType<const T>(weights_iarray[&i]); });
+    });
+}
+
+class NativeBincountKernel : public BincountKernel {
+public:
+    void Call(const Array& x, const absl::optional<Array>& weights, const Array& out) override {
+        x.device().CheckDevicesCompatible(x, out);
+        CHAINERX_ASSERT(x.dtype() == Dtype::kInt64);
+        CHAINERX_ASSERT(x.ndim() == 1);
+        CHAINERX_ASSERT(out.ndim() == 1);
+        CHAINERX_ASSERT(!weights.has_value() || weights->shape() == x.shape());
+
+        IndexableArray<const int64_t, 1> x_iarray{x};
+        AccumulateHistogram(x.GetTotalSize(), weights, out, [&x_iarray](int64_t i) { return x_iarray[&i]; });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(BincountKernel, NativeBincountKernel);
+
+class NativeHistogramKernel : public HistogramKernel {
+public:
+    void Call(const Array& a, const Array& edges, const absl::optional<Array>& weights, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, edges, out);
+        CHAINERX_ASSERT(a.dtype() == edges.dtype());
+        CHAINERX_ASSERT(a.ndim() == 1);
+        CHAINERX_ASSERT(edges.ndim() == 1);
+        CHAINERX_ASSERT(out.ndim() == 1);
+        CHAINERX_ASSERT(edges.GetTotalSize() == out.GetTotalSize() + 1);
+        CHAINERX_ASSERT(!weights.has_value() || weights->shape() == a.shape());
+
+        VisitNumericDtype(a.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 1> a_iarray{a};
+            IndexableArray<const T, 1> edges_iarray{edges};
+            std::vector<AccT> edge_values(edges.GetTotalSize());
+            for (int64_t i = 0; i < edges.GetTotalSize(); ++i) {
+                edge_values[i] = static_cast<AccT>(native_internal::StorageToDataType<const T>(edges_iarray[&i]));
+            }
+
+            // The bin of an element is found by a binary search over the edges, and the last bin includes its right edge.
+            auto bin_count = static_cast<int64_t>(edge_values.size()) - 1;
+            auto get_bin = [&a_iarray, &edge_values, bin_count](int64_t i) -> int64_t {
+                auto value = static_cast<AccT>(native_internal::StorageToDataType<const T>(a_iarray[&i]));
+                if (IsNan(value) || value < edge_values.front() || edge_values.back() < value) {
+                    return -1;
+                }
+                int64_t bin = std::upper_bound(edge_values.begin(), edge_values.end(), value) - edge_values.begin() - 1;
+                return std::min(bin, bin_count - 1);
+            };
+            AccumulateHistogram(a.GetTotalSize(), weights, out, get_bin);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(HistogramKernel, NativeHistogramKernel);
+
+class NativeQuantileKernel : public QuantileKernel {
+public:
+    void Call(const Array& a, const std::vector<double>& q, bool ignore_nan, const Array& out) override {
+        a.device().CheckDevicesCompatible(a, out);
+        CHAINERX_ASSERT(a.dtype() == out.dtype());
+        CHAINERX_ASSERT(a.ndim() == 2);
+        CHAINERX_ASSERT(out.ndim() == 2);
+        CHAINERX_ASSERT(out.shape()[0] == static_cast<int64_t>(q.size()));
+        CHAINERX_ASSERT(out.shape()[1] == a.shape()[0]);
+
+        int64_t row_count = a.shape()[0];
+        int64_t size = a.shape()[1];
+        auto q_count = static_cast<int64_t>(q.size());
+
+        VisitFloatingPointDtype(a.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+            IndexableArray<const T, 2> a_iarray{a};
+            IndexableArray<T, 2> out_iarray{out};
+
+            ParallelFor(row_count, std::max(int64_t{1}, kParallelGrainSize / std::max(size, int64_t{1})), [&](int64_t begin, int64_t end) {
+                std::vector<AccT> values;
+                values.reserve(size);
+                std::vector<int64_t> ranks;
+                ranks.reserve(2 * q_count);
+
+                for (int64_t row = begin; row < end; ++row) {
+                    int64_t out_index[] = {0, row};
+                    auto fill_nan = [&out_iarray, &out_index, q_count]() {
+                        for (out_index[0] = 0; out_index[0] < q_count; ++out_index[0]) {
+                            native_internal::StorageToDataType<T>(out_iarray[out_index]) = static_cast<T>(NAN);
+                        }
+                    };
+
+                    values.clear();
+                    bool has_nan = false;
+                    int64_t a_index[] = {row, 0};
+                    for (a_index[1] = 0; a_index[1] < size; ++a_index[1]) {
+                        auto value = static_cast<AccT>(native_internal::StorageToDataType<const T>(a_iarray[a_index]));
+                        if (IsNan(value)) {
+                            has_nan = true;
+                        } else {
+                            values.emplace_back(value);
+                        }
+                    }
+                    if (values.empty() || (has_nan && !ignore_nan)) {
+                        fill_nan();
+                        continue;
+                    }
+
+                    // Only the order statistics between which the quantiles are interpolated are selected, in increasing order of their
+                    // ranks. Each of them is selected among the elements after the previous one, which are not smaller than it.
+                    auto last_rank = static_cast<int64_t>(values.size()) - 1;
+                    ranks.clear();
+                    for (double quantile : q) {
+                        auto lower_rank = static_cast<int64_t>(std::floor(quantile * last_rank));
+                        ranks.emplace_back(lower_rank);
+                        ranks.emplace_back(std::min(lower_rank + 1, last_rank));
+                    }
+                    std::sort(ranks.begin(), ranks.end());
+                    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+                    auto first = values.begin();
+                    for (int64_t rank : ranks) {
+                        std::nth_element(first, values.begin() + rank, values.end());
+                        first = values.begin() + rank + 1;
+                    }
+
+                    for (out_index[0] = 0; out_index[0] < q_count; ++out_index[0]) {
+                        double position = q[out_index[0]] * last_rank;
+                        auto lower_rank = static_cast<int64_t>(std::floor(position));
+                        auto lower = static_cast<double>(values[lower_rank]);
+                        auto upper = static_cast<double>(values[std::min(lower_rank + 1, last_rank)]);
+                        double t = position - lower_rank;
+
+                        // Interpolates from the nearer of the two elements as NumPy does, so that the result is monotonic in t.
+                        double result = lower;
+                        if (lower != upper) {
+                            result = t < 0.5 ? lower + (upper - lower) * t : upper - (upper - lower) * (1 - t);
+                        }
+                        native_internal::StorageToDataType<T>(out_iarray[out_index]) = static_cast<T>(result);
+                    }
+                }
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(QuantileKernel, NativeQuantileKernel);
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
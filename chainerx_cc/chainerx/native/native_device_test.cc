@@ -1,6 +1,8 @@
 #include "chainerx/native/native_device.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <thread>
@@ -39,6 +41,20 @@ TEST(NativeDeviceTest, Allocate) {
     EXPECT_NE(nullptr, ptr);
 }
 
+TEST(NativeDeviceTest, AllocateSizes) {
+    Context ctx;
+    NativeDevice& device = GetNativeDevice(ctx, 0);
+
+    // Small buffers are allocated together with their reference counts; the others are not. Both must be aligned and writable.
+    for (size_t bytesize : {1, 15, 16, 17, 64, 65, 256, 257, 4096}) {
+        std::shared_ptr<void> ptr = device.Allocate(bytesize);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(ptr.get()) % alignof(std::max_align_t));
+        std::memset(ptr.get(), 0xff, bytesize);
+        EXPECT_EQ(0xff, static_cast<uint8_t*>(ptr.get())[bytesize - 1]);
+    }
+}
+
 TEST(NativeDeviceTest, AllocateZero) {
     Context ctx;
     NativeDevice& device = GetNativeDevice(ctx, 0);
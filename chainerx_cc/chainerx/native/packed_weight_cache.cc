@@ -0,0 +1,123 @@
+#include "chainerx/native/packed_weight_cache.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "chainerx/array.h"
+#include "chainerx/data_version.h"
+#include "chainerx/dtype.h"
+#include "chainerx/hash_combine.h"
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+// Returns true if both pointers share the ownership of the same buffer.
+bool IsSameOwner(const std::weak_ptr<void>& lhs, const std::shared_ptr<void>& rhs) {
+    return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+}
+
+}  // namespace
+
+size_t PackedWeightCache::KeyHash::operator()(const Key& key) const {
+    size_t seed = std::hash<const void*>{}(key.data);
+    internal::HashCombine(seed, std::hash<int64_t>{}(key.offset));
+    internal::HashCombine(seed, std::hash<int>{}(static_cast<int>(key.weight_dtype)));
+    internal::HashCombine(seed, std::hash<int>{}(static_cast<int>(key.dtype)));
+    for (int64_t dim : key.shape) {
+        internal::HashCombine(seed, std::hash<int64_t>{}(dim));
+    }
+    for (int64_t stride : key.strides) {
+        internal::HashCombine(seed, std::hash<int64_t>{}(stride));
+    }
+    return seed;
+}
+
+bool PackedWeightCache::KeyEqual::operator()(const Key& lhs, const Key& rhs) const {
+    return lhs.data == rhs.data && lhs.offset == rhs.offset && lhs.weight_dtype == rhs.weight_dtype && lhs.dtype == rhs.dtype &&
+           lhs.shape == rhs.shape && lhs.strides == rhs.strides;
+}
+
+Array PackedWeightCache::GetOrPack(const Array& weight, Dtype dtype, const PackFunction& pack) {
+    Key key{weight.raw_data(), weight.offset(), weight.dtype(), dtype, weight.shape(), weight.strides()};
+    uint64_t version = internal::GetDataVersion(weight);
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            const Entry& entry = it->second;
+            // The buffer may have been freed and another buffer may have been allocated at the same address.
+            if (entry.version == version && IsSameOwner(entry.data, weight.data())) {
+                return entry.packed;
+            }
+            entries_.erase(it);
+        }
+    }
+
+    // Pack without holding the lock. Concurrent calls for the same weight may pack it more than once.
+    Array packed = pack(weight);
+    if (packed.data() == weight.data()) {
+        return packed;
+    }
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.data.expired()) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    entries_[std::move(key)] = Entry{weight.data(), version, packed};
+    return packed;
+}
+
+size_t PackedWeightCache::size() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return entries_.size();
+}
+
+void PackedWeightCache::Clear() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    entries_.clear();
+}
+
+std::atomic<PackedWeightCache*> PackedWeightCacheScope::cache_{nullptr};
+
+std::atomic<int64_t> PackedWeightCacheScope::holder_count_{0};
+
+PackedWeightCacheScope::PackedWeightCacheScope(PackedWeightCache& cache) {
+    PackedWeightCache* expected{nullptr};
+    bool exchanged = cache_.compare_exchange_strong(expected, &cache, std::memory_order_acq_rel);
+    CHAINERX_ASSERT(exchanged);  // nested use is not supported
+}
+
+PackedWeightCacheScope::~PackedWeightCacheScope() {
+    cache_.store(nullptr);
+    // Wait for the kernel calls which have taken the cache. Holders created from now on see no cache.
+    while (holder_count_.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+namespace native_internal {
+
+Array PackWeight(const Array& weight, Dtype dtype, const PackedWeightCache::PackFunction& pack) {
+    PackedWeightCacheScope::CacheHolder holder{};
+    PackedWeightCache* cache = holder.get();
+    if (cache == nullptr) {
+        return pack(weight);
+    }
+    return cache->GetOrPack(weight, dtype, pack);
+}
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
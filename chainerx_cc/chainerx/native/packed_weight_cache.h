@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "chainerx/array.h"
+#include "chainerx/dtype.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+
+namespace chainerx {
+namespace native {
+
+// Weights converted to the dtype and the memory layout consumed by the native GEMM, reused across calls while the weights are unchanged.
+//
+// An entry is identified by the data buffer and the view (offset, shape, strides and dtype) of the weight and the target dtype. It stays
+// valid as long as the buffer is alive and the data version of the buffer (see internal::GetDataVersion) is the one seen at packing, so
+// that in-place updates of the weights invalidate it. Entries of freed buffers are removed when another entry is added.
+// This class is thread safe.
+class PackedWeightCache {
+public:
+    using PackFunction = std::function<Array(const Array&)>;
+
+    // Returns pack(weight), reusing the result of a previous call for the same weight if it is still valid.
+    // The result of pack is not cached if it shares the buffer with the weight.
+    Array GetOrPack(const Array& weight, Dtype dtype, const PackFunction& pack);
+
+    // Returns the number of entries including the invalidated ones which have not been removed yet.
+    size_t size() const;
+
+    void Clear();
+
+private:
+    struct Key {
+        const void* data;
+        int64_t offset;
+        Dtype weight_dtype;
+        Dtype dtype;
+        Shape shape;
+        Strides strides;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct KeyEqual {
+        bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+
+    struct Entry {
+        std::weak_ptr<void> data;
+        uint64_t version;
+        Array packed;
+    };
+
+    mutable std::mutex mutex_;
+
+    std::unordered_map<Key, Entry, KeyHash, KeyEqual> entries_;
+};
+
+// A scope object to enable packed weight caching.
+// While the scope is active, the native kernels on any thread cache the converted weights in the cache specified in the constructor.
+// This is meant for inference with fixed weights; training workloads would mostly fill the cache with entries invalidated by the
+// optimizer. Only one packed weight cache scope can exist at any given moment.
+class PackedWeightCacheScope {
+public:
+    explicit PackedWeightCacheScope(PackedWeightCache& cache);
+    ~PackedWeightCacheScope();
+
+    PackedWeightCacheScope(const PackedWeightCacheScope&) = delete;
+    PackedWeightCacheScope& operator=(const PackedWeightCacheScope&) = delete;
+    PackedWeightCacheScope(PackedWeightCacheScope&& other) = delete;
+    PackedWeightCacheScope& operator=(PackedWeightCacheScope&& other) = delete;
+
+    // Holds the global packed weight cache, if any.
+    // The scope which installed the cache waits for all holders to be destroyed before it is destroyed, so that the cache can be destroyed
+    // right after the scope.
+    class CacheHolder {
+    public:
+        CacheHolder() {
+            // Calls outside any scope do not touch the shared count of holders.
+            if (cache_.load(std::memory_order_acquire) == nullptr) {
+                return;
+            }
+            ++holder_count_;
+            cache_ptr_ = cache_.load();
+            if (cache_ptr_ == nullptr) {
+                --holder_count_;
+            }
+        }
+
+        ~CacheHolder() {
+            if (cache_ptr_ != nullptr) {
+                --holder_count_;
+            }
+        }
+
+        CacheHolder(const CacheHolder&) = delete;
+        CacheHolder& operator=(const CacheHolder&) = delete;
+        CacheHolder(CacheHolder&& other) = delete;
+        CacheHolder& operator=(CacheHolder&& other) = delete;
+
+        PackedWeightCache* get() const { return cache_ptr_; }
+
+    private:
+        PackedWeightCache* cache_ptr_{nullptr};
+    };
+
+private:
+    // The global packed weight cache.
+    static std::atomic<PackedWeightCache*> cache_;
+
+    // The number of holders which may be using the global packed weight cache.
+    static std::atomic<int64_t> holder_count_;
+};
+
+namespace native_internal {
+
+// Returns pack(weight), through the cache of the active PackedWeightCacheScope if any.
+Array PackWeight(const Array& weight, Dtype dtype, const PackedWeightCache::PackFunction& pack);
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,168 @@
+#include "chainerx/native/packed_weight_cache.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+class PackedWeightCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+    Device& device() { return device_session_->device(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(PackedWeightCacheTest, GetOrPack) {
+    Array w = testing::BuildArray({2, 3}).WithLinearData<float>();
+
+    int pack_count = 0;
+    auto pack = [&pack_count](const Array& a) {
+        ++pack_count;
+        return a.AsType(Dtype::kFloat64);
+    };
+
+    PackedWeightCache cache{};
+    Array packed = cache.GetOrPack(w, Dtype::kFloat64, pack);
+    EXPECT_EQ(1, pack_count);
+    EXPECT_ARRAY_EQ(w.AsType(Dtype::kFloat64), packed);
+
+    // Hit.
+    EXPECT_EQ(packed.data(), cache.GetOrPack(w, Dtype::kFloat64, pack).data());
+    EXPECT_EQ(1, pack_count);
+    EXPECT_EQ(size_t{1}, cache.size());
+
+    // Different views and dtypes of the same buffer are different entries.
+    cache.GetOrPack(w.Transpose(), Dtype::kFloat64, pack);
+    cache.GetOrPack(w, Dtype::kFloat32, pack);
+    EXPECT_EQ(3, pack_count);
+    EXPECT_EQ(size_t{3}, cache.size());
+
+    cache.Clear();
+    EXPECT_EQ(size_t{0}, cache.size());
+    cache.GetOrPack(w, Dtype::kFloat64, pack);
+    EXPECT_EQ(4, pack_count);
+}
+
+TEST_F(PackedWeightCacheTest, InvalidateInplaceUpdate) {
+    Array w = testing::BuildArray({2, 3}).WithLinearData<float>();
+    auto pack = [](const Array& a) { return a.AsType(Dtype::kFloat64); };
+
+    PackedWeightCache cache{};
+    cache.GetOrPack(w, Dtype::kFloat64, pack);
+
+    w += 1;
+    EXPECT_ARRAY_EQ(w.AsType(Dtype::kFloat64), cache.GetOrPack(w, Dtype::kFloat64, pack));
+
+    // Updates through another view of the buffer also invalidate the entry.
+    w.At({0}).Fill(5);
+    EXPECT_ARRAY_EQ(w.AsType(Dtype::kFloat64), cache.GetOrPack(w, Dtype::kFloat64, pack));
+    EXPECT_EQ(size_t{1}, cache.size());
+}
+
+TEST_F(PackedWeightCacheTest, FreedWeight) {
+    auto pack = [](const Array& a) { return a.AsType(Dtype::kFloat64); };
+
+    PackedWeightCache cache{};
+    {
+        Array w = testing::BuildArray({2, 3}).WithLinearData<float>();
+        cache.GetOrPack(w, Dtype::kFloat64, pack);
+    }
+    Array w = testing::BuildArray({2, 3}).WithLinearData<float>(1);
+    // The new buffer may be allocated at the address of the freed one, which must not be taken as a hit.
+    EXPECT_ARRAY_EQ(w.AsType(Dtype::kFloat64), cache.GetOrPack(w, Dtype::kFloat64, pack));
+    EXPECT_EQ(size_t{1}, cache.size());
+}
+
+TEST_F(PackedWeightCacheTest, NotCachedIfAliased) {
+    Array w = testing::BuildArray({2, 3}).WithLinearData<float>();
+
+    PackedWeightCache cache{};
+    cache.GetOrPack(w, Dtype::kFloat32, [](const Array& a) { return a.Transpose(); });
+    EXPECT_EQ(size_t{0}, cache.size());
+}
+
+TEST_F(PackedWeightCacheTest, Dot) {
+    Array x = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array w = testing::BuildArray({4, 3}).WithLinearData<float>(-1.0f, 0.5f).WithPadding(1);
+    Array w16 = w.AsType(Dtype::kFloat16);
+
+    Array expected = Dot(x, w.Transpose());
+    Array expected16 = Dot(x.AsType(Dtype::kFloat16), w16.Transpose());
+
+    PackedWeightCache cache{};
+    {
+        PackedWeightCacheScope scope{cache};
+        EXPECT_ARRAY_EQ(expected, Dot(x, w.Transpose()));
+        EXPECT_ARRAY_EQ(expected, Dot(x, w16.Transpose(), Dtype::kFloat32));
+        EXPECT_ARRAY_EQ(expected16, Dot(x.AsType(Dtype::kFloat16), w16.Transpose()));
+        EXPECT_ARRAY_EQ(expected, Dot(x, w16.Transpose(), Dtype::kFloat32));
+        EXPECT_LE(size_t{1}, cache.size());
+
+        w16 += 1;
+        EXPECT_ARRAY_EQ(Dot(x, (w + 1).Transpose()), Dot(x, w16.Transpose(), Dtype::kFloat32));
+    }
+
+    // Outside the scope the cache is not used.
+    cache.Clear();
+    Dot(x, w16.Transpose(), Dtype::kFloat32);
+    EXPECT_EQ(size_t{0}, cache.size());
+}
+
+TEST_F(PackedWeightCacheTest, DestroyWhileCalling) {
+    Array x = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array w16 = Array{testing::BuildArray({4, 3}).WithLinearData<float>()}.AsType(Dtype::kFloat16);
+
+    // Caches are destroyed right after their scopes while other threads keep packing weights.
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([this, &x, &w16, &done]() {
+            SetDefaultContext(&device().context());
+            SetDefaultDevice(&device());
+            while (!done.load()) {
+                Dot(x, w16.Transpose(), Dtype::kFloat32);
+            }
+        });
+    }
+    for (int i = 0; i < 100; ++i) {
+        auto cache = std::make_unique<PackedWeightCache>();
+        {
+            PackedWeightCacheScope scope{*cache};
+            Dot(x, w16.Transpose(), Dtype::kFloat32);
+        }
+        EXPECT_EQ(size_t{1}, cache->size());
+        cache.reset();
+    }
+    done.store(true);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,223 @@
+#include "chainerx/native/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/error.h"
+#include "chainerx/util.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+size_t ParseNativeThreadCount(const std::string& value) {
+    size_t thread_count{0};
+    if (!value.empty() && std::all_of(value.begin(), value.end(), [](char c) { return '0' <= c && c <= '9'; })) {
+        try {
+            thread_count = static_cast<size_t>(std::stoull(value));
+        } catch (const std::out_of_range&) {
+            thread_count = 0;
+        }
+    }
+    if (thread_count == 0) {
+        throw ChainerxError{kNativeThreadCountEnvVarName, " must be a positive integer: ", value};
+    }
+    return thread_count;
+}
+
+// Whether the current thread runs a chunk of ParallelFor. Nested calls run serially on the thread.
+thread_local bool t_in_parallel_for{false};
+
+class ParallelForScope {
+public:
+    ParallelForScope() { t_in_parallel_for = true; }
+
+    ParallelForScope(const ParallelForScope&) = delete;
+    ParallelForScope(ParallelForScope&&) = delete;
+    ParallelForScope& operator=(const ParallelForScope&) = delete;
+    ParallelForScope& operator=(ParallelForScope&&) = delete;
+
+    ~ParallelForScope() { t_in_parallel_for = false; }
+};
+
+// Persistent workers which run the chunks of ParallelFor together with the calling thread.
+// The pool runs one loop at a time. Loops called while the pool is busy, e.g. from other threads computing numerical gradients, run
+// serially so that the total number of busy threads does not exceed the native thread count.
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t worker_count) {
+        workers_.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Calls run_chunk(chunk) for each chunk in [0, chunk_count) on the calling thread and up to chunk_count - 1 workers.
+    // Returns false without calling it if the pool is running another loop.
+    // run_chunk must not throw.
+    bool TryRun(int64_t chunk_count, const std::function<void(int64_t)>& run_chunk) {
+        std::unique_lock<std::mutex> run_lock{run_mutex_, std::try_to_lock};
+        if (!run_lock.owns_lock()) {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            run_chunk_ = &run_chunk;
+            chunk_count_ = chunk_count;
+            next_chunk_.store(0, std::memory_order_relaxed);
+            helper_count_ = std::min(static_cast<int64_t>(workers_.size()), chunk_count - 1);
+            joined_count_ = 0;
+            running_count_ = helper_count_;
+            ++generation_;
+        }
+        work_cv_.notify_all();
+
+        RunChunks();
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        // Workers which have not woken up yet would find no chunks left. Do not wait for them.
+        running_count_ -= helper_count_ - joined_count_;
+        helper_count_ = joined_count_;
+        done_cv_.wait(lock, [this]() { return running_count_ == 0; });
+        run_chunk_ = nullptr;
+        return true;
+    }
+
+private:
+    void RunChunks() {
+        for (int64_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed); chunk < chunk_count_;
+             chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed)) {
+            (*run_chunk_)(chunk);
+        }
+    }
+
+    void WorkerLoop() {
+        t_in_parallel_for = true;
+        uint64_t joined_generation{0};
+        std::unique_lock<std::mutex> lock{mutex_};
+        while (true) {
+            work_cv_.wait(lock, [this, &joined_generation]() {
+                return stop_ || (generation_ != joined_generation && joined_count_ < helper_count_);
+            });
+            if (stop_) {
+                return;
+            }
+            joined_generation = generation_;
+            ++joined_count_;
+            lock.unlock();
+            RunChunks();
+            lock.lock();
+            if (--running_count_ == 0) {
+                done_cv_.notify_one();
+            }
+        }
+    }
+
+    // Held by the thread running a loop on the pool.
+    std::mutex run_mutex_;
+
+    // Guards the members below, except for next_chunk_.
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    uint64_t generation_{0};
+    const std::function<void(int64_t)>* run_chunk_{nullptr};
+    int64_t chunk_count_{0};
+    std::atomic<int64_t> next_chunk_{0};
+    // Number of workers which may join the current loop, which have joined it and which have joined it or may still join it but have not
+    // finished.
+    int64_t helper_count_{0};
+    int64_t joined_count_{0};
+    int64_t running_count_{0};
+    bool stop_{false};
+
+    std::vector<std::thread> workers_;
+};
+
+ThreadPool& GetThreadPool() {
+    static ThreadPool pool{GetNativeThreadCount() - 1};
+    return pool;
+}
+
+}  // namespace
+
+size_t GetNativeThreadCount() {
+    static const size_t thread_count = []() -> size_t {
+        if (absl::optional<std::string> env = GetEnv(kNativeThreadCountEnvVarName)) {
+            return ParseNativeThreadCount(*env);
+        }
+        return std::max(1U, std::thread::hardware_concurrency());
+    }();
+    return thread_count;
+}
+
+int64_t GetParallelChunkCount(int64_t size, int64_t grain_size) {
+    int64_t max_chunk_count = std::max(int64_t{1}, size / std::max(int64_t{1}, grain_size));
+    return std::min(static_cast<int64_t>(GetNativeThreadCount()), max_chunk_count);
+}
+
+void ParallelFor(int64_t size, int64_t grain_size, const std::function<void(int64_t, int64_t)>& func) {
+    if (size <= 0) {
+        return;
+    }
+    int64_t chunk_count = t_in_parallel_for ? 1 : GetParallelChunkCount(size, grain_size);
+    if (chunk_count == 1) {
+        func(0, size);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(chunk_count);
+    std::function<void(int64_t)> run_chunk = [size, chunk_count, &func, &errors](int64_t chunk) {
+        try {
+            func(size * chunk / chunk_count, size * (chunk + 1) / chunk_count);
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+    bool ran_in_parallel{false};
+    {
+        ParallelForScope scope{};
+        ran_in_parallel = GetThreadPool().TryRun(chunk_count, run_chunk);
+    }
+    if (!ran_in_parallel) {
+        func(0, size);
+        return;
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace chainerx {
+namespace native {
+
+// Environment variable which limits the number of threads the native kernels run on.
+constexpr const char* kNativeThreadCountEnvVarName = "CHAINERX_NATIVE_THREAD_COUNT";
+
+// Returns the number of threads the native kernels may run on, which defaults to the number of hardware threads.
+// ChainerxError is thrown if the environment variable is not a positive integer.
+size_t GetNativeThreadCount();
+
+// Number of elements, or of operations on them, below which a chunk of a loop is not worth a thread.
+// Kernels derive the grain size of their loops from it by dividing it by the work of an iteration.
+constexpr int64_t kParallelGrainSize = int64_t{1} << 15;
+
+// Returns the number of chunks ParallelFor splits a loop of the given size into.
+int64_t GetParallelChunkCount(int64_t size, int64_t grain_size);
+
+// Calls func(begin, end) for consecutive chunks covering [0, size) on the calling thread and a pool of persistent worker threads.
+// Chunks have at least grain_size iterations, so that short loops run on the calling thread only.
+// Calls nested in func, and calls made while the pool is busy with a loop of another thread, run serially on the calling thread.
+void ParallelFor(int64_t size, int64_t grain_size, const std::function<void(int64_t, int64_t)>& func);
+
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,218 @@
+#include "chainerx/native/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace native {
+namespace {
+
+// Returns the chunks ParallelFor calls the function with, sorted by their beginnings.
+std::vector<std::pair<int64_t, int64_t>> GetChunks(int64_t size, int64_t grain_size) {
+    std::mutex mutex;
+    std::vector<std::pair<int64_t, int64_t>> chunks;
+    ParallelFor(size, grain_size, [&mutex, &chunks](int64_t begin, int64_t end) {
+        std::lock_guard<std::mutex> lock{mutex};
+        chunks.emplace_back(begin, end);
+    });
+    std::sort(chunks.begin(), chunks.end());
+    return chunks;
+}
+
+// Blocks threads until it is opened.
+class Gate {
+public:
+    void Open() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            open_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    void Wait() {
+        std::unique_lock<std::mutex> lock{mutex_};
+        cv_.wait(lock, [this]() { return open_; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool open_{false};
+};
+
+TEST(ParallelForTest, VisitEveryIndexOnce) {
+    for (int64_t size : {1, 2, 3, 7, 100, 1001}) {
+        for (int64_t grain_size : {1, 2, 10, 1000}) {
+            std::vector<std::atomic<int>> visits(size);
+            for (std::atomic<int>& visit : visits) {
+                visit.store(0);
+            }
+            ParallelFor(size, grain_size, [&visits](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    ++visits[i];
+                }
+            });
+            for (int64_t i = 0; i < size; ++i) {
+                EXPECT_EQ(1, visits[i].load()) << "size: " << size << ", grain size: " << grain_size << ", index: " << i;
+            }
+
+            // The chunks are consecutive and as many as GetParallelChunkCount tells.
+            std::vector<std::pair<int64_t, int64_t>> chunks = GetChunks(size, grain_size);
+            ASSERT_EQ(GetParallelChunkCount(size, grain_size), static_cast<int64_t>(chunks.size()));
+            int64_t next = 0;
+            for (const std::pair<int64_t, int64_t>& chunk : chunks) {
+                EXPECT_EQ(next, chunk.first);
+                EXPECT_LT(chunk.first, chunk.second);
+                next = chunk.second;
+            }
+            EXPECT_EQ(size, next);
+        }
+    }
+}
+
+TEST(ParallelForTest, Empty) {
+    int call_count = 0;
+    ParallelFor(0, 1, [&call_count](int64_t /*begin*/, int64_t /*end*/) { ++call_count; });
+    ParallelFor(-1, 1, [&call_count](int64_t /*begin*/, int64_t /*end*/) { ++call_count; });
+    EXPECT_EQ(0, call_count);
+}
+
+TEST(ParallelForTest, GrainLargerThanSize) {
+    // The whole loop runs as a single chunk on the calling thread.
+    std::thread::id caller_id = std::this_thread::get_id();
+    std::vector<std::pair<int64_t, int64_t>> chunks;
+    ParallelFor(100, 101, [&chunks, caller_id](int64_t begin, int64_t end) {
+        EXPECT_EQ(caller_id, std::this_thread::get_id());
+        chunks.emplace_back(begin, end);
+    });
+    ASSERT_EQ(size_t{1}, chunks.size());
+    EXPECT_EQ(0, chunks[0].first);
+    EXPECT_EQ(100, chunks[0].second);
+    EXPECT_EQ(1, GetParallelChunkCount(100, 101));
+}
+
+TEST(ParallelForTest, Nested) {
+    // A loop nested in a chunk runs as a single chunk on the thread of the outer chunk.
+    constexpr int64_t kSize = 64;
+    std::vector<std::atomic<int>> visits(kSize * kSize);
+    for (std::atomic<int>& visit : visits) {
+        visit.store(0);
+    }
+    std::atomic<int> nested_chunk_count{0};
+    ParallelFor(kSize, 1, [&visits, &nested_chunk_count](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            std::thread::id outer_id = std::this_thread::get_id();
+            ParallelFor(kSize, 1, [&visits, &nested_chunk_count, i, outer_id](int64_t nested_begin, int64_t nested_end) {
+                EXPECT_EQ(outer_id, std::this_thread::get_id());
+                EXPECT_EQ(0, nested_begin);
+                EXPECT_EQ(int64_t{kSize}, nested_end);
+                ++nested_chunk_count;
+                for (int64_t j = nested_begin; j < nested_end; ++j) {
+                    ++visits[i * kSize + j];
+                }
+            });
+        }
+    });
+    EXPECT_EQ(kSize, nested_chunk_count.load());
+    for (const std::atomic<int>& visit : visits) {
+        EXPECT_EQ(1, visit.load());
+    }
+}
+
+TEST(ParallelForTest, SerialWhileBusy) {
+    if (GetNativeThreadCount() < 2) {
+        // A single thread never runs a loop on the pool.
+        return;
+    }
+
+    // Keep the pool busy with a loop of another thread until the loop of this thread has finished.
+    Gate started{};
+    Gate finished{};
+    std::atomic<bool> is_first_chunk{true};
+    std::thread other{[&started, &finished, &is_first_chunk]() {
+        ParallelFor(2, 1, [&started, &finished, &is_first_chunk](int64_t /*begin*/, int64_t /*end*/) {
+            if (is_first_chunk.exchange(false)) {
+                started.Open();
+                finished.Wait();
+            }
+        });
+    }};
+    started.Wait();
+
+    std::thread::id caller_id = std::this_thread::get_id();
+    std::vector<std::pair<int64_t, int64_t>> chunks;
+    ParallelFor(100, 1, [&chunks, caller_id](int64_t begin, int64_t end) {
+        EXPECT_EQ(caller_id, std::this_thread::get_id());
+        chunks.emplace_back(begin, end);
+    });
+    finished.Open();
+    other.join();
+
+    ASSERT_EQ(size_t{1}, chunks.size());
+    EXPECT_EQ(0, chunks[0].first);
+    EXPECT_EQ(100, chunks[0].second);
+}
+
+TEST(ParallelForTest, Throw) {
+    // The exception is rethrown on the calling thread after all chunks have finished.
+    constexpr int64_t kSize = 100;
+    std::atomic<int64_t> visit_count{0};
+    EXPECT_THROW(
+            ParallelFor(
+                    kSize,
+                    1,
+                    [&visit_count](int64_t begin, int64_t end) {
+                        visit_count += end - begin;
+                        if (begin == 0) {
+                            throw std::runtime_error{"chunk"};
+                        }
+                    }),
+            std::runtime_error);
+    EXPECT_EQ(kSize, visit_count.load());
+
+    // The pool is still usable.
+    std::vector<std::pair<int64_t, int64_t>> chunks = GetChunks(kSize, 1);
+    EXPECT_EQ(GetParallelChunkCount(kSize, 1), static_cast<int64_t>(chunks.size()));
+}
+
+TEST(ParallelForTest, ConcurrentCallers) {
+    // Loops of several threads run either on the pool or serially, each visiting all of its own indices.
+    constexpr int kThreadCount = 4;
+    constexpr int kRepeatCount = 50;
+    constexpr int64_t kSize = 1000;
+    std::vector<std::vector<int>> visits(kThreadCount, std::vector<int>(kSize));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&visits, t]() {
+            for (int repeat = 0; repeat < kRepeatCount; ++repeat) {
+                ParallelFor(kSize, 10, [&visits, t](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        ++visits[t][i];
+                    }
+                });
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const std::vector<int>& thread_visits : visits) {
+        for (int visit : thread_visits) {
+            EXPECT_EQ(kRepeatCount, visit);
+        }
+    }
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
 #include "chainerx/array.h"
+#include "chainerx/axes.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/data_type.h"
+#include "chainerx/native/static_ndim.h"
 #include "chainerx/reduction_kernel_arg.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
@@ -23,18 +27,18 @@ constexpr int64_t ExpandLen = 4;
 // Must be a power of 2.
 constexpr int64_t SerialLen = 8;
 
-template <typename In, typename ReductionImpl, int8_t InNdim, typename T, int64_t n>
+template <typename In, typename ReductionImpl, typename Input, typename Iterator, typename T, int64_t n>
 struct ExpandedPairwiseReduction {
-    static T run(const IndexableArray<const In, InNdim>& in, IndexIterator<InNdim>& it_in, ReductionImpl&& impl, int64_t& i_reduce) {
-        T accum = ExpandedPairwiseReduction<In, ReductionImpl, InNdim, T, n / 2>::run(in, it_in, impl, i_reduce);
-        impl.Reduce(ExpandedPairwiseReduction<In, ReductionImpl, InNdim, T, n / 2>::run(in, it_in, impl, i_reduce), accum);
+    static T run(const Input& in, Iterator& it_in, ReductionImpl&& impl, int64_t& i_reduce) {
+        T accum = ExpandedPairwiseReduction<In, ReductionImpl, Input, Iterator, T, n / 2>::run(in, it_in, impl, i_reduce);
+        impl.Reduce(ExpandedPairwiseReduction<In, ReductionImpl, Input, Iterator, T, n / 2>::run(in, it_in, impl, i_reduce), accum);
         return accum;
     }
 };
 
-template <typename In, typename ReductionImpl, int8_t InNdim, typename T>
-struct ExpandedPairwiseReduction<In, ReductionImpl, InNdim, T, 1> {
-    static T run(const IndexableArray<const In, InNdim>& in, IndexIterator<InNdim>& it_in, ReductionImpl&& impl, int64_t& i_reduce) {
+template <typename In, typename ReductionImpl, typename Input, typename Iterator, typename T>
+struct ExpandedPairwiseReduction<In, ReductionImpl, Input, Iterator, T, 1> {
+    static T run(const Input& in, Iterator& it_in, ReductionImpl&& impl, int64_t& i_reduce) {
         T accum = impl.MapIn(native_internal::StorageToDataType<const In>(in[it_in]), i_reduce);
         ++it_in, ++i_reduce;
         return accum;
@@ -43,8 +47,10 @@ struct ExpandedPairwiseReduction<In, ReductionImpl, InNdim, T, 1> {
 
 constexpr int log2(int64_t v) { return v == 1 ? 0 : log2(v >> 1) + 1; }
 
-template <typename In, typename ReductionImpl, int8_t InNdim, typename T>
-T PairwiseReduction(const IndexableArray<const In, InNdim>& in, IndexIterator<InNdim>& it_in, ReductionImpl&& impl, int64_t reduce_len) {
+// Reduces reduce_len elements of the input starting from it_in.
+// Input is either IndexableArray with Iterator being IndexIterator, or ContiguousInput with Iterator being ContiguousInputIterator.
+template <typename In, typename T, typename ReductionImpl, typename Input, typename Iterator>
+T PairwiseReduction(const Input& in, Iterator& it_in, ReductionImpl&& impl, int64_t reduce_len) {
     int64_t i_reduce = 0;
     T accum = impl.Identity();
 
@@ -62,7 +68,7 @@ T PairwiseReduction(const IndexableArray<const In, InNdim>& in, IndexIterator<In
             accum = impl.Identity();
         }
         // This increments `i_reduce` by `ExpandLen`.
-        impl.Reduce(ExpandedPairwiseReduction<In, ReductionImpl, InNdim, T, ExpandLen>::run(in, it_in, impl, i_reduce), accum);
+        impl.Reduce(ExpandedPairwiseReduction<In, ReductionImpl, Input, Iterator, T, ExpandLen>::run(in, it_in, impl, i_reduce), accum);
     }
 
     // Accumulate residuals.
@@ -90,11 +96,124 @@ void ReductionKernel(ReductionKernelArg<In, Out, InNdim, OutNdim> arg, Reduction
     // Iterate over output dimensions
     for (auto it_out = arg.out_indexer.It(0); it_out; ++it_out) {
         it_in.Restart(it_out.raw_index());
-        auto accum = PairwiseReduction<In, ReductionImpl, InNdim, decltype(impl.Identity())>(arg.in, it_in, impl, reduce_len);
+        auto accum = PairwiseReduction<In, decltype(impl.Identity())>(arg.in, it_in, impl, reduce_len);
         arg.out[it_out] = native_internal::DataToStorageType<Out>(impl.MapOut(accum));
     }
 }
 
+// Same as ReductionKernel(), but also stores the result of MapOut2() to the second output, which has the same layout as the first output
+// in terms of elements.
+template <typename In, typename Out, typename Out2, typename ReductionImpl, int8_t InNdim = kDynamicNdim, int8_t OutNdim = kDynamicNdim>
+void ReductionKernel(
+        ReductionKernelArg<In, Out, InNdim, OutNdim> arg, const Array& out2, const Strides& out2_strides, ReductionImpl&& impl) {
+    IndexableArray<Out2, OutNdim> out2_iarray{out2, out2_strides};
+    auto it_in = arg.in_indexer.It(0, arg.out_indexer.total_size());
+    int64_t reduce_len = arg.in_indexer.total_size() / arg.out_indexer.total_size();
+
+    // Iterate over output dimensions
+    for (auto it_out = arg.out_indexer.It(0); it_out; ++it_out) {
+        it_in.Restart(it_out.raw_index());
+        auto accum = PairwiseReduction<In, decltype(impl.Identity())>(arg.in, it_in, impl, reduce_len);
+        arg.out[it_out] = native_internal::DataToStorageType<Out>(impl.MapOut(accum));
+        out2_iarray[it_out] = native_internal::DataToStorageType<Out2>(impl.MapOut2(accum));
+    }
+}
+
+// Pointer to an element of a contiguous input, used in place of IndexIterator.
+template <typename In>
+struct ContiguousInputIterator {
+    ContiguousInputIterator& operator++() {
+        ++ptr;
+        return *this;
+    }
+
+    const native_internal::StorageType<In>* ptr;
+};
+
+// Contiguous input accessed by plain pointers, used in place of IndexableArray.
+template <typename In>
+struct ContiguousInput {
+    const native_internal::StorageType<In>& operator[](const ContiguousInputIterator<In>& it) const { return *it.ptr; }
+};
+
+// Returns true if the elements reduced into each output element are contiguous in the input and the output is contiguous, so that the
+// reduction can be computed with plain pointers without indexers. This covers the full reduction and the reduction over the trailing
+// axes of contiguous arrays.
+template <typename In, typename Out>
+bool IsContiguousReduction(const ReductionArg& arg) {
+    const Shape& in_shape = arg.in_shape();
+    const Strides& in_strides = arg.in_strides();
+    const Strides& out_strides = arg.out_strides();
+    constexpr int64_t in_item_size = sizeof(native_internal::StorageType<In>);
+    constexpr int64_t out_item_size = sizeof(native_internal::StorageType<Out>);
+
+    // The squashed input has the reduced axes first, followed by the axes of the output.
+    switch (arg.out_shape().ndim()) {
+        case 0:
+            return in_shape.ndim() == 1 && in_strides[0] == in_item_size;
+        case 1:
+            return in_shape.ndim() == 2 && in_strides[0] == in_item_size && in_strides[1] == in_item_size * in_shape[0] &&
+                   out_strides[0] == out_item_size;
+        default:
+            return false;
+    }
+}
+
+// Reduction kernel for the layouts accepted by IsContiguousReduction().
+template <typename In, typename Out, typename ReductionImpl>
+void ContiguousReductionKernel(const ReductionArg& arg, ReductionImpl&& impl) {
+    auto in_ptr = static_cast<const native_internal::StorageType<In>*>(internal::GetRawOffsetData(arg.in()));
+    auto out_ptr = static_cast<native_internal::StorageType<Out>*>(internal::GetRawOffsetData(arg.out()));
+    int64_t reduce_len = arg.in_shape()[0];
+    int64_t out_size = arg.out_shape().GetTotalSize();
+
+    for (int64_t i = 0; i < out_size; ++i) {
+        ContiguousInputIterator<In> it_in{in_ptr + i * reduce_len};
+        auto accum = PairwiseReduction<In, decltype(impl.Identity())>(ContiguousInput<In>{}, it_in, impl, reduce_len);
+        out_ptr[i] = native_internal::DataToStorageType<Out>(impl.MapOut(accum));
+    }
+}
+
+// Same as ContiguousReductionKernel(), but also stores the result of MapOut2() to the contiguous second output.
+template <typename In, typename Out, typename Out2, typename ReductionImpl>
+void ContiguousReductionKernel(const ReductionArg& arg, const Array& out2, ReductionImpl&& impl) {
+    auto in_ptr = static_cast<const native_internal::StorageType<In>*>(internal::GetRawOffsetData(arg.in()));
+    auto out_ptr = static_cast<native_internal::StorageType<Out>*>(internal::GetRawOffsetData(arg.out()));
+    auto out2_ptr = static_cast<native_internal::StorageType<Out2>*>(internal::GetRawOffsetData(out2));
+    int64_t reduce_len = arg.in_shape()[0];
+    int64_t out_size = arg.out_shape().GetTotalSize();
+
+    for (int64_t i = 0; i < out_size; ++i) {
+        ContiguousInputIterator<In> it_in{in_ptr + i * reduce_len};
+        auto accum = PairwiseReduction<In, decltype(impl.Identity())>(ContiguousInput<In>{}, it_in, impl, reduce_len);
+        out_ptr[i] = native_internal::DataToStorageType<Out>(impl.MapOut(accum));
+        out2_ptr[i] = native_internal::DataToStorageType<Out2>(impl.MapOut2(accum));
+    }
+}
+
+// Calls the function with the reduction kernel argument, whose ndims are statically optimized if possible.
+template <typename In, typename Out, typename Func>
+void DispatchReductionKernelArg(const ReductionArg& arg, Func&& func) {
+    // Input ndims up to native_internal::kMaxStaticNdim and output ndims up to native_internal::kMaxStaticReductionOutNdim are
+    // statically optimized; both limits are configurable at build time. Squashing merges adjacent kept axes, so outputs rarely have
+    // more than two dimensions. Two-dimensional outputs come from reducing a middle axis, e.g. the channels of (N, C, H, W) in
+    // softmax or normalization over channels, which squashes to (C, N, H * W) -> (N, H * W). Larger output ndims fall back to the
+    // dynamic kernel instead of multiplying the instantiations.
+    bool dispatched = false;
+    native_internal::VisitStaticNdim<1, native_internal::kMaxStaticNdim>(arg.in_shape().ndim(), [&](auto in_ndim) {
+        constexpr int8_t kInNdim = decltype(in_ndim)::value;
+        constexpr int8_t kMaxOutNdim = std::min(kInNdim, native_internal::kMaxStaticReductionOutNdim);
+        dispatched = native_internal::VisitStaticNdim<0, kMaxOutNdim>(arg.out_shape().ndim(), [&](auto out_ndim) {
+            func(MakeReductionKernelArg<In, Out, kInNdim, decltype(out_ndim)::value>(arg));
+        });
+    });
+    if (dispatched) {
+        return;
+    }
+
+    func(MakeReductionKernelArg<In, Out>(arg));
+}
+
 template <typename In, typename Out, typename ReductionImpl, int8_t InNdim = kDynamicNdim, int8_t OutNdim = kDynamicNdim>
 void ScanKernel(ReductionKernelArg<In, Out, InNdim, OutNdim> arg, ReductionImpl&& impl, int64_t reduce_len) {
     int64_t len = arg.in_indexer.total_size() / reduce_len;
@@ -146,53 +265,44 @@ void Reduce(const Array& in, const Axes& axis, const Array& out, ReductionImpl&&
     }
 
     ReductionArg arg{in, axis, out};
+    if (reduce_detail::IsContiguousReduction<In, Out>(arg)) {
+        reduce_detail::ContiguousReductionKernel<In, Out>(arg, impl);
+        return;
+    }
+    reduce_detail::DispatchReductionKernelArg<In, Out>(arg, [&impl](auto kernel_arg) { reduce_detail::ReductionKernel(kernel_arg, impl); });
+}
 
-    // TODO(sonots): Reconsider the number of statically-optimized kernels in terms of speed and binary size trade-offs.
-    // Currently, we optimize for contiguous output arrays.
-    switch (arg.in_shape().ndim()) {
-        case 1:
-            switch (arg.out_shape().ndim()) {
-                case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 1, 0>(arg), impl);
-                    return;
-                case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 1, 1>(arg), impl);
-                    return;
-            }
-            break;
-        case 2:
-            switch (arg.out_shape().ndim()) {
-                case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 2, 0>(arg), impl);
-                    return;
-                case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 2, 1>(arg), impl);
-                    return;
-            }
-            break;
-        case 3:
-            switch (arg.out_shape().ndim()) {
-                case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 3, 0>(arg), impl);
-                    return;
-                case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 3, 1>(arg), impl);
-                    return;
-            }
-            break;
-        case 4:
-            switch (arg.out_shape().ndim()) {
-                case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 4, 0>(arg), impl);
-                    return;
-                case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 4, 1>(arg), impl);
-                    return;
-            }
-            break;
+// Computes a reduction with two outputs, e.g. a value and its index, in a single pass over the input.
+//
+// In addition to the member functions required by Reduce(), `ReductionImpl` is required to provide the following member function.
+//
+// - Out2 MapOut2(T accum);
+//       Applies post-reduction mapping of the second output.
+//
+// The outputs must be contiguous and have the same shape.
+template <typename In, typename Out, typename Out2, typename ReductionImpl>
+void Reduce(const Array& in, const Axes& axis, const Array& out, const Array& out2, ReductionImpl&& impl) {
+    CHAINERX_ASSERT(out.shape() == out2.shape());
+    CHAINERX_ASSERT(out.IsContiguous() && out2.IsContiguous());
+    if (out.GetTotalSize() == 0) {
+        return;
+    }
+
+    ReductionArg arg{in, axis, out};
+    if (reduce_detail::IsContiguousReduction<In, Out>(arg)) {
+        reduce_detail::ContiguousReductionKernel<In, Out, Out2>(arg, out2, impl);
+        return;
+    }
+
+    // The squashed strides of the first output are reused for the second one, scaled by the ratio of the item sizes.
+    Strides out2_strides{};
+    for (int64_t stride : arg.out_strides()) {
+        out2_strides.emplace_back(stride / static_cast<int64_t>(sizeof(Out)) * static_cast<int64_t>(sizeof(Out2)));
     }
 
-    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out>(arg), impl);
+    reduce_detail::DispatchReductionKernelArg<In, Out>(arg, [&impl, &out2, &out2_strides](auto kernel_arg) {
+        reduce_detail::ReductionKernel<In, Out, Out2>(kernel_arg, out2, out2_strides, impl);
+    });
 }
 
 template <typename In, typename Out, typename ReductionImpl>
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "chainerx/constant.h"
+
+// Maximum squashed ndim for which the native elementwise and reduction kernels are statically specialized.
+// Configured at build time with the CMake option of the same name.
+#ifndef CHAINERX_NATIVE_MAX_STATIC_NDIM
+#define CHAINERX_NATIVE_MAX_STATIC_NDIM 4
+#endif
+
+// Maximum squashed output ndim for which the native reduction kernels are statically specialized.
+#ifndef CHAINERX_NATIVE_MAX_STATIC_REDUCTION_OUT_NDIM
+#define CHAINERX_NATIVE_MAX_STATIC_REDUCTION_OUT_NDIM 1
+#endif
+
+namespace chainerx {
+namespace native {
+namespace native_internal {
+
+constexpr int8_t kMaxStaticNdim = CHAINERX_NATIVE_MAX_STATIC_NDIM;
+constexpr int8_t kMaxStaticReductionOutNdim = CHAINERX_NATIVE_MAX_STATIC_REDUCTION_OUT_NDIM;
+
+static_assert(0 <= kMaxStaticNdim && kMaxStaticNdim <= kMaxNdim, "Invalid CHAINERX_NATIVE_MAX_STATIC_NDIM.");
+static_assert(
+        0 <= kMaxStaticReductionOutNdim && kMaxStaticReductionOutNdim <= kMaxNdim,
+        "Invalid CHAINERX_NATIVE_MAX_STATIC_REDUCTION_OUT_NDIM.");
+
+template <int8_t MinNdim, int8_t Ndim, bool = (MinNdim <= Ndim)>
+struct StaticNdimVisitor {
+    template <typename Func>
+    static bool Visit(int8_t ndim, Func&& func) {
+        if (ndim == Ndim) {
+            func(std::integral_constant<int8_t, Ndim>{});
+            return true;
+        }
+        return StaticNdimVisitor<MinNdim, Ndim - 1>::Visit(ndim, std::forward<Func>(func));
+    }
+};
+
+template <int8_t MinNdim, int8_t Ndim>
+struct StaticNdimVisitor<MinNdim, Ndim, false> {
+    template <typename Func>
+    static bool Visit(int8_t /*ndim*/, Func&& /*func*/) {
+        return false;
+    }
+};
+
+// Calls func with std::integral_constant<int8_t, ndim> if MinNdim <= ndim <= MaxNdim and returns true.
+// Returns false without calling func otherwise, in which case the caller is expected to fall back to the kDynamicNdim kernel.
+// Every ndim in the range instantiates func, so the range should be kept as small as the profiled workloads allow.
+template <int8_t MinNdim, int8_t MaxNdim, typename Func>
+bool VisitStaticNdim(int8_t ndim, Func&& func) {
+    return StaticNdimVisitor<MinNdim, MaxNdim>::Visit(ndim, std::forward<Func>(func));
+}
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
@@ -2,60 +2,107 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <tuple>
+#include <utility>
 
+#include <absl/types/optional.h>
 #include <gsl/gsl>
 
 #include "chainerx/array.h"
+#include "chainerx/array_index.h"
 #include "chainerx/axes.h"
 #include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernels/arithmetic.h"
 #include "chainerx/kernels/linalg.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/shape.h"
+#include "chainerx/slice.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
 namespace {
 
-// Returns necessary data for TensorDot for one of the input arrays.
-// It is called for both inputs to TensorDot.
-//
-// It returns a tuple of:
-// 0. Permuted axes for transpose, moving axes to be reduced to either front or back of array axes.
-// 1. Non-reduced shape dimensions to be used in the output shape of TensorDot.
-std::tuple<Axes, Shape> GetTensorDotRollAxes(const Shape& shape, const Axes& reduce_axes, bool reduced_axes_first) {
+// Returns the axes of an array of the given ndim which are not to be reduced, in increasing order.
+Axes GetKeptAxes(int8_t ndim, const Axes& reduce_axes) {
     bool to_reduce[kMaxNdim]{};  // Initialized with false.
-    Shape remain_dims;
-    Axes roll_axes;
     for (int8_t i = 0; i < reduce_axes.ndim(); ++i) {
         gsl::at(to_reduce, reduce_axes[i]) = true;
     }
+    Axes kept_axes;
+    for (int8_t i = 0; i < ndim; ++i) {
+        if (!gsl::at(to_reduce, i)) {
+            kept_axes.emplace_back(i);
+        }
+    }
+    return kept_axes;
+}
 
-    // There are two steps:
-    // A. Insert axes to be reduced to roll_axes.
-    // B. Insert non-reduced axes to roll_axes.
-    // The order of these steps depends on reduced_axes_first.
-    for (int step = 0; step < 2; ++step) {
-        if ((step == 0) == reduced_axes_first) {
-            // Step A.
-            for (int8_t i = 0; i < shape.ndim(); ++i) {
-                if (gsl::at(to_reduce, i)) {
-                    roll_axes.emplace_back(i);
-                }
-            }
-        } else {
-            // Step B.
-            for (int8_t i = 0; i < shape.ndim(); ++i) {
-                if (!gsl::at(to_reduce, i)) {
-                    roll_axes.emplace_back(i);
-                    remain_dims.emplace_back(shape[i]);
-                }
-            }
+Axes DropFirstAxis(const Axes& axes) { return Axes{axes.begin() + 1, axes.end()}; }
+
+// Returns the length and the stride of a single axis which enumerates the given axes of the array in C-order, or absl::nullopt if there is
+// no such axis. Axes of length 1 are ignored. The stride is 0 if the length is at most 1, in which case any stride would do.
+absl::optional<std::pair<int64_t, int64_t>> MergeAxes(const Array& a, const Axes& axes) {
+    int64_t dim = 1;
+    int64_t stride = 0;
+    for (int8_t i = axes.ndim() - 1; i >= 0; --i) {
+        int64_t axis_dim = a.shape()[axes[i]];
+        if (axis_dim == 1) {
+            continue;
         }
+        int64_t axis_stride = a.strides()[axes[i]];
+        if (dim == 1) {
+            stride = axis_stride;
+        } else if (axis_stride != stride * dim) {
+            return absl::nullopt;
+        }
+        dim *= axis_dim;
     }
+    return std::make_pair(dim, stride);
+}
 
-    return std::make_tuple(roll_axes, remain_dims);
+// Returns a matrix view of the array, shifted by offset bytes, whose rows and columns enumerate row_axes and col_axes in C-order, or
+// absl::nullopt if the array cannot be viewed as such.
+// The native Dot kernel multiplies row-major and column-major matrices with arbitrary leading dimensions without copying them.
+absl::optional<Array> MakeMatrixView(const Array& a, const Axes& row_axes, const Axes& col_axes, int64_t offset) {
+    absl::optional<std::pair<int64_t, int64_t>> rows = MergeAxes(a, row_axes);
+    absl::optional<std::pair<int64_t, int64_t>> cols = MergeAxes(a, col_axes);
+    if (!rows.has_value() || !cols.has_value()) {
+        return absl::nullopt;
+    }
+
+    // Strides of axes of length 1 are chosen so that the view is row-major or column-major if the stride of the other axis allows it.
+    int64_t item_size = a.GetItemSize();
+    int64_t row_stride = rows->second;
+    int64_t col_stride = cols->second;
+    if (cols->first <= 1) {
+        col_stride = row_stride == item_size ? rows->first * item_size : item_size;
+    }
+    if (rows->first <= 1) {
+        row_stride = col_stride == item_size ? cols->first * item_size : item_size;
+    }
+    return internal::MakeArray(
+            Shape{rows->first, cols->first}, Strides{row_stride, col_stride}, a.dtype(), a.device(), a.data(), a.offset() + offset);
+}
+
+// Returns a matrix view of the array as MakeMatrixView does, copying the array if it cannot be viewed as such.
+Array MakeMatrix(const Array& a, const Axes& row_axes, const Axes& col_axes) {
+    if (a.GetTotalSize() > 0) {
+        if (absl::optional<Array> view = MakeMatrixView(a, row_axes, col_axes, 0)) {
+            return *view;
+        }
+    }
+    Axes axes = row_axes;
+    std::copy(col_axes.begin(), col_axes.end(), std::back_inserter(axes));
+    Shape shape{1, 1};
+    for (int8_t axis : row_axes) {
+        shape[0] *= a.shape()[axis];
+    }
+    for (int8_t axis : col_axes) {
+        shape[1] *= a.shape()[axis];
+    }
+    return a.Transpose(axes).Reshape(shape);
 }
 
 }  // namespace
@@ -65,36 +112,83 @@ Array TensorDot(const Array& a, const Array& b, const Axes& a_axis, const Axes&
     CHAINERX_ASSERT(a.ndim() >= a_axis.ndim());
     CHAINERX_ASSERT(b.ndim() >= b_axis.ndim());
     int8_t axis_ndim = a_axis.ndim();
-
-    // Compute the product of reduced dimensions and check that corresponding dimensions in a_axis and b_axis are of equal length.
-    int64_t axis_total_size = 1;
     for (int8_t i = 0; i < axis_ndim; ++i) {
-        int64_t a_dim = a.shape()[a_axis[i]];
-        CHAINERX_ASSERT(a_dim == b.shape()[b_axis[i]]);
-        axis_total_size *= a_dim;
-    }
-
-    // Compute necessary data for Dot and Reshape.
-    auto a_tup = GetTensorDotRollAxes(a.shape(), a_axis, false);
-    auto b_tup = GetTensorDotRollAxes(b.shape(), b_axis, true);
-    const Axes& a_roll_axes = std::get<0>(a_tup);
-    const Axes& b_roll_axes = std::get<0>(b_tup);
-    const Shape& a_remain_dims = std::get<1>(a_tup);
-    const Shape& b_remain_dims = std::get<1>(b_tup);
-    int64_t a_remain_total_size = a_remain_dims.GetTotalSize();
-    int64_t b_remain_total_size = b_remain_dims.GetTotalSize();
-    Shape a_shape{a_remain_total_size, axis_total_size};
-    Shape b_shape{axis_total_size, b_remain_total_size};
-
-    // Compute the dot product between a and b reshaped to 2-dimensions.
-    Shape dot_shape{a_remain_total_size, b_remain_total_size};
+        CHAINERX_ASSERT(a.shape()[a_axis[i]] == b.shape()[b_axis[i]]);
+    }
+
+    // The product is computed as a matrix product of a, with the kept axes as rows and the reduced axes as columns, and b, with the reduced
+    // axes as rows and the kept axes as columns.
+    Axes a_kept_axes = GetKeptAxes(a.ndim(), a_axis);
+    Axes b_kept_axes = GetKeptAxes(b.ndim(), b_axis);
+    Shape out_shape;
+    for (int8_t axis : a_kept_axes) {
+        out_shape.emplace_back(a.shape()[axis]);
+    }
+    for (int8_t axis : b_kept_axes) {
+        out_shape.emplace_back(b.shape()[axis]);
+    }
+    Shape dot_shape{1, 1};
+    for (int8_t axis : a_kept_axes) {
+        dot_shape[0] *= a.shape()[axis];
+    }
+    for (int8_t axis : b_kept_axes) {
+        dot_shape[1] *= b.shape()[axis];
+    }
     Array dot_out = Empty(dot_shape, out_dtype, a.device());
-    a.device().backend().CallKernel<DotKernel>(
-            a.Transpose(a_roll_axes).Reshape(a_shape), b.Transpose(b_roll_axes).Reshape(b_shape), dot_out);
+    Backend& backend = a.device().backend();
+
+    bool is_empty = a.GetTotalSize() == 0 || b.GetTotalSize() == 0;
+    absl::optional<Array> a_matrix = is_empty ? absl::nullopt : MakeMatrixView(a, a_kept_axes, a_axis, 0);
+    absl::optional<Array> b_matrix = is_empty ? absl::nullopt : MakeMatrixView(b, b_axis, b_kept_axes, 0);
+
+    // If a is not a matrix but each of its sub-arrays along the first kept axis is, e.g. the im2col patches of a convolution, multiply the
+    // sub-arrays one by one into consecutive blocks of rows of the output.
+    if (!is_empty && !a_matrix.has_value() && a_kept_axes.ndim() > 1) {
+        Axes a_inner_kept_axes = DropFirstAxis(a_kept_axes);
+        if (MakeMatrixView(a, a_inner_kept_axes, a_axis, 0).has_value()) {
+            Array b_whole = b_matrix.has_value() ? *b_matrix : MakeMatrix(b, b_axis, b_kept_axes);
+            int64_t a_batch_size = a.shape()[a_kept_axes[0]];
+            int64_t a_batch_stride = a.strides()[a_kept_axes[0]];
+            int64_t block_size = dot_shape[0] / a_batch_size;
+            for (int64_t i = 0; i < a_batch_size; ++i) {
+                Array a_block = *MakeMatrixView(a, a_inner_kept_axes, a_axis, i * a_batch_stride);
+                backend.CallKernel<DotKernel>(a_block, b_whole, dot_out.At({Slice{i * block_size, (i + 1) * block_size}}));
+            }
+            return dot_out.Reshape(out_shape);
+        }
+    }
+
+    // If a or b is not a matrix but each of their sub-arrays along the first reduced axis are, e.g. the gradient and the im2col patches in
+    // the weight gradient of a convolution, accumulate the products of the sub-arrays.
+    // The accumulation is only done in floating point dtypes in which the Dot kernel does not accumulate in a wider dtype.
+    if (!is_empty && (!a_matrix.has_value() || !b_matrix.has_value()) && axis_ndim > 1 &&
+        (out_dtype == Dtype::kFloat32 || out_dtype == Dtype::kFloat64)) {
+        Axes a_inner_axis = DropFirstAxis(a_axis);
+        Axes b_inner_axis = DropFirstAxis(b_axis);
+        if (MakeMatrixView(a, a_kept_axes, a_inner_axis, 0).has_value() && MakeMatrixView(b, b_inner_axis, b_kept_axes, 0).has_value()) {
+            int64_t batch_size = a.shape()[a_axis[0]];
+            int64_t a_batch_stride = a.strides()[a_axis[0]];
+            int64_t b_batch_stride = b.strides()[b_axis[0]];
+            Array partial = batch_size > 1 ? Empty(dot_shape, out_dtype, a.device()) : Array{};
+            for (int64_t i = 0; i < batch_size; ++i) {
+                Array a_block = *MakeMatrixView(a, a_kept_axes, a_inner_axis, i * a_batch_stride);
+                Array b_block = *MakeMatrixView(b, b_inner_axis, b_kept_axes, i * b_batch_stride);
+                if (i == 0) {
+                    backend.CallKernel<DotKernel>(a_block, b_block, dot_out);
+                } else {
+                    backend.CallKernel<DotKernel>(a_block, b_block, partial);
+                    backend.CallKernel<AddKernel>(dot_out, partial, dot_out);
+                }
+            }
+            return dot_out.Reshape(out_shape);
+        }
+    }
 
-    // Reshape and return the output array.
-    Shape out_shape = a_remain_dims;
-    std::copy(b_remain_dims.begin(), b_remain_dims.end(), std::back_inserter(out_shape));
+    // Otherwise, copy whichever of a and b is not a matrix.
+    backend.CallKernel<DotKernel>(
+            a_matrix.has_value() ? *a_matrix : MakeMatrix(a, a_kept_axes, a_axis),
+            b_matrix.has_value() ? *b_matrix : MakeMatrix(b, b_axis, b_kept_axes),
+            dot_out);
     return dot_out.Reshape(out_shape);
 }
 
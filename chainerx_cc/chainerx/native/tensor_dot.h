@@ -6,6 +6,10 @@
 namespace chainerx {
 namespace native {
 
+// Computes the tensor dot product of a and b, reducing the axes a_axis[i] of a and b_axis[i] of b for each i.
+// The output axes are the remaining axes of a followed by the remaining axes of b.
+// The inputs are not copied if each of them can be viewed as a matrix, or as a sequence of matrices along the first remaining axis of a or
+// along the first reduced axis.
 Array TensorDot(const Array& a, const Array& b, const Axes& a_axis, const Axes& b_axis, Dtype out_dtype);
 
 }  // namespace native
@@ -0,0 +1,196 @@
+#include "chainerx/native/tensor_dot.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernel_call_recording.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/shape.h"
+#include "chainerx/slice.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+class TensorDotTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+// Returns an array of small integers, whose products are summed exactly in all tested dtypes.
+Array MakeArray(const Shape& shape, Dtype dtype) { return Array{testing::BuildArray(shape).WithLinearData<int32_t>(-20)}.AsType(dtype); }
+
+// Returns the tensor dot product computed by the Dot routine from contiguous copies of the operands, with the kept axes of a, the reduced
+// axes and the kept axes of b moved to the front, the middle and the back respectively.
+Array ComputeExpected(const Array& a, const Array& b, const Axes& a_axis, const Axes& b_axis) {
+    Axes a_perm{};
+    Axes b_perm{b_axis};
+    Shape out_shape{};
+    Shape a_matrix_shape{1, 1};
+    Shape b_matrix_shape{1, 1};
+    for (int8_t i = 0; i < a.ndim(); ++i) {
+        if (std::find(a_axis.begin(), a_axis.end(), i) == a_axis.end()) {
+            a_perm.emplace_back(i);
+            out_shape.emplace_back(a.shape()[i]);
+            a_matrix_shape[0] *= a.shape()[i];
+        }
+    }
+    for (int8_t axis : a_axis) {
+        a_perm.emplace_back(axis);
+        a_matrix_shape[1] *= a.shape()[axis];
+        b_matrix_shape[0] *= a.shape()[axis];
+    }
+    for (int8_t i = 0; i < b.ndim(); ++i) {
+        if (std::find(b_axis.begin(), b_axis.end(), i) == b_axis.end()) {
+            b_perm.emplace_back(i);
+            out_shape.emplace_back(b.shape()[i]);
+            b_matrix_shape[1] *= b.shape()[i];
+        }
+    }
+    Array a_matrix = a.Transpose(a_perm).Copy().Reshape(a_matrix_shape);
+    Array b_matrix = b.Transpose(b_perm).Copy().Reshape(b_matrix_shape);
+    return Dot(a_matrix, b_matrix).Reshape(out_shape);
+}
+
+// Returns TensorDot(a, b, a_axis, b_axis, dtype) and the number of calls of each kernel it made.
+std::pair<Array, std::map<std::string, int64_t>> TensorDotWithKernelCalls(
+        const Array& a, const Array& b, const Axes& a_axis, const Axes& b_axis, Dtype dtype) {
+    KernelCallRecorder recorder{};
+    Array out{};
+    {
+        KernelCallRecordingScope scope{recorder};
+        out = TensorDot(a, b, a_axis, b_axis, dtype);
+    }
+    std::map<std::string, int64_t> counts;
+    for (const std::pair<KernelCallSignature, int64_t>& entry : recorder.GetProfile().GetHottest(std::numeric_limits<size_t>::max())) {
+        counts[entry.first.kernel_name] += entry.second;
+    }
+    return {out, counts};
+}
+
+TEST_F(TensorDotTest, MatrixView) {
+    // Merged contiguous kept axes.
+    Array a = MakeArray({2, 3, 4}, Dtype::kFloat32);
+    Array b = MakeArray({4, 5}, Dtype::kFloat32);
+    std::pair<Array, std::map<std::string, int64_t>> result = TensorDotWithKernelCalls(a, b, {2}, {0}, Dtype::kFloat32);
+    EXPECT_ARRAY_EQ(ComputeExpected(a, b, {2}, {0}), result.first);
+    EXPECT_EQ(1, result.second["Dot"]);
+    EXPECT_EQ(0, result.second["Copy"]);
+
+    // Transposed operands are viewed as column-major matrices.
+    Array at = MakeArray({5, 4}, Dtype::kFloat64).Transpose();
+    Array bt = MakeArray({3, 5}, Dtype::kFloat64).Transpose();
+    result = TensorDotWithKernelCalls(at, bt, {1}, {0}, Dtype::kFloat64);
+    EXPECT_ARRAY_EQ(ComputeExpected(at, bt, {1}, {0}), result.first);
+    EXPECT_EQ(1, result.second["Dot"]);
+    EXPECT_EQ(0, result.second["Copy"]);
+
+    // Strided rows.
+    Array as = MakeArray({8, 4}, Dtype::kFloat32).At({Slice{0, 8, 2}});
+    result = TensorDotWithKernelCalls(as, b.At({Slice{}, Slice{0, 3}}).Transpose(), {1}, {1}, Dtype::kFloat32);
+    EXPECT_ARRAY_EQ(ComputeExpected(as, b.At({Slice{}, Slice{0, 3}}).Transpose(), {1}, {1}), result.first);
+    EXPECT_EQ(1, result.second["Dot"]);
+}
+
+TEST_F(TensorDotTest, BatchOverFirstKeptAxis) {
+    // The im2col patches of a convolution, (batch, channel, k_1, k_2, out_1, out_2), and the weight, (out_channel, channel, k_1, k_2).
+    Array col = MakeArray({3, 2, 3, 2, 4, 5}, Dtype::kFloat32);
+    Array w = MakeArray({6, 2, 3, 2}, Dtype::kFloat32);
+    std::pair<Array, std::map<std::string, int64_t>> result = TensorDotWithKernelCalls(col, w, {1, 2, 3}, {1, 2, 3}, Dtype::kFloat32);
+    EXPECT_ARRAY_EQ(ComputeExpected(col, w, {1, 2, 3}, {1, 2, 3}), result.first);
+    EXPECT_EQ(3, result.second["Dot"]);
+    EXPECT_EQ(0, result.second["Copy"]);
+
+    // Every other batch of a larger array cannot be merged with the other kept axes either.
+    Array col_strided = MakeArray({6, 2, 3, 2, 4, 5}, Dtype::kFloat64).At({Slice{0, 6, 2}});
+    Array w64 = w.AsType(Dtype::kFloat64);
+    result = TensorDotWithKernelCalls(col_strided, w64, {1, 2, 3}, {1, 2, 3}, Dtype::kFloat64);
+    EXPECT_ARRAY_EQ(ComputeExpected(col_strided, w64, {1, 2, 3}, {1, 2, 3}), result.first);
+    EXPECT_EQ(3, result.second["Dot"]);
+    EXPECT_EQ(0, result.second["Copy"]);
+}
+
+TEST_F(TensorDotTest, AccumulateOverFirstReducedAxis) {
+    for (Dtype dtype : {Dtype::kFloat32, Dtype::kFloat64}) {
+        // The output gradient, (batch, out_channel, out_1, out_2), and the im2col patches in the weight gradient of a convolution.
+        Array gy = MakeArray({3, 6, 4, 5}, dtype);
+        Array col = MakeArray({3, 2, 3, 2, 4, 5}, dtype);
+        std::pair<Array, std::map<std::string, int64_t>> result = TensorDotWithKernelCalls(gy, col, {0, 2, 3}, {0, 4, 5}, dtype);
+        EXPECT_ARRAY_EQ(ComputeExpected(gy, col, {0, 2, 3}, {0, 4, 5}), result.first);
+        EXPECT_EQ(3, result.second["Dot"]);
+        EXPECT_EQ(2, result.second["Add"]);
+        EXPECT_EQ(0, result.second["Copy"]);
+
+        // The output gradient as a transpose of (batch, out_1, out_2, out_channel).
+        Array gy_transposed = MakeArray({3, 4, 5, 6}, dtype).Transpose({0, 3, 1, 2});
+        result = TensorDotWithKernelCalls(gy_transposed, col, {0, 2, 3}, {0, 4, 5}, dtype);
+        EXPECT_ARRAY_EQ(ComputeExpected(gy_transposed, col, {0, 2, 3}, {0, 4, 5}), result.first);
+        EXPECT_EQ(3, result.second["Dot"]);
+        EXPECT_EQ(2, result.second["Add"]);
+        EXPECT_EQ(0, result.second["Copy"]);
+    }
+}
+
+TEST_F(TensorDotTest, CopyNonMatrix) {
+    // Products of integers are not accumulated, so the operands which are not matrices are copied.
+    Array gy = MakeArray({3, 6, 4, 5}, Dtype::kInt32);
+    Array col = MakeArray({3, 2, 3, 2, 4, 5}, Dtype::kInt32);
+    std::pair<Array, std::map<std::string, int64_t>> result = TensorDotWithKernelCalls(gy, col, {0, 2, 3}, {0, 4, 5}, Dtype::kInt32);
+    EXPECT_ARRAY_EQ(ComputeExpected(gy, col, {0, 2, 3}, {0, 4, 5}), result.first);
+    EXPECT_EQ(1, result.second["Dot"]);
+    EXPECT_LT(0, result.second["Copy"]);
+
+    // Neither the whole transposed array nor its sub-arrays along the first reduced axis are matrices.
+    Array a = MakeArray({2, 2, 2, 3}, Dtype::kFloat32).Transpose();
+    Array b = MakeArray({2, 2, 2, 4}, Dtype::kFloat32);
+    result = TensorDotWithKernelCalls(a, b, {1, 2, 3}, {0, 1, 2}, Dtype::kFloat32);
+    EXPECT_ARRAY_EQ(ComputeExpected(a, b, {1, 2, 3}, {0, 1, 2}), result.first);
+    EXPECT_EQ(1, result.second["Dot"]);
+    EXPECT_LT(0, result.second["Copy"]);
+}
+
+TEST_F(TensorDotTest, PermutedAxes) {
+    Array a = testing::BuildArray({2, 3, 4}).WithLinearData<float>();
+    Array b = testing::BuildArray({4, 3}).WithLinearData<float>();
+    Array e = testing::BuildArray({2}).WithData<float>({440, 1232});
+    // The pairs of reduced axes may be given in any order.
+    EXPECT_ARRAY_EQ(e, TensorDot(a, b, {2, 1}, {0, 1}, Dtype::kFloat32));
+    EXPECT_ARRAY_EQ(e, TensorDot(a, b, {1, 2}, {1, 0}, Dtype::kFloat32));
+
+    // The reduced axes of a transposed a, which are in the reverse order in memory.
+    Array a_transposed = Array{testing::BuildArray({4, 3, 2}).WithLinearData<float>()}.Transpose();
+    EXPECT_ARRAY_EQ(
+            testing::BuildArray({2}).WithData<float>({1012, 1078}), TensorDot(a_transposed, b, {2, 1}, {0, 1}, Dtype::kFloat32));
+
+    // Reduced axes paired in the reverse order, with kept axes on both sides.
+    Array c = testing::BuildArray({3, 2, 2}).WithLinearData<double>();
+    Array d = testing::BuildArray({2, 2, 3}).WithLinearData<double>();
+    EXPECT_ARRAY_EQ(
+            testing::BuildArray({3, 3}).WithData<double>({39, 45, 51, 111, 133, 155, 183, 221, 259}),
+            TensorDot(c, d, {1, 2}, {1, 0}, Dtype::kFloat64));
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -1,7 +1,12 @@
 #include "chainerx/numerical_gradient.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
+#include <thread>
 #include <vector>
 
 #include "chainerx/array.h"
@@ -17,6 +22,7 @@
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/scalar.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 namespace numerical_gradient_internal {
@@ -63,8 +69,138 @@ Scalar Get(const Array& out, int64_t flat_index) {
     });
 }
 
+namespace {
+
+// Returns the numerical gradient of an input element from the outputs evaluated with the element displaced by -eps and +eps.
+Scalar ComputeGradElement(const Arrays& ys0, const Arrays& ys1, const Arrays& grad_outputs, Scalar eps_scalar, Dtype dtype) {
+    Scalar g{0, GetKind(dtype)};
+    for (size_t j = 0; j < grad_outputs.size(); ++j) {
+        Array dy = ys1.at(j) - ys0.at(j);
+        Array denom = FullLike(dy, eps_scalar) * FullLike(dy, Scalar{2, GetKind(dtype)});
+
+        Array slope = dy / denom;
+        g = g + AsScalar((slope * grad_outputs.at(j)).Sum().AsType(dtype));
+    }
+    return g;
+}
+
+// Computes the gradients of the elements of the i_in-th input whose flat indices are taken from next_index.
+// The target input is copied once and each perturbed element is restored in place after the evaluation.
+void ComputeGradElements(
+        const std::function<Arrays(const Arrays&)>& func,
+        const Arrays& xs,
+        const Arrays& grad_outputs,
+        int i_in,
+        const std::vector<Scalar>& eps_values,
+        std::vector<Scalar>& grad_values,
+        std::atomic<int64_t>& next_index) {
+    Arrays xs_copy = xs;  // shallow copy
+    Array& xi = xs_copy.at(i_in);
+    // Only the target array is deeply copied
+    xi = xi.Copy();
+    Dtype dtype = xi.dtype();
+    int64_t size = xi.GetTotalSize();
+
+    // Outputs sharing the buffer with the perturbed input would be overwritten by the next displacement.
+    auto eval = [&func, &xs_copy, &xi]() -> Arrays {
+        Arrays ys = func(xs_copy);
+        for (Array& y : ys) {
+            if (y.data() == xi.data()) {
+                y = y.Copy();
+            }
+        }
+        return ys;
+    };
+
+    for (int64_t in_flat_index = next_index++; in_flat_index < size; in_flat_index = next_index++) {
+        Scalar eps_scalar = eps_values[in_flat_index];
+        Scalar x = Get(xi, in_flat_index);
+        // Give displacement and evaluate
+        Set(xi, in_flat_index, x + Scalar{static_cast<float>(eps_scalar) * -1});
+        Arrays ys0 = eval();
+        Set(xi, in_flat_index, x + Scalar{static_cast<float>(eps_scalar) * 1});
+        Arrays ys1 = eval();
+        Set(xi, in_flat_index, x);
+
+        grad_values[in_flat_index] = ComputeGradElement(ys0, ys1, grad_outputs, eps_scalar, dtype);
+    }
+}
+
+// Same as ComputeGradElements(), but evaluates batch_size elements in each call of the function.
+// Every input is stacked 2 * batch_size times along a new leading axis, where the slices 2k and 2k + 1 of the target input have the k-th
+// element of the batch displaced by -eps and +eps, respectively.
+void ComputeGradElementsBatched(
+        const std::function<Arrays(const Arrays&)>& func,
+        const Arrays& xs,
+        const Arrays& grad_outputs,
+        int i_in,
+        const std::vector<Scalar>& eps_values,
+        std::vector<Scalar>& grad_values,
+        std::atomic<int64_t>& next_index,
+        int64_t batch_size) {
+    Dtype dtype = xs.at(i_in).dtype();
+    int64_t size = xs.at(i_in).GetTotalSize();
+
+    Arrays xs_stacked;
+    xs_stacked.reserve(xs.size());
+    for (const Array& x : xs) {
+        Shape stacked_shape = x.shape();
+        stacked_shape.insert(stacked_shape.begin(), 2 * batch_size);
+        // Inputs other than the target are broadcast without copies.
+        xs_stacked.emplace_back(BroadcastTo(ExpandDims(x, 0), stacked_shape));
+    }
+    Array& xi = xs_stacked.at(i_in);
+    xi = xi.Copy();
+
+    for (int64_t begin = next_index.fetch_add(batch_size); begin < size; begin = next_index.fetch_add(batch_size)) {
+        int64_t end = std::min(begin + batch_size, size);
+
+        std::vector<Scalar> x_values;
+        x_values.reserve(end - begin);
+        for (int64_t in_flat_index = begin; in_flat_index < end; ++in_flat_index) {
+            int64_t k = in_flat_index - begin;
+            Scalar eps_scalar = eps_values[in_flat_index];
+            Scalar x = Get(xs.at(i_in), in_flat_index);
+            Set(xi, 2 * k * size + in_flat_index, x + Scalar{static_cast<float>(eps_scalar) * -1});
+            Set(xi, (2 * k + 1) * size + in_flat_index, x + Scalar{static_cast<float>(eps_scalar) * 1});
+            x_values.emplace_back(x);
+        }
+
+        Arrays ys = func(xs_stacked);
+        for (const Array& y : ys) {
+            if (y.ndim() == 0 || y.shape()[0] != 2 * batch_size) {
+                throw ChainerxError{"Output of a batched function must be stacked ", 2 * batch_size, " times along the first axis: ", y.shape()};
+            }
+        }
+
+        for (int64_t in_flat_index = begin; in_flat_index < end; ++in_flat_index) {
+            int64_t k = in_flat_index - begin;
+            Arrays ys0;
+            Arrays ys1;
+            for (const Array& y : ys) {
+                ys0.emplace_back(y.At({2 * k}));
+                ys1.emplace_back(y.At({2 * k + 1}));
+            }
+            grad_values[in_flat_index] = ComputeGradElement(ys0, ys1, grad_outputs, eps_values[in_flat_index], dtype);
+        }
+
+        // Restore the displaced elements, which is cheaper than copying the stacked input again.
+        for (int64_t in_flat_index = begin; in_flat_index < end; ++in_flat_index) {
+            int64_t k = in_flat_index - begin;
+            Set(xi, 2 * k * size + in_flat_index, x_values[k]);
+            Set(xi, (2 * k + 1) * size + in_flat_index, x_values[k]);
+        }
+    }
+}
+
+}  // namespace
+
 Arrays CalculateNumericalGradient(
-        std::function<Arrays(const Arrays&)> func, const Arrays& inputs, const Arrays& grad_outputs, const Arrays& eps) {
+        std::function<Arrays(const Arrays&)> func,
+        const Arrays& inputs,
+        const Arrays& grad_outputs,
+        const Arrays& eps,
+        const NumericalGradientOptions& options) {
     // TODO(niboshi): Currently only elementwise functions are supported.
     // TODO(niboshi): Implement arithmetic operations and avoid manual synchronize
     NoBackpropModeScope scope{};
@@ -74,7 +210,6 @@ Arrays CalculateNumericalGradient(
     SynchronizeArrays(eps);
 
     const int nin = inputs.size();
-    const int nout = grad_outputs.size();
 
     std::vector<Array> xs;
     xs.reserve(inputs.size());
@@ -83,6 +218,12 @@ Arrays CalculateNumericalGradient(
     if (eps.size() != static_cast<size_t>(nin)) {
         throw ChainerxError{"Invalid number of eps arrays where number of inputs: ", nin, ", eps: ", eps.size()};
     }
+    if (options.thread_count < 1) {
+        throw ChainerxError{"Thread count of numerical gradient must be positive: ", options.thread_count};
+    }
+    if (options.batch_size < 1) {
+        throw ChainerxError{"Batch size of numerical gradient must be positive: ", options.batch_size};
+    }
 
     for (int i = 0; i < nin; ++i) {
         if (xs.at(i).shape() != eps.at(i).shape()) {
@@ -94,38 +235,66 @@ Arrays CalculateNumericalGradient(
         // TODO(niboshi): Check: eps must not contain zeros.
     }
 
-    auto eval = [&func, &xs](int i_in, int64_t in_flat_index, Scalar eps_scalar, float multiplier) mutable -> Arrays {
-        Arrays xs_copy = xs;  // shallow copy
-        Array& xi = xs_copy.at(i_in);
-        // Only the target array is deeply copied
-        xi = xi.Copy();
-        // Give displacement and evaluate
-        Set(xi, in_flat_index, Get(xi, in_flat_index) + Scalar{static_cast<float>(eps_scalar) * multiplier});
-        return func(xs_copy);
-    };
+    Context& context = GetDefaultContext();
+    Device& default_device = GetDefaultDevice();
 
     Arrays grads;
     for (int i = 0; i < nin; ++i) {
-        Array grad_i = ZerosLike(xs.at(i));
-        Dtype dtype = grad_i.dtype();
-        int64_t size = grad_i.GetTotalSize();
+        const Array& x = xs.at(i);
+        int64_t size = x.GetTotalSize();
 
+        std::vector<Scalar> eps_values;
+        eps_values.reserve(size);
         for (int64_t in_flat_index = 0; in_flat_index < size; ++in_flat_index) {
-            Scalar eps_scalar = Get(eps.at(i), in_flat_index);
-            Arrays ys0 = eval(i, in_flat_index, eps_scalar, -1);
-            Arrays ys1 = eval(i, in_flat_index, eps_scalar, 1);
-
-            for (int j = 0; j < nout; ++j) {
-                Array dy = ys1.at(j) - ys0.at(j);
-                Array denom = FullLike(dy, eps_scalar) * FullLike(dy, Scalar{2, GetKind(dtype)});
-
-                Array slope = (ys1.at(j) - ys0.at(j)) / denom;
-                Scalar g = AsScalar((slope * grad_outputs.at(j)).Sum().AsType(dtype));
-                Scalar g_ij = Get(grad_i, in_flat_index) + g;
-                Set(grad_i, in_flat_index, g_ij);
+            eps_values.emplace_back(Get(eps.at(i), in_flat_index));
+        }
+
+        std::vector<Scalar> grad_values(size, Scalar{0, GetKind(x.dtype())});
+        std::atomic<int64_t> next_index{0};
+        auto compute = [&func, &xs, &grad_outputs, i, &eps_values, &grad_values, &next_index, &options]() {
+            if (options.batch_size > 1) {
+                ComputeGradElementsBatched(func, xs, grad_outputs, i, eps_values, grad_values, next_index, options.batch_size);
+            } else {
+                ComputeGradElements(func, xs, grad_outputs, i, eps_values, grad_values, next_index);
+            }
+        };
+
+        size_t thread_count = std::min(options.thread_count, static_cast<size_t>(size));
+        if (thread_count <= 1) {
+            compute();
+        } else {
+            std::vector<std::exception_ptr> errors(thread_count);
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count);
+            for (size_t thread_index = 0; thread_index < thread_count; ++thread_index) {
+                threads.emplace_back([&context, &default_device, &compute, &errors, thread_index]() {
+                    SetDefaultContext(&context);
+                    SetDefaultDevice(&default_device);
+                    NoBackpropModeScope thread_scope{};
+                    try {
+                        compute();
+                    } catch (...) {
+                        errors[thread_index] = std::current_exception();
+                    }
+                });
             }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            for (const std::exception_ptr& error : errors) {
+                if (error != nullptr) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        // Gradients are gathered on the host and transferred at once.
+        Device& native_device = context.GetNativeBackend().GetDevice(0);
+        Array grad_i = Empty(x.shape(), x.dtype(), native_device);
+        for (int64_t in_flat_index = 0; in_flat_index < size; ++in_flat_index) {
+            Set(grad_i, in_flat_index, grad_values[in_flat_index]);
         }
-        grads.push_back(grad_i);
+        grads.push_back(grad_i.ToDevice(x.device()));
     }
 
     return grads;
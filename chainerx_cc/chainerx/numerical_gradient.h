@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -10,11 +13,27 @@ namespace numerical_gradient_internal {
 
 using Arrays = std::vector<Array>;
 
+struct NumericalGradientOptions {
+    // Number of threads evaluating perturbations in parallel. Each thread perturbs its own copy of the input.
+    // The function must be thread safe if more than one thread is used.
+    size_t thread_count{1};
+
+    // Number of perturbed elements evaluated in a single call of the function.
+    // If greater than 1, each input is given to the function stacked 2 * batch_size times along a new leading axis, and the function must
+    // return outputs stacked along the same axis, computing each slice independently of the others (e.g. elementwise functions).
+    int64_t batch_size{1};
+};
+
 Arrays CalculateNumericalGradient(
-        std::function<Arrays(const Arrays&)> func, const Arrays& inputs, const Arrays& grad_outputs, const Arrays& eps);
+        std::function<Arrays(const Arrays&)> func,
+        const Arrays& inputs,
+        const Arrays& grad_outputs,
+        const Arrays& eps,
+        const NumericalGradientOptions& options = {});
 
 }  // namespace numerical_gradient_internal
 
 using numerical_gradient_internal::CalculateNumericalGradient;
+using numerical_gradient_internal::NumericalGradientOptions;
 
 }  // namespace chainerx
@@ -35,20 +35,25 @@ public:
             const Arrays& center_inputs,
             const Arrays& grad_outputs,
             const Arrays& eps,
-            const Arrays& expected_grads) {
+            const Arrays& expected_grads,
+            const NumericalGradientOptions& options = {}) {
         size_t nin = center_inputs.size();
 
         auto checked_func = [&](const Arrays& inputs) -> Arrays {
             EXPECT_EQ(inputs.size(), nin) << "The number of inputs given to the function is wrong";
             for (size_t i = 0; i < center_inputs.size(); ++i) {
-                EXPECT_EQ(inputs[i].shape(), center_inputs[i].shape()) << "Shape of inputs given to the function is wrong";
+                Shape expected_shape = center_inputs[i].shape();
+                if (options.batch_size > 1) {
+                    expected_shape.insert(expected_shape.begin(), 2 * options.batch_size);
+                }
+                EXPECT_EQ(inputs[i].shape(), expected_shape) << "Shape of inputs given to the function is wrong";
                 EXPECT_EQ(inputs[i].dtype(), center_inputs[i].dtype()) << "Dtype of inputs given to the function is wrong";
             }
 
             return func(inputs);
         };
 
-        Arrays grads = CalculateNumericalGradient(checked_func, center_inputs, grad_outputs, eps);
+        Arrays grads = CalculateNumericalGradient(checked_func, center_inputs, grad_outputs, eps, options);
 
         EXPECT_EQ(grads.size(), expected_grads.size());
 
@@ -138,6 +143,78 @@ TEST_P(NumericalGradientTest, NumericalGradientMul) {
     CheckElementwiseNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads);
 }
 
+TEST_P(NumericalGradientTest, NumericalGradientMulParallel) {
+    using T = float;
+    Shape shape{2, 3};
+    std::vector<T> eps_data(shape.GetTotalSize(), 1e-3f);
+
+    Arrays inputs = {
+            testing::BuildArray(shape).WithLinearData<T>(-2.f, 0.5f),
+            testing::BuildArray(shape).WithLinearData<T>(1.f, 1.5f).WithPadding(1),
+    };
+    Arrays eps = {
+            testing::BuildArray(shape).WithData(eps_data),
+            testing::BuildArray(shape).WithData(eps_data),
+    };
+    Arrays grad_outputs = {
+            testing::BuildArray(shape).WithLinearData<T>(1.f, -0.5f),
+    };
+
+    auto forward = [](const Arrays& inputs) { return Arrays{inputs[0] * inputs[1]}; };
+
+    Arrays expected_grads = {inputs[1] * grad_outputs[0], inputs[0] * grad_outputs[0]};
+
+    CheckElementwiseNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads, NumericalGradientOptions{4});
+}
+
+TEST_P(NumericalGradientTest, NumericalGradientMulBatched) {
+    using T = float;
+    Shape shape{2, 3};
+    std::vector<T> eps_data(shape.GetTotalSize(), 1e-3f);
+
+    Arrays inputs = {
+            testing::BuildArray(shape).WithLinearData<T>(-2.f, 0.5f),
+            testing::BuildArray(shape).WithLinearData<T>(1.f, 1.5f),
+    };
+    Arrays eps = {
+            testing::BuildArray(shape).WithData(eps_data),
+            testing::BuildArray(shape).WithData(eps_data),
+    };
+    Arrays grad_outputs = {
+            testing::BuildArray(shape).WithLinearData<T>(1.f, -0.5f),
+    };
+
+    auto forward = [](const Arrays& inputs) { return Arrays{inputs[0] * inputs[1]}; };
+
+    Arrays expected_grads = {inputs[1] * grad_outputs[0], inputs[0] * grad_outputs[0]};
+
+    // The batch size does not divide the number of elements.
+    CheckElementwiseNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads, NumericalGradientOptions{2, 4});
+}
+
+TEST_P(NumericalGradientTest, NumericalGradientIdentity) {
+    using T = float;
+    Shape shape{2, 3};
+    std::vector<T> eps_data(shape.GetTotalSize(), 1e-3f);
+
+    Arrays inputs = {
+            testing::BuildArray(shape).WithLinearData<T>(),
+    };
+    Arrays eps = {
+            testing::BuildArray(shape).WithData(eps_data),
+    };
+    Arrays grad_outputs = {
+            testing::BuildArray(shape).WithLinearData<T>(1.f, -0.5f),
+    };
+
+    // The output shares the buffer with the perturbed input.
+    auto forward = [](const Arrays& inputs) { return Arrays{inputs[0].MakeView()}; };
+
+    Arrays expected_grads = {grad_outputs[0]};
+
+    CheckElementwiseNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads);
+}
+
 INSTANTIATE_TEST_CASE_P(
         ForEachBackend,
         NumericalGradientTest,
@@ -41,6 +41,20 @@ struct ArrayProps {
     Device& device;
 };
 
+// Properties of an input or output array retained by an op node for use in its backward functions.
+// Recorded for graph inspection only in a RetainedArrayRecordingScope; the retained data itself is held by the backward functions.
+struct RetainedArrayProps {
+    RetainedArrayProps(bool is_output, size_t index, Shape shape, Dtype dtype)
+        : is_output{is_output}, index{index}, shape{std::move(shape)}, dtype{dtype} {}
+
+    int64_t GetNBytes() const { return shape.GetTotalSize() * GetItemSize(dtype); }
+
+    bool is_output;
+    size_t index;
+    Shape shape;
+    Dtype dtype;
+};
+
 class OpNodeBackwardEntry {
 public:
     OpNodeBackwardEntry(OpNode& op_node, std::vector<size_t> input_array_node_indices, BackwardFunction backward_func);
@@ -133,6 +147,13 @@ public:
     // Returns the list of output array nodes on "this" graph.
     std::vector<absl::optional<std::weak_ptr<ArrayNode>>>& output_array_nodes() { return output_array_nodes_; }
 
+    // Returns the properties of the inputs and outputs retained for the backward functions.
+    const std::vector<RetainedArrayProps>& retained_array_props() const { return retained_array_props_; }
+
+    void set_retained_array_props(std::vector<RetainedArrayProps> retained_array_props) {
+        retained_array_props_ = std::move(retained_array_props);
+    }
+
     // Returns the input array nodes of all graphs.
     const std::vector<std::tuple<BackpropId, std::vector<std::shared_ptr<ArrayNode>>>>& outer_graphs_input_array_nodes() const {
         return outer_graphs_input_array_nodes_;
@@ -172,6 +193,8 @@ private:
     // Array props of output array nodes. This is used for creating dummy gradients.
     std::vector<ArrayProps> output_array_props_;
 
+    std::vector<RetainedArrayProps> retained_array_props_;
+
     std::vector<OpNodeBackwardEntry> backward_entries_;
 };
 
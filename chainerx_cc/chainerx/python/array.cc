@@ -20,6 +20,7 @@
 #include "chainerx/backward.h"
 #include "chainerx/constant.h"
 #include "chainerx/context.h"
+#include "chainerx/data_version.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
@@ -197,6 +198,10 @@ void InitChainerxArrayConversion(pybind11::module& m, py::class_<ArrayBody, Arra
           "array"_a,
           "copy"_a = true);
     m.def("_to_cupy", [m](py::handle array) { return MakeCupyArrayFromArray(m, array); }, "array"_a);
+    // These are for internal use (from the fallback workarounds) to track writes to the data buffer which bypass the routines, e.g. through
+    // NumPy or CuPy views of the buffer, so that packed weights and retained arrays are not silently reused after such writes.
+    m.def("_bump_data_version", [](const ArrayBodyPtr& array) { internal::BumpDataVersion(Array{array}); }, "array"_a);
+    m.def("_get_data_version", [](const ArrayBodyPtr& array) { return internal::GetDataVersion(Array{array}); }, "array"_a);
     // This is currently for internal use (from Chainer) to support CuPy.
     // TODO(niboshi): Remove this once it will be possible to import cupy.ndarray using chx.array / chx.asarray.
     m.def("_fromrawpointer",
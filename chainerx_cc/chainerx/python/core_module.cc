@@ -23,6 +23,7 @@
 #include "chainerx/python/graph.h"
 #include "chainerx/python/routines.h"
 #include "chainerx/python/scalar.h"
+#include "chainerx/python/sparse.h"
 #include "chainerx/python/testing/testing_module.h"
 
 #if CHAINERX_DEBUG
@@ -57,6 +58,7 @@ void InitChainerxModule(pybind11::module& m) {
     InitChainerxBackward(m);
     InitChainerxCheckBackward(m);
     InitChainerxRoutines(m);
+    InitChainerxSparse(m);
     InitChainerxChainerInterop(m);
 
     m.def("_is_debug", []() -> bool { return CHAINERX_DEBUG; });
@@ -125,6 +125,60 @@ CastingMode ParseCastingMode(const std::string& casting) {
     return mode;
 }
 
+SegmentReduction ParseSegmentReduction(const std::string& reduce) {
+    if (reduce == "sum") {
+        return SegmentReduction::kSum;
+    }
+    if (reduce == "mean") {
+        return SegmentReduction::kMean;
+    }
+    if (reduce == "max") {
+        return SegmentReduction::kMax;
+    }
+    if (reduce == "min") {
+        return SegmentReduction::kMin;
+    }
+    throw py::value_error{"Reduction must be one of 'sum', 'mean', 'max', or 'min'."};
+}
+
+// Defines a quantile routine along an axis or axes, for a quantile and for a sequence of quantiles.
+// quantile is called with the array, the quantiles, the axes and keepdims.
+template <typename F>
+void DefQuantileRoutine(pybind11::module& m, const char* name, F quantile) {
+    m.def(name,
+          [quantile](const ArrayBodyPtr& a, double q, int8_t axis, bool keepdims) {
+              return MoveArrayBody(quantile(Array{a}, q, OptionalAxes{Axes{axis}}, keepdims));
+          },
+          "a"_a,
+          "q"_a,
+          "axis"_a,
+          "keepdims"_a = false);
+    m.def(name,
+          [quantile](const ArrayBodyPtr& a, double q, const absl::optional<std::vector<int8_t>>& axis, bool keepdims) {
+              return MoveArrayBody(quantile(Array{a}, q, ToAxes(axis), keepdims));
+          },
+          "a"_a,
+          "q"_a,
+          "axis"_a = nullptr,
+          "keepdims"_a = false);
+    m.def(name,
+          [quantile](const ArrayBodyPtr& a, const std::vector<double>& q, int8_t axis, bool keepdims) {
+              return MoveArrayBody(quantile(Array{a}, q, OptionalAxes{Axes{axis}}, keepdims));
+          },
+          "a"_a,
+          "q"_a,
+          "axis"_a,
+          "keepdims"_a = false);
+    m.def(name,
+          [quantile](const ArrayBodyPtr& a, const std::vector<double>& q, const absl::optional<std::vector<int8_t>>& axis, bool keepdims) {
+              return MoveArrayBody(quantile(Array{a}, q, ToAxes(axis), keepdims));
+          },
+          "a"_a,
+          "q"_a,
+          "axis"_a = nullptr,
+          "keepdims"_a = false);
+}
+
 void InitChainerxCreation(pybind11::module& m) {
     // creation routines
     // TODO(niboshi): Accept CuPy ndarray in `array` and `asarray`. In principle it's CuPy's responsibility to provide some standard
@@ -411,11 +465,37 @@ void InitChainerxIndexing(pybind11::module& m) {
           "x"_a,
           "y"_a);
     m.def("nonzero", [](const ArrayBodyPtr& a) { return ToTuple(Nonzero(Array{a})); }, "a"_a);
+    m.def("embedding_bag",
+          [](const ArrayBodyPtr& table,
+             const ArrayBodyPtr& indices,
+             const ArrayBodyPtr& offsets,
+             const std::string& mode,
+             const absl::optional<ArrayBodyPtr>& per_sample_weights) {
+              return MoveArrayBody(EmbeddingBag(
+                      Array{table},
+                      Array{indices},
+                      Array{offsets},
+                      ParseSegmentReduction(mode),
+                      per_sample_weights.has_value() ? absl::optional<Array>{Array{*per_sample_weights}} : absl::nullopt));
+          },
+          "table"_a,
+          "indices"_a,
+          "offsets"_a,
+          "mode"_a = "sum",
+          "per_sample_weights"_a = nullptr);
 }
 
 void InitChainerxLinalg(pybind11::module& m) {
     // linalg routines
     m.def("dot", [](const ArrayBodyPtr& a, const ArrayBodyPtr& b) { return MoveArrayBody(Dot(Array{a}, Array{b})); }, "a"_a, "b"_a);
+    m.def("einsum", [](const std::string& subscripts, py::args operands) {
+        std::vector<Array> arrays;
+        arrays.reserve(operands.size());
+        std::transform(operands.begin(), operands.end(), std::back_inserter(arrays), [](const auto& item) {
+            return Array{py::cast<ArrayBodyPtr>(item)};
+        });
+        return MoveArrayBody(Einsum(subscripts, arrays));
+    });
 
     pybind11::module mlinalg = m.def_submodule("linalg");
 #if CHAINERX_ENABLE_LAPACK
@@ -781,6 +861,29 @@ void InitChainerxManipulation(pybind11::module& m) {
           },
           "arrays"_a,
           "axis"_a = 0);
+    m.def("pack",
+          [](py::sequence arrays, py::handle dtype) {
+              std::vector<Array> xs;
+              xs.reserve(arrays.size());
+              std::transform(arrays.begin(), arrays.end(), std::back_inserter(xs), [](const auto& item) {
+                  return Array{py::cast<ArrayBodyPtr>(item)};
+              });
+              return MoveArrayBody(Pack(xs, dtype.is_none() ? absl::nullopt : absl::optional<Dtype>{GetDtype(dtype)}));
+          },
+          "arrays"_a,
+          "dtype"_a = nullptr);
+    m.def("unpack",
+          [](const ArrayBodyPtr& packed, py::sequence arrays, Scalar scale) {
+              std::vector<Array> xs;
+              xs.reserve(arrays.size());
+              std::transform(arrays.begin(), arrays.end(), std::back_inserter(xs), [](const auto& item) {
+                  return Array{py::cast<ArrayBodyPtr>(item)};
+              });
+              Unpack(Array{packed}, xs, scale);
+          },
+          "packed"_a,
+          "arrays"_a,
+          "scale"_a = 1);
     m.def("atleast_2d", [](const ArrayBodyPtr& a) { return MoveArrayBody(AtLeast2D(Array{a})); }, "a"_a);
     m.def("atleast_3d", [](const ArrayBodyPtr& a) { return MoveArrayBody(AtLeast3D(Array{a})); }, "a"_a);
     m.def("hstack",
@@ -875,6 +978,13 @@ void InitChainerxActivation(pybind11::module& m) {
         return ToTuple(SLstm(Array{c1}, Array{c2}, Array{x1}, Array{x2}));
     });
     m.def("softplus", [](const ArrayBodyPtr& x, double beta) { return MoveArrayBody(Softplus(Array{x}, beta)); }, "x"_a, "beta"_a = 1.0);
+    m.def("gelu",
+          [](const ArrayBodyPtr& x, bool approximate) { return MoveArrayBody(Gelu(Array{x}, approximate)); },
+          "x"_a,
+          "approximate"_a = false);
+    m.def("silu", [](const ArrayBodyPtr& x) { return MoveArrayBody(Silu(Array{x})); }, "x"_a);
+    m.def("mish", [](const ArrayBodyPtr& x) { return MoveArrayBody(Mish(Array{x})); }, "x"_a);
+    m.def("hard_swish", [](const ArrayBodyPtr& x) { return MoveArrayBody(HardSwish(Array{x})); }, "x"_a);
 }
 
 void InitChainerxArithmetic(pybind11::module& m) {
@@ -1040,6 +1150,46 @@ void InitChainerxReduction(pybind11::module& m) {
           "a"_a,
           "axis"_a = nullptr,
           "keepdims"_a = false);
+    m.def("segment_sum",
+          [](const ArrayBodyPtr& data, const ArrayBodyPtr& segment_ids, int64_t num_segments, bool sorted) {
+              return MoveArrayBody(SegmentSum(Array{data}, Array{segment_ids}, num_segments, sorted));
+          },
+          "data"_a,
+          "segment_ids"_a,
+          "num_segments"_a,
+          "sorted"_a = false);
+    m.def("segment_mean",
+          [](const ArrayBodyPtr& data, const ArrayBodyPtr& segment_ids, int64_t num_segments, bool sorted) {
+              return MoveArrayBody(SegmentMean(Array{data}, Array{segment_ids}, num_segments, sorted));
+          },
+          "data"_a,
+          "segment_ids"_a,
+          "num_segments"_a,
+          "sorted"_a = false);
+    m.def("segment_max",
+          [](const ArrayBodyPtr& data, const ArrayBodyPtr& segment_ids, int64_t num_segments, bool sorted) {
+              return MoveArrayBody(SegmentMax(Array{data}, Array{segment_ids}, num_segments, sorted));
+          },
+          "data"_a,
+          "segment_ids"_a,
+          "num_segments"_a,
+          "sorted"_a = false);
+    m.def("segment_min",
+          [](const ArrayBodyPtr& data, const ArrayBodyPtr& segment_ids, int64_t num_segments, bool sorted) {
+              return MoveArrayBody(SegmentMin(Array{data}, Array{segment_ids}, num_segments, sorted));
+          },
+          "data"_a,
+          "segment_ids"_a,
+          "num_segments"_a,
+          "sorted"_a = false);
+    m.def("scatter_reduce",
+          [](const ArrayBodyPtr& a, const ArrayBodyPtr& indices, const ArrayBodyPtr& b, const std::string& reduce) {
+              return MoveArrayBody(ScatterReduce(Array{a}, Array{indices}, Array{b}, ParseSegmentReduction(reduce)));
+          },
+          "a"_a,
+          "indices"_a,
+          "b"_a,
+          "reduce"_a = "sum");
 }
 
 void InitChainerxRounding(pybind11::module& m) {
@@ -1100,6 +1250,39 @@ void InitChainerxSorting(pybind11::module& m) {
           [](const ArrayBodyPtr& a, absl::optional<int8_t> axis) { return MoveArrayBody(NanArgMin(Array{a}, ToAxes(axis))); },
           "a"_a,
           "axis"_a = nullptr);
+    m.def("searchsorted",
+          [](const ArrayBodyPtr& a, const ArrayBodyPtr& v, const std::string& side) {
+              if (side != "left" && side != "right") {
+                  throw py::value_error{"side must be 'left' or 'right'"};
+              }
+              return MoveArrayBody(Searchsorted(Array{a}, Array{v}, side == "right"));
+          },
+          "a"_a,
+          "v"_a,
+          "side"_a = "left");
+    m.def("unique",
+          [](const ArrayBodyPtr& ar, bool return_index, bool return_inverse, bool return_counts) -> py::object {
+              std::tuple<Array, Array, Array, Array> out = Unique(Array{ar});
+              if (!return_index && !return_inverse && !return_counts) {
+                  return py::cast(MoveArrayBody(std::move(std::get<0>(out))));
+              }
+              py::list ret{};
+              ret.append(MoveArrayBody(std::move(std::get<0>(out))));
+              if (return_index) {
+                  ret.append(MoveArrayBody(std::move(std::get<1>(out))));
+              }
+              if (return_inverse) {
+                  ret.append(MoveArrayBody(std::move(std::get<2>(out))));
+              }
+              if (return_counts) {
+                  ret.append(MoveArrayBody(std::move(std::get<3>(out))));
+              }
+              return py::tuple{ret};
+          },
+          "ar"_a,
+          "return_index"_a = false,
+          "return_inverse"_a = false,
+          "return_counts"_a = false);
 }
 
 void InitChainerxStatistics(pybind11::module& m) {
@@ -1130,6 +1313,36 @@ void InitChainerxStatistics(pybind11::module& m) {
           "axis"_a = nullptr,
           "keepdims"_a = false);
     m.attr("min") = m.attr("amin");
+    m.def("bincount",
+          [](const ArrayBodyPtr& x, const absl::optional<ArrayBodyPtr>& weights, int64_t minlength) {
+              return MoveArrayBody(
+                      Bincount(Array{x}, weights.has_value() ? absl::optional<Array>{Array{*weights}} : absl::nullopt, minlength));
+          },
+          "x"_a,
+          "weights"_a = nullptr,
+          "minlength"_a = 0);
+    m.def("histogram",
+          [](const ArrayBodyPtr& a, const ArrayBodyPtr& bins, const absl::optional<ArrayBodyPtr>& weights) {
+              std::tuple<Array, Array> out =
+                      Histogram(Array{a}, Array{bins}, weights.has_value() ? absl::optional<Array>{Array{*weights}} : absl::nullopt);
+              return std::make_tuple(MoveArrayBody(std::move(std::get<0>(out))), MoveArrayBody(std::move(std::get<1>(out))));
+          },
+          "a"_a,
+          "bins"_a,
+          "weights"_a = nullptr);
+    m.def("histogram",
+          [](const ArrayBodyPtr& a,
+             int64_t bins,
+             const absl::optional<std::pair<double, double>>& range,
+             const absl::optional<ArrayBodyPtr>& weights) {
+              std::tuple<Array, Array> out =
+                      Histogram(Array{a}, bins, range, weights.has_value() ? absl::optional<Array>{Array{*weights}} : absl::nullopt);
+              return std::make_tuple(MoveArrayBody(std::move(std::get<0>(out))), MoveArrayBody(std::move(std::get<1>(out))));
+          },
+          "a"_a,
+          "bins"_a = 10,
+          "range"_a = nullptr,
+          "weights"_a = nullptr);
     m.def("mean",
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(Mean(Array{a}, Axes{axis}, keepdims)); },
           "a"_a,
@@ -1142,6 +1355,42 @@ void InitChainerxStatistics(pybind11::module& m) {
           "a"_a,
           "axis"_a = nullptr,
           "keepdims"_a = false);
+    m.def("median",
+          [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(Median(Array{a}, Axes{axis}, keepdims)); },
+          "a"_a,
+          "axis"_a,
+          "keepdims"_a = false);
+    m.def("median",
+          [](const ArrayBodyPtr& a, const absl::optional<std::vector<int8_t>>& axis, bool keepdims) {
+              return MoveArrayBody(Median(Array{a}, ToAxes(axis), keepdims));
+          },
+          "a"_a,
+          "axis"_a = nullptr,
+          "keepdims"_a = false);
+    m.def("nanmedian",
+          [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(NanMedian(Array{a}, Axes{axis}, keepdims)); },
+          "a"_a,
+          "axis"_a,
+          "keepdims"_a = false);
+    m.def("nanmedian",
+          [](const ArrayBodyPtr& a, const absl::optional<std::vector<int8_t>>& axis, bool keepdims) {
+              return MoveArrayBody(NanMedian(Array{a}, ToAxes(axis), keepdims));
+          },
+          "a"_a,
+          "axis"_a = nullptr,
+          "keepdims"_a = false);
+    DefQuantileRoutine(m, "nanpercentile", [](const Array& a, const auto& q, const OptionalAxes& axis, bool keepdims) {
+        return NanPercentile(a, q, axis, keepdims);
+    });
+    DefQuantileRoutine(m, "nanquantile", [](const Array& a, const auto& q, const OptionalAxes& axis, bool keepdims) {
+        return NanQuantile(a, q, axis, keepdims);
+    });
+    DefQuantileRoutine(m, "percentile", [](const Array& a, const auto& q, const OptionalAxes& axis, bool keepdims) {
+        return Percentile(a, q, axis, keepdims);
+    });
+    DefQuantileRoutine(m, "quantile", [](const Array& a, const auto& q, const OptionalAxes& axis, bool keepdims) {
+        return Quantile(a, q, axis, keepdims);
+    });
     m.def("var",
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(Var(Array{a}, Axes{axis}, keepdims)); },
           "a"_a,
@@ -1164,7 +1413,8 @@ void InitChainerxConnection(pybind11::module& m) {
              const absl::optional<ArrayBodyPtr>& b,
              py::handle stride,
              py::handle pad,
-             bool cover_all) {
+             bool cover_all,
+             py::handle dilate) {
               // Create an Array from x to compute the image dimensions and the expected number of stride and padding elements.
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
@@ -1174,21 +1424,25 @@ void InitChainerxConnection(pybind11::module& m) {
                            b.has_value() ? absl::optional<Array>{Array{*b}} : absl::nullopt,
                            ToStackVector<int64_t>(stride, ndim),
                            ToStackVector<int64_t>(pad, ndim),
-                           cover_all));
+                           cover_all,
+                           absl::nullopt,
+                           Dims{ToStackVector<int64_t>(dilate, ndim)}));
           },
           "x"_a,
           "w"_a,
           "b"_a = nullptr,
           "stride"_a = 1,
           "pad"_a = 0,
-          "cover_all"_a = false);
+          "cover_all"_a = false,
+          "dilate"_a = 1);
     m.def("conv_transpose",
           [](const ArrayBodyPtr& x,
              const ArrayBodyPtr& w,
              const absl::optional<ArrayBodyPtr>& b,
              py::handle stride,
              py::handle pad,
-             const absl::optional<py::tuple>& outsize) {
+             const absl::optional<py::tuple>& outsize,
+             py::handle dilate) {
               // Create an Array from x to compute the image dimensions and the expected number of stride and padding elements.
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
@@ -1198,14 +1452,17 @@ void InitChainerxConnection(pybind11::module& m) {
                       b.has_value() ? absl::optional<Array>{Array{*b}} : absl::nullopt,
                       ToStackVector<int64_t>(stride, ndim),
                       ToStackVector<int64_t>(pad, ndim),
-                      outsize.has_value() ? absl::optional<Dims>{ToStackVector<int64_t>(*outsize, ndim)} : absl::nullopt));
+                      outsize.has_value() ? absl::optional<Dims>{ToStackVector<int64_t>(*outsize, ndim)} : absl::nullopt,
+                      absl::nullopt,
+                      Dims{ToStackVector<int64_t>(dilate, ndim)}));
           },
           "x"_a,
           "w"_a,
           "b"_a = nullptr,
           "stride"_a = 1,
           "pad"_a = 0,
-          "outsize"_a = nullptr);
+          "outsize"_a = nullptr,
+          "dilate"_a = 1);
     m.def("linear",
           [](const ArrayBodyPtr& x, const ArrayBodyPtr& w, const absl::optional<ArrayBodyPtr>& b, int8_t n_batch_axes) {
               return MoveArrayBody(
@@ -0,0 +1,68 @@
+#include "chainerx/python/common_export.h"
+
+#include "chainerx/python/sparse.h"
+
+#include "chainerx/array.h"
+#include "chainerx/routines/sparse.h"
+
+#include "chainerx/python/array.h"
+#include "chainerx/python/common.h"
+#include "chainerx/python/shape.h"
+
+namespace chainerx {
+namespace python {
+namespace python_internal {
+
+namespace py = pybind11;  // standard convention
+using py::literals::operator""_a;
+
+namespace {
+
+using internal::MoveArrayBody;
+
+}  // namespace
+
+void InitChainerxSparse(pybind11::module& m) {
+    pybind11::module msparse = m.def_submodule("sparse");
+
+    py::class_<CooMatrix> coo{msparse, "coo_matrix"};
+    coo.def(py::init([](const ArrayBodyPtr& data, const ArrayBodyPtr& row, const ArrayBodyPtr& col, py::handle shape) {
+                return CooMatrix{Array{data}, Array{row}, Array{col}, ToShape(shape)};
+            }),
+            "data"_a,
+            "row"_a,
+            "col"_a,
+            "shape"_a);
+    coo.def_property_readonly("data", [](const CooMatrix& self) { return MoveArrayBody(Array{self.data()}); });
+    coo.def_property_readonly("row", [](const CooMatrix& self) { return MoveArrayBody(Array{self.row()}); });
+    coo.def_property_readonly("col", [](const CooMatrix& self) { return MoveArrayBody(Array{self.col()}); });
+    coo.def_property_readonly("shape", [](const CooMatrix& self) { return ToTuple(self.shape()); });
+    coo.def_property_readonly("nnz", &CooMatrix::nnz);
+    coo.def("todense", [](const CooMatrix& self) { return MoveArrayBody(ToDense(self)); });
+    coo.def("tocsr", [](const CooMatrix& self) { return ToCsr(self); });
+
+    py::class_<CsrMatrix> csr{msparse, "csr_matrix"};
+    csr.def(py::init([](const ArrayBodyPtr& data, const ArrayBodyPtr& indices, const ArrayBodyPtr& indptr, py::handle shape) {
+                return CsrMatrix{Array{data}, Array{indices}, Array{indptr}, ToShape(shape)};
+            }),
+            "data"_a,
+            "indices"_a,
+            "indptr"_a,
+            "shape"_a);
+    csr.def_property_readonly("data", [](const CsrMatrix& self) { return MoveArrayBody(Array{self.data()}); });
+    csr.def_property_readonly("indices", [](const CsrMatrix& self) { return MoveArrayBody(Array{self.indices()}); });
+    csr.def_property_readonly("indptr", [](const CsrMatrix& self) { return MoveArrayBody(Array{self.indptr()}); });
+    csr.def_property_readonly("shape", [](const CsrMatrix& self) { return ToTuple(self.shape()); });
+    csr.def_property_readonly("nnz", &CsrMatrix::nnz);
+    csr.def("todense", [](const CsrMatrix& self) { return MoveArrayBody(ToDense(self)); });
+    csr.def("tocoo", [](const CsrMatrix& self) { return ToCoo(self); });
+
+    msparse.def("to_coo", [](const ArrayBodyPtr& a) { return ToCoo(Array{a}); }, "a"_a);
+    msparse.def("to_csr", [](const ArrayBodyPtr& a) { return ToCsr(Array{a}); }, "a"_a);
+    msparse.def("matmul", [](const CooMatrix& a, const ArrayBodyPtr& b) { return MoveArrayBody(SparseMatmul(a, Array{b})); }, "a"_a, "b"_a);
+    msparse.def("matmul", [](const CsrMatrix& a, const ArrayBodyPtr& b) { return MoveArrayBody(SparseMatmul(a, Array{b})); }, "a"_a, "b"_a);
+}
+
+}  // namespace python_internal
+}  // namespace python
+}  // namespace chainerx
@@ -1,19 +1,88 @@
 #include "chainerx/reduction_kernel_arg.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
+#include <utility>
+
+#include <gsl/gsl>
 
 #include "chainerx/array.h"
+#include "chainerx/axes.h"
 #include "chainerx/macro.h"
 #include "chainerx/shape.h"
 #include "chainerx/squash_dims.h"
 #include "chainerx/strides.h"
 
 namespace chainerx {
+namespace {
+
+// Signature of a reduction and its permuted and squashed layouts.
+struct ReductionLayout {
+    Shape in_shape;
+    Strides in_strides;
+    Axes axis;
+    Shape out_shape;
+    Strides out_strides;
+
+    Strides squashed_in_strides;
+    Strides squashed_out_strides;
+    Shape squashed_in_shape;
+    Shape squashed_out_shape;
+};
+
+// A small cache of the layouts of recent reductions on a thread, replaced in round-robin order.
+class ReductionLayoutCache {
+public:
+    const ReductionLayout* Find(const Array& in, const Axes& axis, const Array& out) const {
+        for (size_t i = 0; i < size_; ++i) {
+            const ReductionLayout& layout = gsl::at(layouts_, i);
+            if (layout.axis == axis && layout.in_shape == in.shape() && layout.out_shape == out.shape() &&
+                layout.in_strides == in.strides() && layout.out_strides == out.strides()) {
+                return &layout;
+            }
+        }
+        return nullptr;
+    }
+
+    void Add(ReductionLayout layout) {
+        gsl::at(layouts_, next_) = std::move(layout);
+        next_ = (next_ + 1) % kCapacity;
+        size_ = std::min(size_ + 1, kCapacity);
+    }
+
+private:
+    static constexpr size_t kCapacity = 8;
+
+    std::array<ReductionLayout, kCapacity> layouts_{};
+    size_t size_{0};
+    size_t next_{0};
+};
+
+constexpr size_t ReductionLayoutCache::kCapacity;
+
+ReductionLayoutCache& GetReductionLayoutCache() {
+    thread_local ReductionLayoutCache t_cache{};
+    return t_cache;
+}
+
+}  // namespace
 
 ReductionArg::ReductionArg(const Array& in, const Axes& axis, const Array& out) : in_{in}, out_{out} {
+    ReductionLayoutCache& cache = GetReductionLayoutCache();
+    if (const ReductionLayout* layout = cache.Find(in, axis, out)) {
+        in_strides_ = layout->squashed_in_strides;
+        out_strides_ = layout->squashed_out_strides;
+        in_shape_ = layout->squashed_in_shape;
+        out_shape_ = layout->squashed_out_shape;
+        return;
+    }
+
     Permute(axis);
     Squash();
+    cache.Add({in.shape(), in.strides(), axis, out.shape(), out.strides(), in_strides_, out_strides_, in_shape_, out_shape_});
 }
 
 void ReductionArg::Permute(const Axes& axis) {
@@ -37,6 +37,9 @@ struct ReductionKernelArg {
 //
 // Strides and shapes are permuted so that the reduction axes come last. Axes of length 1 are also removed.
 // Contiguous dimensions of strides and shapes are squashed.
+//
+// The permuted and squashed layouts depend only on the shapes and strides of the arrays and the axes. They are memoized per thread for a
+// few recent signatures, since small reductions in tight loops would otherwise spend more time in this setup than in the reduction.
 class ReductionArg {
 public:
     ReductionArg(const Array& in, const Axes& axis, const Array& out);
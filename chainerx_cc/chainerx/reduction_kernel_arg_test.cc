@@ -0,0 +1,85 @@
+#include "chainerx/reduction_kernel_arg.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/context_session.h"
+
+namespace chainerx {
+namespace {
+
+void ExpectReductionArgEq(
+        const Shape& in_shape, const Strides& in_strides, const Shape& out_shape, const Strides& out_strides, const ReductionArg& arg) {
+    EXPECT_EQ(in_shape, arg.in_shape());
+    EXPECT_EQ(in_strides, arg.in_strides());
+    EXPECT_EQ(out_shape, arg.out_shape());
+    EXPECT_EQ(out_strides, arg.out_strides());
+}
+
+TEST(ReductionArgTest, Contiguous) {
+    testing::ContextSession context_session;
+    Array in = testing::BuildArray({2, 3, 4}).WithLinearData<float>();
+
+    // Repeated constructions return the same layout regardless of whether it is memoized.
+    for (int i = 0; i < 2; ++i) {
+        Array out_all = Empty({}, Dtype::kFloat32);
+        ExpectReductionArgEq({24}, {4}, {}, {}, ReductionArg{in, {0, 1, 2}, out_all});
+
+        Array out_last = Empty({2, 3}, Dtype::kFloat32);
+        ExpectReductionArgEq({4, 6}, {4, 16}, {6}, {4}, ReductionArg{in, {2}, out_last});
+
+        // The input is squashed as a whole, where the index of an element is the output index plus the reduction index times the output
+        // size.
+        Array out_first = Empty({3, 4}, Dtype::kFloat32);
+        ExpectReductionArgEq({24}, {4}, {12}, {4}, ReductionArg{in, {0}, out_first});
+
+        Array out_keepdims = Empty({2, 3, 1}, Dtype::kFloat32);
+        ExpectReductionArgEq({4, 6}, {4, 16}, {6}, {4}, ReductionArg{in, {2}, out_keepdims});
+    }
+}
+
+TEST(ReductionArgTest, SameShapeDifferentStrides) {
+    testing::ContextSession context_session;
+    Array in = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array in_padded = testing::BuildArray({2, 3}).WithLinearData<float>().WithPadding(1);
+    Array out = Empty({2}, Dtype::kFloat32);
+
+    ExpectReductionArgEq({3, 2}, {4, 12}, {2}, {4}, ReductionArg{in, {1}, out});
+    const Strides& padded_strides = in_padded.strides();
+    ExpectReductionArgEq({3, 2}, {padded_strides[1], padded_strides[0]}, {2}, {4}, ReductionArg{in_padded, {1}, out});
+    ExpectReductionArgEq({3, 2}, {4, 12}, {2}, {4}, ReductionArg{in, {1}, out});
+}
+
+TEST(ReductionArgTest, ManySignatures) {
+    testing::ContextSession context_session;
+    std::vector<Array> ins;
+    std::vector<Array> outs;
+    for (int64_t n = 1; n <= 20; ++n) {
+        ins.emplace_back(testing::BuildArray({n, 5}).WithLinearData<float>());
+        outs.emplace_back(Empty({n}, Dtype::kFloat32));
+    }
+
+    // Layouts are correct after older signatures are evicted.
+    for (int i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < ins.size(); ++j) {
+            int64_t n = ins[j].shape()[0];
+            if (n == 1) {
+                ExpectReductionArgEq({5}, {4}, {}, {}, ReductionArg{ins[j], {1}, outs[j]});
+            } else {
+                ExpectReductionArgEq({5, n}, {4, 20}, {n}, {4}, ReductionArg{ins[j], {1}, outs[j]});
+            }
+        }
+    }
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -6,11 +6,15 @@
 #include <vector>
 
 #include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/enum.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernels/activation.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
@@ -46,6 +50,38 @@ std::vector<Array> ExtractGates(const Array& x, int64_t n_splits, int64_t axis)
     return x_split;
 }
 
+using activation_detail::kGeluTanhCoeff;
+using activation_detail::kInvSqrt2;
+using activation_detail::kInvSqrt2Pi;
+using activation_detail::kSqrt2OverPi;
+
+// Computes an elementwise activation with a fused kernel.
+template <typename Kernel, typename... Args>
+Array CallActivationKernel(const Array& x, const Args&... args) {
+    Dtype dtype = internal::GetMathResultDtype(x.dtype());
+    Array out = Empty(x.shape(), dtype, x.device());
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<Kernel>(x, args..., out);
+    }
+    return out;
+}
+
+// Computes the gradient of an elementwise activation with a fused kernel.
+// If the gradient is to be differentiated further, it is computed by composed_grad instead so that the higher-order gradients are defined.
+template <typename GradKernel, typename ComposedGrad, typename... Args>
+Array ActivationGrad(const Array& x, const Array& gout, ComposedGrad&& composed_grad, const Args&... args) {
+    if (x.IsBackpropRequired(AnyGraph{}) || gout.IsBackpropRequired(AnyGraph{})) {
+        return composed_grad();
+    }
+    Array gx = Empty(x.shape(), gout.dtype(), x.device());
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<GradKernel>(x, gout, args..., gx);
+    }
+    return gx;
+}
+
 }  // namespace
 
 Array ClippedRelu(const Array& x, Scalar z) {
@@ -66,9 +102,7 @@ Array CRelu(const Array& x, int8_t axis) {
 Array Elu(const Array& x, double alpha) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
     const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
-    // TODO(aksub99): Replace x > zero with x > 0 when operator > supports scalars.
-    Array zero = Zeros({}, x_cast.dtype(), x_cast.device());
-    return Where(x_cast > zero, x_cast, alpha * Expm1(x_cast));
+    return WhereCompare(CompareOp::kGreater, x_cast, 0, x_cast, alpha * Expm1(x_cast));
 }
 
 Array Sigmoid(const Array& x) {
@@ -86,9 +120,7 @@ Array Relu(const Array& x) {
 Array LeakyRelu(const Array& x, Scalar slope) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
     const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
-    // TODO(hamaji): Replace x >= zero with x >= 0 when operator >= supports scalars.
-    Array zero = Zeros({}, x_cast.dtype(), x_cast.device());
-    return Where(x_cast >= zero, x_cast, slope * x_cast);
+    return WhereCompare(CompareOp::kGreaterEqual, x_cast, 0, x_cast, slope * x_cast);
 }
 
 std::vector<Array> TreeLstm(std::vector<Array> arrays) {
@@ -157,4 +189,87 @@ Array Softplus(const Array& x, double beta) {
     return y;
 }
 
+Array Gelu(const Array& x, bool approximate) {
+    Array out = CallActivationKernel<GeluKernel>(x, approximate);
+
+    BackwardBuilder bb{"gelu", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([x_tok = bb.RetainInput(0), approximate](BackwardContext& bctx) {
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            const Array& gout = *bctx.output_grad();
+            bctx.input_grad() = ActivationGrad<GeluGradKernel>(
+                    x,
+                    gout,
+                    [&x, &gout, approximate]() {
+                        if (approximate) {
+                            Array t = Tanh(kSqrt2OverPi * (x + kGeluTanhCoeff * x * Square(x)));
+                            return gout * (0.5 * (1 + t) + 0.5 * kSqrt2OverPi * x * (1 - Square(t)) * (1 + 3 * kGeluTanhCoeff * Square(x)));
+                        }
+                        return gout * (0.5 * (1 + Erf(kInvSqrt2 * x)) + kInvSqrt2Pi * x * Exp(-0.5 * Square(x)));
+                    },
+                    approximate);
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+Array Silu(const Array& x) {
+    Array out = CallActivationKernel<SiluKernel>(x);
+
+    BackwardBuilder bb{"silu", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([x_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            const Array& gout = *bctx.output_grad();
+            bctx.input_grad() = ActivationGrad<SiluGradKernel>(x, gout, [&x, &gout]() {
+                Array s = Sigmoid(x);
+                return gout * s * (1 + x * (1 - s));
+            });
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+Array Mish(const Array& x) {
+    Array out = CallActivationKernel<MishKernel>(x);
+
+    BackwardBuilder bb{"mish", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([x_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            const Array& gout = *bctx.output_grad();
+            bctx.input_grad() = ActivationGrad<MishGradKernel>(x, gout, [&x, &gout]() {
+                Array t = Tanh(Softplus(x));
+                return gout * (t + x * Sigmoid(x) * (1 - Square(t)));
+            });
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+Array HardSwish(const Array& x) {
+    Array out = CallActivationKernel<HardSwishKernel>(x);
+
+    BackwardBuilder bb{"hard_swish", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([x_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            const Array& gout = *bctx.output_grad();
+            bctx.input_grad() = ActivationGrad<HardSwishGradKernel>(x, gout, [&x, &gout]() {
+                Array dx = WhereCompare(CompareOp::kLess, x, -3, 0.0, WhereCompare(CompareOp::kGreater, x, 3, 1.0, (2 * x + 3) / 6));
+                return gout * dx;
+            });
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
 }  // namespace chainerx
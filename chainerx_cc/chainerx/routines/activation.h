@@ -25,4 +25,17 @@ std::vector<Array> SLstm(const Array& c_prev1, const Array& c_prev2, const Array
 
 Array Softplus(const Array& x, double beta = 1.0);
 
+// Computes the Gaussian error linear unit x * Phi(x), where Phi is the cumulative distribution function of the standard normal
+// distribution. If approximate is true, the tanh approximation of Phi is used.
+Array Gelu(const Array& x, bool approximate = false);
+
+// Computes the sigmoid linear unit (also known as Swish) x * sigmoid(x).
+Array Silu(const Array& x);
+
+// Computes x * tanh(softplus(x)).
+Array Mish(const Array& x);
+
+// Computes x * min(max(x + 3, 0), 6) / 6.
+Array HardSwish(const Array& x);
+
 }  // namespace chainerx
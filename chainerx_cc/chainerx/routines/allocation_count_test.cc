@@ -0,0 +1,181 @@
+// Baselines of the number and the total size of allocations made by core routines on the native device.
+// A failure in this file means that a change added temporaries (e.g. AsType, Copy or broadcast materialization) to a routine.
+// If the new allocations are intended, update the baseline with an explanation.
+
+#include <cstdint>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dims.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/connection.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/loss.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/normalization.h"
+#include "chainerx/shape.h"
+#include "chainerx/slice.h"
+#include "chainerx/testing/allocation_count.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class AllocationCountTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{"native", 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+    // Runs the forward function and the backward from its output, and checks the allocations of each pass against the baselines.
+    // The output gradient is allocated in advance so that only the allocations of the routine are counted.
+    template <typename Forward>
+    void CheckAllocations(
+            const Forward& forward,
+            const testing::AllocationCount& expected_forward,
+            const testing::AllocationCount& expected_backward) {
+        absl::optional<Array> y{};
+        testing::AllocationCount actual_forward = testing::CountAllocations([&forward, &y]() { y = forward(); });
+        EXPECT_LE(actual_forward.count, expected_forward.count) << "forward";
+        EXPECT_LE(actual_forward.bytesize, expected_forward.bytesize) << "forward";
+
+        y->SetGrad(OnesLike(*y));
+        testing::AllocationCount actual_backward = testing::CountAllocations([&y]() { Backward(*y); });
+        EXPECT_LE(actual_backward.count, expected_backward.count) << "backward";
+        EXPECT_LE(actual_backward.bytesize, expected_backward.bytesize) << "backward";
+    }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+constexpr int64_t kFloatSize = sizeof(float);
+
+// Note that the baselines include the output gradients of the inputs, which are always allocated by the backward pass.
+
+TEST_F(AllocationCountTest, Linear) {
+    Array x = (*testing::BuildArray({8, 5}).WithLinearData<float>()).RequireGrad();
+    Array w = (*testing::BuildArray({3, 5}).WithLinearData<float>()).RequireGrad();
+    Array b = (*testing::BuildArray({3}).WithLinearData<float>()).RequireGrad();
+
+    // Forward allocates only the output. Backward allocates only the gradients of x, w and b.
+    CheckAllocations([&]() { return Linear(x, w, b); }, {1, 8 * 3 * kFloatSize}, {3, (8 * 5 + 3 * 5 + 3) * kFloatSize});
+}
+
+TEST_F(AllocationCountTest, Conv) {
+    Array x = (*testing::BuildArray({2, 3, 6, 6}).WithLinearData<float>()).RequireGrad();
+    Array w = (*testing::BuildArray({4, 3, 3, 3}).WithLinearData<float>()).RequireGrad();
+    Array b = (*testing::BuildArray({4}).WithLinearData<float>()).RequireGrad();
+
+    // Forward allocates the im2col patches of x and the output.
+    // Backward allocates, for x, the product of the output gradient and w in the shape of the patches, a copy of the output gradient
+    // whose kept axes cannot be viewed as matrix rows, and the gradient of x accumulated by col2im. For w, it allocates the patches of x
+    // again, the gradient of w and a partial product accumulated over the batch. For b, it allocates only the gradient of b.
+    constexpr int64_t kPatchSize = 2 * 3 * 3 * 3 * 6 * 6;
+    constexpr int64_t kOutSize = 2 * 4 * 6 * 6;
+    CheckAllocations(
+            [&]() { return Conv(x, w, b, Dims{1, 1}, Dims{1, 1}); },
+            {2, (kPatchSize + kOutSize) * kFloatSize},
+            {7, (kPatchSize + kOutSize + 2 * 3 * 6 * 6 + kPatchSize + 2 * 4 * 3 * 3 * 3 + 4) * kFloatSize});
+}
+
+TEST_F(AllocationCountTest, BatchNorm) {
+    Array x = (*testing::BuildArray({8, 4}).WithLinearData<float>()).RequireGrad();
+    Array gamma = (*testing::BuildArray({4}).WithLinearData<float>()).RequireGrad();
+    Array beta = (*testing::BuildArray({4}).WithLinearData<float>()).RequireGrad();
+    Array running_mean = testing::BuildArray({4}).WithLinearData<float>();
+    Array running_var = testing::BuildArray({4}).WithLinearData<float>();
+
+    // Forward allocates
+    // - the mean of x (1),
+    // - the variance of x: a copy of x, its mean, the deviations, their squares and their mean (5),
+    // - the inverse standard deviation: the variance plus eps, its square root and its reciprocal (3),
+    // - the output: the deviations, normalized, scaled and shifted (4),
+    // - the terms added to the running mean and variance (2).
+    // Backward allocates
+    // - the normalized x in 2 steps and its product with the output gradient (3),
+    // - the gradients of gamma and beta (2),
+    // - the gradient of x in 6 steps, one of which is the product of gamma and the inverse standard deviation (6).
+    constexpr int64_t kXSize = 8 * 4;
+    constexpr int64_t kStatSize = 4;
+    CheckAllocations(
+            [&]() { return BatchNorm(x, gamma, beta, running_mean, running_var); },
+            {15, (kStatSize + (3 * kXSize + 2 * kStatSize) + 3 * kStatSize + 4 * kXSize + 2 * kStatSize) * kFloatSize},
+            {11, (3 * kXSize + 2 * kStatSize + (5 * kXSize + kStatSize)) * kFloatSize});
+}
+
+TEST_F(AllocationCountTest, SoftmaxCrossEntropy) {
+    Array x = (*testing::BuildArray({8, 10}).WithLinearData<float>()).RequireGrad();
+    Array t = testing::BuildArray({8}).WithData<int32_t>({0, 1, 2, 3, 4, 5, 6, 7});
+
+    // Forward allocates
+    // - the log-sum-exp: the maximum, the shifted x, its exponential, their sum, its log and the maximum added back (6),
+    // - the log-softmax (1),
+    // - the mask of the targets: the range of the classes, the boolean comparison and its cast (3),
+    // - the masked log-softmax, its sum and its negation (3).
+    // Backward allocates
+    // - the gradient of the negation and of the masked log-softmax (2),
+    // - the negated gradient of the log-sum-exp and its sum (2),
+    // - the gradients of the log and of the exponential (2),
+    // - the negated gradient of the maximum from the shift and its sum (2),
+    // - the accumulated gradients of x and of the maximum (2),
+    // - the gradient of the maximum: the boolean mask of the maxima, its cast and the product (3).
+    constexpr int64_t kXSize = 8 * 10;
+    constexpr int64_t kRowSize = 8;
+    CheckAllocations(
+            [&]() { return SoftmaxCrossEntropy(x, t); },
+            {13, (6 * kRowSize + 5 * kXSize) * kFloatSize + 10 * sizeof(int32_t) + kXSize * sizeof(bool)},
+            {13, (5 * kRowSize + 7 * kXSize) * kFloatSize + kXSize * sizeof(bool)});
+}
+
+TEST_F(AllocationCountTest, HuberLoss) {
+    Array x1 = (*testing::BuildArray({8, 4}).WithLinearData<float>()).RequireGrad();
+    Array x2 = testing::BuildArray({8, 4}).WithLinearData<float>(0.5f, 0.75f);
+
+    // The comparison is fused into the selection, so that neither pass materializes a boolean mask.
+    CheckAllocations([&]() { return HuberLoss(x1, x2, 2); }, {7, 7 * 8 * 4 * kFloatSize}, {9, 9 * 8 * 4 * kFloatSize});
+}
+
+TEST_F(AllocationCountTest, Hinge) {
+    Array x = (*testing::BuildArray({8, 4}).WithLinearData<float>(-1.0f, 0.25f)).RequireGrad();
+    Array t = testing::BuildArray({8}).WithData<int32_t>({0, 1, 2, 3, 0, 1, 2, 3});
+
+    // Forward allocates the labels and the classes in the dtype of x, 1 - x and 1 + x (3), the selection, its maximum with zero and its
+    // power. The comparison of the labels is fused into the selection, so that neither pass materializes a boolean mask.
+    constexpr int64_t kXSize = 8 * 4;
+    CheckAllocations([&]() { return Hinge(x, t, 2); }, {8, (8 + 4 + 6 * kXSize) * kFloatSize}, {8, 8 * kXSize * kFloatSize});
+}
+
+TEST_F(AllocationCountTest, Concatenate) {
+    Array a = (*testing::BuildArray({8, 3}).WithLinearData<float>()).RequireGrad();
+    Array b = (*testing::BuildArray({8, 5}).WithLinearData<float>()).RequireGrad();
+
+    // Forward allocates only the output. The gradients of the inputs are views of the output gradient.
+    CheckAllocations([&]() { return Concatenate({a, b}, 1); }, {1, 8 * 8 * kFloatSize}, {0, 0});
+}
+
+TEST_F(AllocationCountTest, GetItemSlices) {
+    Array x = (*testing::BuildArray({8, 4}).WithLinearData<float>()).RequireGrad();
+
+    // The gradients of the slices are accumulated into a single gradient of x.
+    CheckAllocations(
+            [&]() { return Concatenate({x.At({Slice{0, 2}}), x.At({Slice{2, 4}}), x.At({Slice{4, 6}}), x.At({Slice{6, 8}})}, 0); },
+            {1, 8 * 4 * kFloatSize},
+            {1, 8 * 4 * kFloatSize});
+}
+
+TEST_F(AllocationCountTest, Split) {
+    Array x = (*testing::BuildArray({8, 4}).WithLinearData<float>()).RequireGrad();
+
+    // The output gradients are copied into a single gradient of x.
+    CheckAllocations([&]() { return Concatenate(Split(x, 4, 0), 0); }, {1, 8 * 4 * kFloatSize}, {1, 8 * 4 * kFloatSize});
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -34,8 +34,10 @@
 namespace chainerx {
 namespace internal {
 
-int64_t GetConvOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all) {
+int64_t GetConvOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all, int64_t dilate) {
     CHAINERX_ASSERT(stride > 0);
+    CHAINERX_ASSERT(dilate > 0);
+    kernel_size = dilate * (kernel_size - 1) + 1;
     int64_t numerator{0};
     if (cover_all) {
         numerator = in_dim + pad * 2 - kernel_size + stride - 1;
@@ -48,13 +50,27 @@ int64_t GetConvOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64
     return numerator / stride + 1;
 }
 
-int64_t GetConvTransposeOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all) {
+int64_t GetConvTransposeOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all, int64_t dilate) {
+    CHAINERX_ASSERT(dilate > 0);
+    kernel_size = dilate * (kernel_size - 1) + 1;
     if (cover_all) {
         return stride * (in_dim - 1) + kernel_size - stride + 1 - 2 * pad;
     }
     return stride * (in_dim - 1) + kernel_size - 2 * pad;
 }
 
+Dims GetDilateOrDefault(const absl::optional<Dims>& dilate, int8_t ndim) {
+    if (dilate.has_value()) {
+        CHAINERX_ASSERT(ndim == static_cast<int8_t>(dilate->size()));
+        return *dilate;
+    }
+    Dims ones;
+    for (int8_t i = 0; i < ndim; ++i) {
+        ones.emplace_back(1);
+    }
+    return ones;
+}
+
 std::vector<Array> ExtractGates(const Array& x) {
     StackVector<int64_t, kMaxNdim> shape_vec;
     shape_vec.emplace_back(x.shape()[0]);
@@ -77,16 +93,24 @@ std::vector<Array> ExtractGates(const Array& x) {
 namespace {
 
 Array ConvGradWeight(
-        Dtype w_dtype, const Shape& w_shape, const Array& x, const Array& gy, const Dims& stride, const Dims& pad, bool cover_all) {
+        Dtype w_dtype,
+        const Shape& w_shape,
+        const Array& x,
+        const Array& gy,
+        const Dims& stride,
+        const Dims& pad,
+        const Dims& dilate,
+        bool cover_all) {
     CHAINERX_ASSERT(x.ndim() == w_shape.ndim());
     CHAINERX_ASSERT(gy.ndim() == w_shape.ndim());
     CHAINERX_ASSERT(stride.size() == static_cast<size_t>(w_shape.ndim() - 2));
     CHAINERX_ASSERT(pad.size() == static_cast<size_t>(w_shape.ndim() - 2));
+    CHAINERX_ASSERT(dilate.size() == static_cast<size_t>(w_shape.ndim() - 2));
 
     Array out{};
     {
         NoBackpropModeScope scope{};
-        out = x.device().backend().CallKernel<ConvGradWeightKernel>(w_dtype, w_shape, x, gy, stride, pad, cover_all, absl::nullopt);
+        out = x.device().backend().CallKernel<ConvGradWeightKernel>(w_dtype, w_shape, x, gy, stride, pad, dilate, cover_all, absl::nullopt);
         CHAINERX_ASSERT(out.dtype() == w_dtype);
     }
 
@@ -94,20 +118,20 @@ Array ConvGradWeight(
         BackwardBuilder bb{"conv-grad-weight", {x, gy}, out};
 
         if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-            bt.Define([x_shape = x.shape(), x_dtype = x.dtype(), gy_tok = bb.RetainInput(1), stride, pad](BackwardContext& bctx) {
+            bt.Define([x_shape = x.shape(), x_dtype = x.dtype(), gy_tok = bb.RetainInput(1), stride, pad, dilate](BackwardContext& bctx) {
                 const Array& gy = bctx.GetRetainedInput(gy_tok);
                 const Array& gout = *bctx.output_grad();
                 Dims out_size{x_shape.begin() + 2, x_shape.end()};
                 CHAINERX_ASSERT(out_size.size() == stride.size());
-                bctx.input_grad() = ConvTranspose(gy, gout, absl::nullopt, stride, pad, out_size, x_dtype);
+                bctx.input_grad() = ConvTranspose(gy, gout, absl::nullopt, stride, pad, out_size, x_dtype, dilate);
             });
         }
 
         if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
-            bt.Define([gy_dtype = gy.dtype(), x_tok = bb.RetainInput(0), stride, pad, cover_all](BackwardContext& bctx) {
+            bt.Define([gy_dtype = gy.dtype(), x_tok = bb.RetainInput(0), stride, pad, dilate, cover_all](BackwardContext& bctx) {
                 const Array& x = bctx.GetRetainedInput(x_tok);
                 const Array& gout = *bctx.output_grad();
-                bctx.input_grad() = Conv(x, gout, absl::nullopt, stride, pad, cover_all, gy_dtype);
+                bctx.input_grad() = Conv(x, gout, absl::nullopt, stride, pad, cover_all, gy_dtype, dilate);
             });
         }
         bb.Finalize();
@@ -116,7 +140,8 @@ Array ConvGradWeight(
     return out;
 }
 
-void ConvCheckNdim(const Array& x, const Array& w, const Dims& stride, const Dims& pad) {
+// Checks the dimensions of the arguments and returns the dilation, which defaults to all ones.
+Dims ConvCheckNdim(const Array& x, const Array& w, const Dims& stride, const Dims& pad, const absl::optional<Dims>& dilate) {
     if (w.ndim() != x.ndim()) {
         throw DimensionError{"Mismatched number of dimensions between input ", x.ndim(), " and weights ", w.ndim(), "."};
     }
@@ -133,6 +158,15 @@ void ConvCheckNdim(const Array& x, const Array& w, const Dims& stride, const Dim
     if (std::any_of(stride.begin(), stride.end(), [](int64_t s) { return s <= 0; })) {
         throw DimensionError{"Stride elements must be greater than 0: ", DimsFormatter{stride}, "."};
     }
+    if (dilate.has_value()) {
+        if (static_cast<int8_t>(dilate->size()) != ndim) {
+            throw DimensionError{"Wrong numbers of dilations ", dilate->size(), " for input with ", x.ndim(), " dimensions."};
+        }
+        if (std::any_of(dilate->begin(), dilate->end(), [](int64_t d) { return d <= 0; })) {
+            throw DimensionError{"Dilation elements must be greater than 0: ", DimsFormatter{*dilate}, "."};
+        }
+    }
+    return internal::GetDilateOrDefault(dilate, ndim);
 }
 
 }  // namespace
@@ -144,8 +178,9 @@ Array Conv(
         const Dims& stride,
         const Dims& pad,
         bool cover_all,
-        absl::optional<Dtype> out_dtype) {
-    ConvCheckNdim(x, w, stride, pad);
+        absl::optional<Dtype> out_dtype,
+        const absl::optional<Dims>& dilate) {
+    Dims real_dilate = ConvCheckNdim(x, w, stride, pad, dilate);
     if (w.shape()[1] != x.shape()[1]) {
         throw DimensionError{"Mismatched number of input channels in input ", x.shape(), " and weights ", w.shape(), "."};
     }
@@ -158,7 +193,7 @@ Array Conv(
     Array out{};
     {
         NoBackpropModeScope scope{};
-        out = x.device().backend().CallKernel<ConvKernel>(x, w, b, stride, pad, cover_all, real_out_dtype, absl::nullopt);
+        out = x.device().backend().CallKernel<ConvKernel>(x, w, b, stride, pad, real_dilate, cover_all, real_out_dtype, absl::nullopt);
     }
 
     {
@@ -172,19 +207,30 @@ Array Conv(
         BackwardBuilder bb{"conv", std::move(inputs), out};
 
         if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-            bt.Define([x_shape = x.shape(), x_dtype = x.dtype(), w_tok = bb.RetainInput(1), stride, pad](BackwardContext& bctx) {
+            bt.Define([x_shape = x.shape(),
+                       x_dtype = x.dtype(),
+                       w_tok = bb.RetainInput(1),
+                       stride,
+                       pad,
+                       real_dilate](BackwardContext& bctx) {
                 const Array& w = bctx.GetRetainedInput(w_tok);
                 const Array& gout = *bctx.output_grad();
                 Dims out_size{x_shape.begin() + 2, x_shape.end()};
-                bctx.input_grad() = ConvTranspose(gout, w, absl::nullopt, stride, pad, out_size, x_dtype);
+                bctx.input_grad() = ConvTranspose(gout, w, absl::nullopt, stride, pad, out_size, x_dtype, real_dilate);
             });
         }
 
         if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
-            bt.Define([w_dtype = w.dtype(), w_shape = w.shape(), x_tok = bb.RetainInput(0), stride, pad, cover_all](BackwardContext& bctx) {
+            bt.Define([w_dtype = w.dtype(),
+                       w_shape = w.shape(),
+                       x_tok = bb.RetainInput(0),
+                       stride,
+                       pad,
+                       real_dilate,
+                       cover_all](BackwardContext& bctx) {
                 const Array& x = bctx.GetRetainedInput(x_tok);
                 const Array& gout = *bctx.output_grad();
-                bctx.input_grad() = ConvGradWeight(w_dtype, w_shape, x, gout, stride, pad, cover_all);
+                bctx.input_grad() = ConvGradWeight(w_dtype, w_shape, x, gout, stride, pad, real_dilate, cover_all);
             });
         }
 
@@ -214,8 +260,9 @@ Array ConvTranspose(
         const Dims& stride,
         const Dims& pad,
         const absl::optional<Dims>& out_size,
-        absl::optional<Dtype> out_dtype) {
-    ConvCheckNdim(x, w, stride, pad);
+        absl::optional<Dtype> out_dtype,
+        const absl::optional<Dims>& dilate) {
+    Dims real_dilate = ConvCheckNdim(x, w, stride, pad, dilate);
     if (x.shape()[1] != w.shape()[0]) {
         throw DimensionError{"Mismatched number of input channels in input ", x.shape(), " and weights ", w.shape(), "."};
     }
@@ -241,7 +288,7 @@ Array ConvTranspose(
 
         // Detect cover_all from out_size
         for (int8_t i = 0; i < ndim; ++i) {
-            if (in_dims[i] != internal::GetConvOutDim(real_out_size[i], kernel_size[i], stride[i], pad[i], false)) {
+            if (in_dims[i] != internal::GetConvOutDim(real_out_size[i], kernel_size[i], stride[i], pad[i], false, real_dilate[i])) {
                 cover_all = true;
                 break;
             }
@@ -249,7 +296,7 @@ Array ConvTranspose(
     } else {
         // cover_all is assumed to be false.
         for (int8_t i = 0; i < ndim; ++i) {
-            int64_t out_dim = internal::GetConvTransposeOutDim(in_dims[i], kernel_size[i], stride[i], pad[i], cover_all);
+            int64_t out_dim = internal::GetConvTransposeOutDim(in_dims[i], kernel_size[i], stride[i], pad[i], cover_all, real_dilate[i]);
             if (out_dim < 0) {
                 throw DimensionError{"Inconsistent dimensions. Output dimension at axis ", i, " would be negative."};
             }
@@ -259,7 +306,7 @@ Array ConvTranspose(
 
     // Check out_size and cover_all are consistent
     for (int8_t i = 0; i < ndim; ++i) {
-        if (in_dims[i] != internal::GetConvOutDim(real_out_size[i], kernel_size[i], stride[i], pad[i], cover_all)) {
+        if (in_dims[i] != internal::GetConvOutDim(real_out_size[i], kernel_size[i], stride[i], pad[i], cover_all, real_dilate[i])) {
             throw DimensionError{"Output dims ", Shape{real_out_size.begin(), real_out_size.end()}, " are incosistent."};
         }
     }
@@ -270,7 +317,8 @@ Array ConvTranspose(
     Array out{};
     {
         NoBackpropModeScope scope{};
-        out = x.device().backend().CallKernel<ConvTransposeKernel>(x, w, b, stride, pad, real_out_size, real_out_dtype, absl::nullopt);
+        out = x.device().backend().CallKernel<ConvTransposeKernel>(
+                x, w, b, stride, pad, real_dilate, real_out_size, real_out_dtype, absl::nullopt);
     }
 
     {
@@ -284,19 +332,31 @@ Array ConvTranspose(
         BackwardBuilder bb{"conv_transpose", std::move(inputs), out};
 
         if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-            bt.Define([x_shape = x.shape(), x_dtype = x.dtype(), w_tok = bb.RetainInput(1), stride, pad, cover_all](BackwardContext& bctx) {
+            bt.Define([x_shape = x.shape(),
+                       x_dtype = x.dtype(),
+                       w_tok = bb.RetainInput(1),
+                       stride,
+                       pad,
+                       real_dilate,
+                       cover_all](BackwardContext& bctx) {
                 const Array& w = bctx.GetRetainedInput(w_tok);
                 const Array& gout = *bctx.output_grad();
                 Dims out_size{x_shape.begin() + 2, x_shape.end()};
-                bctx.input_grad() = Conv(gout, w, absl::nullopt, stride, pad, cover_all, x_dtype);
+                bctx.input_grad() = Conv(gout, w, absl::nullopt, stride, pad, cover_all, x_dtype, real_dilate);
             });
         }
 
         if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
-            bt.Define([w_dtype = w.dtype(), w_shape = w.shape(), x_tok = bb.RetainInput(0), stride, pad, cover_all](BackwardContext& bctx) {
+            bt.Define([w_dtype = w.dtype(),
+                       w_shape = w.shape(),
+                       x_tok = bb.RetainInput(0),
+                       stride,
+                       pad,
+                       real_dilate,
+                       cover_all](BackwardContext& bctx) {
                 const Array& x = bctx.GetRetainedInput(x_tok);
                 const Array& gout = *bctx.output_grad();
-                bctx.input_grad() = ConvGradWeight(w_dtype, w_shape, gout, x, stride, pad, cover_all);
+                bctx.input_grad() = ConvGradWeight(w_dtype, w_shape, gout, x, stride, pad, real_dilate, cover_all);
             });
         }
 
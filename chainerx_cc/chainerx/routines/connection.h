@@ -13,11 +13,15 @@ namespace chainerx {
 namespace internal {
 
 // Calculates output size of convolution.
+// A kernel of size k dilated by d covers d * (k - 1) + 1 input elements.
 //
 // DimensionError is thrown if the output size is 0 or negative.
-int64_t GetConvOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all);
+int64_t GetConvOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all, int64_t dilate = 1);
 
-int64_t GetConvTransposeOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all);
+int64_t GetConvTransposeOutDim(int64_t in_dim, int64_t kernel_size, int64_t stride, int64_t pad, bool cover_all, int64_t dilate = 1);
+
+// Returns dilate if given and all ones of size ndim otherwise.
+Dims GetDilateOrDefault(const absl::optional<Dims>& dilate, int8_t ndim);
 
 }  // namespace internal
 
@@ -28,6 +32,8 @@ int64_t GetConvTransposeOutDim(int64_t in_dim, int64_t kernel_size, int64_t stri
 // b: (out_channels)
 //
 // Returns an array of shape (batch_size, out_channels, out_1, out_2, ..., out_n).
+//
+// If dilate is given, kernel elements are applied to input elements dilate apart along each spatial dimension. Otherwise it is all ones.
 Array Conv(
         const Array& x,
         const Array& w,
@@ -35,7 +41,8 @@ Array Conv(
         const Dims& stride,
         const Dims& pad,
         bool cover_all = false,
-        absl::optional<Dtype> out_dtype = absl::nullopt);
+        absl::optional<Dtype> out_dtype = absl::nullopt,
+        const absl::optional<Dims>& dilate = absl::nullopt);
 
 Array ConvTranspose(
         const Array& x,
@@ -44,7 +51,8 @@ Array ConvTranspose(
         const Dims& stride,
         const Dims& pad,
         const absl::optional<Dims>& out_size = absl::nullopt,
-        absl::optional<Dtype> out_dtype = absl::nullopt);
+        absl::optional<Dtype> out_dtype = absl::nullopt,
+        const absl::optional<Dims>& dilate = absl::nullopt);
 
 Array Linear(const Array& x, const Array& w, const absl::optional<Array>& b = absl::nullopt, uint8_t n_batch_axes = 1);
 
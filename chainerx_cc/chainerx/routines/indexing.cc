@@ -1,6 +1,7 @@
 #include "chainerx/routines/indexing.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <utility>
@@ -15,17 +16,22 @@
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
 #include "chainerx/constant.h"
+#include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/error.h"
 #include "chainerx/graph.h"
-#include "chainerx/kernels/arithmetic.h"
+#include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/indexing.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/routines/logic.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/misc.h"
 #include "chainerx/routines/reduction.h"
+#include "chainerx/routines/statistics.h"
 #include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 #include "chainerx/slice.h"
 #include "chainerx/strides.h"
@@ -38,27 +44,24 @@ namespace {
 //
 // It is not in-place  operation: the input arrays are not altered.
 // It is differentiable with respect to `a` and `b`.
-Array AtGrad(const Array& a, const std::vector<ArrayIndex>& indices, const Array& b) {
-    // TODO(sonots): dtype conversion
-    CheckEqual(a.dtype(), b.dtype());
-
-    Array out = a.AsGradStopped(CopyKind::kCopy);
-    Array out_view = out.At(indices);
-
-    // TODO(sonots): broadcasting
-    CheckEqual(out_view.shape(), b.shape());
+// Returns an array of the given shape which is zero except for the region selected by the indices, where it equals to b.
+// Used to compute the gradient of At() when the next order of backward is required.
+Array AtGrad(const Shape& shape, const std::vector<ArrayIndex>& indices, const Array& b) {
+    Array out = Zeros(shape, b.dtype(), b.device());
 
     {
         NoBackpropModeScope scope{};
-        a.device().backend().CallKernel<AddKernel>(b, out_view, out_view);
+        Array out_view = out.At(indices);
+
+        // TODO(sonots): broadcasting
+        CheckEqual(out_view.shape(), b.shape());
+
+        b.device().backend().CallKernel<CopyKernel>(b, out_view);
     }
 
     {
-        BackwardBuilder bb{"add_at", {a, b}, out};
+        BackwardBuilder bb{"add_at", b, out};
         if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-            bt.Define([](BackwardContext& bctx) { bctx.input_grad() = *bctx.output_grad(); });
-        }
-        if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
             bt.Define([indices](BackwardContext& bctx) { bctx.input_grad() = bctx.output_grad()->At(indices); });
         }
         bb.Finalize();
@@ -120,10 +123,14 @@ Array At(const Array& a, const std::vector<ArrayIndex>& indices) {
 
     BackwardBuilder bb{"get_item", a, out};
     if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-        bt.Define([indices = std::move(normalized_indices), a_shape = a.shape(), a_dtype = a.dtype()](BackwardContext& bctx) {
+        bt.Define([indices = std::move(normalized_indices), a_shape = a.shape()](BackwardContext& bctx) {
             const Array& gout = *bctx.output_grad();
-            Array gin = Zeros(a_shape, a_dtype, gout.device());
-            bctx.input_grad() = AtGrad(gin, indices, gout);
+            if (bctx.next_required()) {
+                bctx.input_grad() = AtGrad(a_shape, indices, gout);
+            } else {
+                // Gradients of multiple slices of the same array are accumulated into a single buffer.
+                bctx.SetInputRegionGrad(indices, gout);
+            }
         });
     }
     bb.Finalize();
@@ -297,6 +304,190 @@ Array Where(const Array& condition, Scalar x, Scalar y) {
     return out;
 }
 
+namespace {
+
+template <typename B, typename X, typename Y>
+struct WhereCompareKernelType;
+
+template <>
+struct WhereCompareKernelType<Array, Array, Array> {
+    using type = WhereCompareAAAAKernel;
+};
+
+template <>
+struct WhereCompareKernelType<Array, Array, Scalar> {
+    using type = WhereCompareAAASKernel;
+};
+
+template <>
+struct WhereCompareKernelType<Array, Scalar, Array> {
+    using type = WhereCompareAASAKernel;
+};
+
+template <>
+struct WhereCompareKernelType<Array, Scalar, Scalar> {
+    using type = WhereCompareAASSKernel;
+};
+
+template <>
+struct WhereCompareKernelType<Scalar, Array, Array> {
+    using type = WhereCompareASAAKernel;
+};
+
+template <>
+struct WhereCompareKernelType<Scalar, Array, Scalar> {
+    using type = WhereCompareASASKernel;
+};
+
+template <>
+struct WhereCompareKernelType<Scalar, Scalar, Array> {
+    using type = WhereCompareASSAKernel;
+};
+
+template <>
+struct WhereCompareKernelType<Scalar, Scalar, Scalar> {
+    using type = WhereCompareASSSKernel;
+};
+
+// Helpers to handle array and scalar operands of WhereCompare uniformly.
+Shape GetOperandShape(const Array& operand) { return operand.shape(); }
+
+Shape GetOperandShape(Scalar /*operand*/) { return Shape{}; }
+
+Array BroadcastOperand(const Array& operand, const Shape& shape) { return operand.BroadcastTo(shape); }
+
+Scalar BroadcastOperand(Scalar operand, const Shape& /*shape*/) { return operand; }
+
+Array GradStoppedOperand(const Array& operand) { return operand.AsGradStopped(); }
+
+Scalar GradStoppedOperand(Scalar operand) { return operand; }
+
+Array CastOperand(const Array& operand, Dtype dtype) { return operand.dtype() == dtype ? operand : operand.AsType(dtype); }
+
+Scalar CastOperand(Scalar operand, Dtype /*dtype*/) { return operand; }
+
+Array CompareOperands(CompareOp op, const Array& a, const Array& b) {
+    switch (op) {
+        case CompareOp::kEqual:
+            return Equal(a, b);
+        case CompareOp::kNotEqual:
+            return NotEqual(a, b);
+        case CompareOp::kGreater:
+            return Greater(a, b);
+        case CompareOp::kGreaterEqual:
+            return GreaterEqual(a, b);
+        case CompareOp::kLess:
+            return Less(a, b);
+        case CompareOp::kLessEqual:
+            return LessEqual(a, b);
+    }
+    CHAINERX_NEVER_REACH();
+}
+
+Array CompareOperands(CompareOp op, const Array& a, Scalar b) { return CompareOperands(op, a, Full({}, b, a.dtype(), a.device())); }
+
+void CheckCompareOperandDtypes(const Array& a, DtypeKind b_kind) {
+    if ((GetKind(a.dtype()) == DtypeKind::kBool) != (b_kind == DtypeKind::kBool)) {
+        throw DtypeError{"Comparison of bool and non-bool dtypes is not supported."};
+    }
+}
+
+void CheckCompareOperandDtypes(const Array& a, const Array& b) { CheckCompareOperandDtypes(a, GetKind(b.dtype())); }
+
+void CheckCompareOperandDtypes(const Array& a, Scalar b) { CheckCompareOperandDtypes(a, b.kind()); }
+
+void AppendBranchInput(std::vector<ConstArrayRef>& inputs, const Array& branch) { inputs.emplace_back(branch); }
+
+void AppendBranchInput(std::vector<ConstArrayRef>& /*inputs*/, Scalar /*branch*/) {}
+
+// Defines the backward of a branch, where the gradient is computed from the output gradient by the given function.
+template <typename GradFunc>
+void DefineBranchBackward(BackwardBuilder& bb, size_t& input_index, const Array& branch, GradFunc&& grad_func) {
+    if (BackwardBuilder::Target bt = bb.CreateTarget(input_index)) {
+        bt.Define([dtype = branch.dtype(), grad_func = std::forward<GradFunc>(grad_func)](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            Array g = grad_func(gout);
+            bctx.input_grad() = g.dtype() == dtype ? std::move(g) : g.AsType(dtype);
+        });
+    }
+    ++input_index;
+}
+
+template <typename GradFunc>
+void DefineBranchBackward(BackwardBuilder& /*bb*/, size_t& /*input_index*/, Scalar /*branch*/, GradFunc&& /*grad_func*/) {}
+
+template <typename B, typename X, typename Y>
+Array WhereCompareImpl(CompareOp op, const Array& a, const B& b, const X& x, const Y& y) {
+    CheckCompareOperandDtypes(a, b);
+
+    // The kernels compare a and b in the dtype of the output. If they are compared in another dtype, the condition is materialized.
+    Dtype compare_dtype = ResultType(a, b);
+    Dtype out_dtype = ResultType(x, y);
+    if (compare_dtype != out_dtype) {
+        return Where(CompareOperands(op, CastOperand(a, compare_dtype), CastOperand(b, compare_dtype)), x, y);
+    }
+
+    Shape out_shape = internal::BroadcastShapes(
+            internal::BroadcastShapes(a.shape(), GetOperandShape(b)),
+            internal::BroadcastShapes(GetOperandShape(x), GetOperandShape(y)));
+    Array out = Empty(out_shape, out_dtype, a.device());
+    Array a_b = a.BroadcastTo(out_shape);
+    B b_b = BroadcastOperand(b, out_shape);
+    X x_b = BroadcastOperand(x, out_shape);
+    Y y_b = BroadcastOperand(y, out_shape);
+
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<typename WhereCompareKernelType<B, X, Y>::type>(
+                op,
+                CastOperand(a_b, out_dtype),
+                CastOperand(b_b, out_dtype),
+                CastOperand(x_b, out_dtype),
+                CastOperand(y_b, out_dtype),
+                out);
+    }
+
+    std::vector<ConstArrayRef> branches;
+    AppendBranchInput(branches, x_b);
+    AppendBranchInput(branches, y_b);
+    if (branches.empty()) {
+        return out;
+    }
+
+    // The operands of the comparison are retained instead of the condition, which is evaluated again in the backward.
+    BackwardBuilder bb{"where_compare", std::move(branches), out};
+    size_t input_index = 0;
+    DefineBranchBackward(bb, input_index, x_b, [op, a = a_b.AsGradStopped(), b = GradStoppedOperand(b_b)](const Array& gout) {
+        return WhereCompareImpl(op, a, b, gout, Scalar{0, GetKind(gout.dtype())});
+    });
+    DefineBranchBackward(bb, input_index, y_b, [op, a = a_b.AsGradStopped(), b = GradStoppedOperand(b_b)](const Array& gout) {
+        return WhereCompareImpl(op, a, b, Scalar{0, GetKind(gout.dtype())}, gout);
+    });
+    bb.Finalize();
+
+    return out;
+}
+
+}  // namespace
+
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, const Array& x, const Array& y) {
+    return WhereCompareImpl(op, a, b, x, y);
+}
+
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, const Array& x, Scalar y) { return WhereCompareImpl(op, a, b, x, y); }
+
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, Scalar x, const Array& y) { return WhereCompareImpl(op, a, b, x, y); }
+
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, Scalar x, Scalar y) { return WhereCompareImpl(op, a, b, x, y); }
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, const Array& x, const Array& y) { return WhereCompareImpl(op, a, b, x, y); }
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, const Array& x, Scalar y) { return WhereCompareImpl(op, a, b, x, y); }
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, Scalar x, const Array& y) { return WhereCompareImpl(op, a, b, x, y); }
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, Scalar x, Scalar y) { return WhereCompareImpl(op, a, b, x, y); }
+
 std::vector<Array> Nonzero(const Array& a) {
     if (a.ndim() == 0) {
         throw DimensionError{"0-dim inputs not allowed."};
@@ -322,4 +513,231 @@ std::vector<Array> Nonzero(const Array& a) {
     return out;
 }
 
+namespace {
+
+// Returns the indices or offsets of embedding bags as a contiguous int64 array.
+Array AsEmbeddingBagIndices(const Array& indices, const Device& device) {
+    CheckEqual(indices.device(), device);
+    if (indices.ndim() != 1) {
+        throw DimensionError{"Indices and offsets of embedding bags must be 1-dimensional, but got shape ", indices.shape(), "."};
+    }
+    if (GetKind(indices.dtype()) != DtypeKind::kInt && GetKind(indices.dtype()) != DtypeKind::kUInt) {
+        throw DtypeError{"Indices and offsets of embedding bags must be of an integral dtype, but got ", indices.dtype(), "."};
+    }
+    return AsContiguous(indices, Dtype::kInt64);
+}
+
+void CheckEmbeddingBagIndices(const Array& indices, const Array& offsets, int64_t row_count) {
+    NoBackpropModeScope scope{};
+    int64_t index_count = indices.GetTotalSize();
+    if (index_count > 0) {
+        auto min_index = static_cast<int64_t>(AsScalar(AMin(indices)));
+        auto max_index = static_cast<int64_t>(AsScalar(AMax(indices)));
+        if (min_index < 0 || row_count <= max_index) {
+            throw IndexError{
+                    "Indices of embedding bags range from ", min_index, " to ", max_index, ", out of bounds of ", row_count, " rows."};
+        }
+    }
+    int64_t bag_count = offsets.GetTotalSize();
+    if (bag_count > 0) {
+        if (static_cast<int64_t>(AsScalar(offsets.At({0}))) != 0 ||
+            static_cast<int64_t>(AsScalar(offsets.At({bag_count - 1}))) > index_count ||
+            (bag_count > 1 &&
+             static_cast<int64_t>(AsScalar(AMin(offsets.At({Slice{1, bag_count}}) - offsets.At({Slice{0, bag_count - 1}})))) < 0)) {
+            throw IndexError{"Offsets of embedding bags must be non-decreasing from 0 up to the number of indices."};
+        }
+    }
+}
+
+// Returns the bag of each of the indices.
+Array GetEmbeddingBagIds(const Array& offsets, int64_t index_count) {
+    // The bag of each index is the number of bags starting at or before it, but the first.
+    NoBackpropModeScope scope{};
+    int64_t bag_count = offsets.GetTotalSize();
+    Array bag_starts = Zeros(Shape{index_count + 1}, Dtype::kInt64, offsets.device());
+    if (bag_count > 1) {
+        Array starts = offsets.At({Slice{1, bag_count}});
+        bag_starts = AddAt(bag_starts, starts, 0, OnesLike(starts));
+    }
+    return Cumsum(bag_starts).At({Slice{0, index_count}});
+}
+
+// Returns the dot products of the rows of the table at indices and the rows of bags of their bags, which is the gradient of the weights.
+Array EmbeddingBagWeightGrad(const Array& table, const Array& bags, const Array& indices, const Array& offsets) {
+    Array bag_ids = GetEmbeddingBagIds(offsets, indices.GetTotalSize());
+    return Sum(Take(table, indices, 0) * Take(bags, bag_ids, 0), Axes{1});
+}
+
+Array EmbeddingBagSum(const Array& table, const Array& indices, const Array& offsets, const absl::optional<Array>& weights);
+
+// Scatters the rows of gout, the gradient of the weighted sums of the embedding bags, to the rows of a table of row_count rows.
+// The gradient of gout is the weighted sums of the embedding bags of the output gradient.
+Array EmbeddingBagGrad(
+        const Array& gout, const Array& indices, const Array& offsets, const absl::optional<Array>& weights, int64_t row_count) {
+    Array out = Zeros(Shape{row_count, gout.shape()[1]}, gout.dtype(), gout.device());
+    {
+        NoBackpropModeScope scope{};
+        gout.device().backend().CallKernel<EmbeddingBagGradKernel>(gout, indices, offsets, weights, out);
+    }
+
+    {
+        std::vector<ConstArrayRef> inputs{gout};
+        if (weights.has_value()) {
+            inputs.emplace_back(*weights);
+        }
+        BackwardBuilder bb{"embedding_bag_grad", std::move(inputs), out};
+        if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+            absl::optional<RetainedInputToken> weights_tok{};
+            if (weights.has_value()) {
+                weights_tok.emplace(bb.RetainInput(1));
+            }
+            bt.Define([indices, offsets, weights_tok](BackwardContext& bctx) {
+                absl::optional<Array> weights{};
+                if (weights_tok.has_value()) {
+                    weights = bctx.GetRetainedInput(*weights_tok);
+                }
+                bctx.input_grad() = EmbeddingBagSum(*bctx.output_grad(), indices, offsets, weights);
+            });
+        }
+        if (weights.has_value()) {
+            if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
+                bt.Define([indices, offsets, gout_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+                    bctx.input_grad() = EmbeddingBagWeightGrad(*bctx.output_grad(), bctx.GetRetainedInput(gout_tok), indices, offsets);
+                });
+            }
+        }
+        bb.Finalize();
+    }
+
+    return out;
+}
+
+// Returns the weighted sums of the embedding bags.
+// The gradient of the table is scattered from the output gradient by EmbeddingBagGrad.
+Array EmbeddingBagSum(const Array& table, const Array& indices, const Array& offsets, const absl::optional<Array>& weights) {
+    Array out = Empty(Shape{offsets.GetTotalSize(), table.shape()[1]}, table.dtype(), table.device());
+    {
+        NoBackpropModeScope scope{};
+        table.device().backend().CallKernel<EmbeddingBagKernel>(
+                table, indices, offsets, weights, SegmentReduction::kSum, out, absl::nullopt);
+    }
+
+    {
+        std::vector<ConstArrayRef> inputs{table};
+        if (weights.has_value()) {
+            inputs.emplace_back(*weights);
+        }
+        BackwardBuilder bb{"embedding_bag", std::move(inputs), out};
+        if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+            absl::optional<RetainedInputToken> weights_tok{};
+            if (weights.has_value()) {
+                weights_tok.emplace(bb.RetainInput(1));
+            }
+            bt.Define([indices, offsets, weights_tok, row_count = table.shape()[0]](BackwardContext& bctx) {
+                absl::optional<Array> weights{};
+                if (weights_tok.has_value()) {
+                    weights = bctx.GetRetainedInput(*weights_tok);
+                }
+                bctx.input_grad() = EmbeddingBagGrad(*bctx.output_grad(), indices, offsets, weights, row_count);
+            });
+        }
+        if (weights.has_value()) {
+            if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
+                bt.Define([indices, offsets, table_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+                    bctx.input_grad() = EmbeddingBagWeightGrad(bctx.GetRetainedInput(table_tok), *bctx.output_grad(), indices, offsets);
+                });
+            }
+        }
+        bb.Finalize();
+    }
+
+    return out;
+}
+
+// Returns the maxima or minima of the embedding bags.
+// The output gradient is scattered to the rows of the table the maxima or minima are taken from.
+Array EmbeddingBagExtremum(const Array& table, const Array& indices, const Array& offsets, SegmentReduction reduction) {
+    Shape out_shape{offsets.GetTotalSize(), table.shape()[1]};
+    Array out = Empty(out_shape, table.dtype(), table.device());
+    Array arg = Empty(out_shape, Dtype::kInt64, table.device());
+    {
+        NoBackpropModeScope scope{};
+        table.device().backend().CallKernel<EmbeddingBagKernel>(table, indices, offsets, absl::nullopt, reduction, out, arg);
+    }
+
+    BackwardBuilder bb{"embedding_bag", table, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([arg, table_shape = table.shape()](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            int64_t row_count = table_shape[0];
+            int64_t dim = table_shape[1];
+
+            // Empty bags, whose rows are -1, are scattered to an extra first row which is dropped.
+            Array flat_indices{};
+            {
+                NoBackpropModeScope scope{};
+                flat_indices = ((arg + 1) * dim + Arange(dim, Dtype::kInt64, arg.device())).Reshape({arg.GetTotalSize()});
+            }
+            Array zeros = Zeros(Shape{(row_count + 1) * dim}, gout.dtype(), gout.device());
+            Array gtable = AddAt(zeros, flat_indices, 0, gout.Reshape({gout.GetTotalSize()}));
+            bctx.input_grad() = gtable.Reshape({row_count + 1, dim}).At({Slice{1, row_count + 1}});
+        });
+    }
+    bb.Finalize();
+    return out;
+}
+
+}  // namespace
+
+Array EmbeddingBag(
+        const Array& table,
+        const Array& indices,
+        const Array& offsets,
+        SegmentReduction mode,
+        const absl::optional<Array>& per_sample_weights) {
+    if (table.ndim() != 2) {
+        throw DimensionError{"Embedding tables must be 2-dimensional, but got shape ", table.shape(), "."};
+    }
+    if (table.dtype() == Dtype::kBool) {
+        throw DtypeError{"Embedding bags do not support dtype ", table.dtype(), "."};
+    }
+    Array indices_cast = AsEmbeddingBagIndices(indices, table.device());
+    Array offsets_cast = AsEmbeddingBagIndices(offsets, table.device());
+    CheckEmbeddingBagIndices(indices_cast, offsets_cast, table.shape()[0]);
+
+    absl::optional<Array> weights{};
+    if (per_sample_weights.has_value()) {
+        CheckEqual(per_sample_weights->device(), table.device());
+        if (mode != SegmentReduction::kSum) {
+            throw ChainerxError{"Per-sample weights of embedding bags are only supported with the sum."};
+        }
+        if (per_sample_weights->shape() != indices.shape()) {
+            throw DimensionError{
+                    "Per-sample weights of shape ", per_sample_weights->shape(), " do not match indices of shape ", indices.shape(), "."};
+        }
+        weights = per_sample_weights->AsType(table.dtype(), false);
+    }
+
+    switch (mode) {
+        case SegmentReduction::kSum:
+            return EmbeddingBagSum(table, indices_cast, offsets_cast, weights);
+        case SegmentReduction::kMean: {
+            Array sum = EmbeddingBagSum(table, indices_cast, offsets_cast, absl::nullopt);
+            int64_t bag_count = offsets_cast.GetTotalSize();
+            Array counts{};
+            {
+                NoBackpropModeScope scope{};
+                Array bounds = Concatenate({offsets_cast, Full(Shape{1}, indices_cast.GetTotalSize(), Dtype::kInt64, table.device())}, 0);
+                counts = bounds.At({Slice{1, bag_count + 1}}) - bounds.At({Slice{0, bag_count}});
+                counts = Maximum(counts, Scalar{1}).Reshape({bag_count, 1});
+            }
+            return TrueDivide(sum, counts);
+        }
+        case SegmentReduction::kMax:
+        case SegmentReduction::kMin:
+            return EmbeddingBagExtremum(table, indices_cast, offsets_cast, mode);
+    }
+    CHAINERX_NEVER_REACH();
+}
+
 }  // namespace chainerx
@@ -3,8 +3,11 @@
 #include <cstdint>
 #include <vector>
 
+#include <absl/types/optional.h>
+
 #include "chainerx/array.h"
 #include "chainerx/array_index.h"
+#include "chainerx/routines/reduction.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
@@ -42,6 +45,49 @@ Array Where(const Array& condition, Scalar x, const Array& y);
 
 Array Where(const Array& condition, Scalar x, Scalar y);
 
+enum class CompareOp {
+    kEqual,
+    kNotEqual,
+    kGreater,
+    kGreaterEqual,
+    kLess,
+    kLessEqual,
+};
+
+// Returns elements chosen from x where the comparison of a and b holds and from y elsewhere.
+// It is equivalent to Where(a op b, x, y) but does not materialize the boolean condition, either in the forward or in the backward.
+// Since NaN is the only value not equal to itself, WhereCompare(CompareOp::kNotEqual, a, a, x, y) is equivalent to Where(IsNan(a), x, y).
+//
+// It is differentiable with respect to x and y.
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, const Array& x, const Array& y);
+
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, const Array& x, Scalar y);
+
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, Scalar x, const Array& y);
+
+Array WhereCompare(CompareOp op, const Array& a, const Array& b, Scalar x, Scalar y);
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, const Array& x, const Array& y);
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, const Array& x, Scalar y);
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, Scalar x, const Array& y);
+
+Array WhereCompare(CompareOp op, const Array& a, Scalar b, Scalar x, Scalar y);
+
 std::vector<Array> Nonzero(const Array& a);
 
+// Reduces the rows of the 2-dimensional table at indices into bags, without gathering them into an intermediate array.
+// The b-th bag consists of the rows at indices[offsets[b]:offsets[b + 1]], and the last one of those up to the end of indices. offsets must
+// be non-decreasing from 0. Empty bags are zeros.
+// If per_sample_weights is given, the rows are multiplied by their weights before being summed, which is only supported with kSum.
+//
+// It is differentiable with respect to table and per_sample_weights.
+Array EmbeddingBag(
+        const Array& table,
+        const Array& indices,
+        const Array& offsets,
+        SegmentReduction mode = SegmentReduction::kSum,
+        const absl::optional<Array>& per_sample_weights = absl::nullopt);
+
 }  // namespace chainerx
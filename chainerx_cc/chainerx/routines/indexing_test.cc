@@ -0,0 +1,163 @@
+#include "chainerx/routines/indexing.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/check_backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/logic.h"
+#include "chainerx/scalar.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+#include "chainerx/testing/routines.h"
+#include "chainerx/testing/threading.h"
+
+namespace chainerx {
+namespace {
+
+class IndexingTest : public ::testing::TestWithParam<std::string> {
+protected:
+    void SetUp() override {
+        const std::string& backend_name = GetParam();
+        device_session_.emplace(DeviceId{backend_name, 0});
+    }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_THREAD_SAFE_P(IndexingTest, WhereCompareArrays) {
+    using T = float;
+
+    Array a = testing::BuildArray({2, 3}).WithData<T>({1, 2, 3, 4, 5, 6}).WithPadding(1);
+    Array b = testing::BuildArray({3}).WithData<T>({3, 2, 4});
+    Array x = testing::BuildArray({2, 3}).WithLinearData<T>(10);
+    Array y = testing::BuildArray({2, 1}).WithData<T>({-1, -2});
+
+    struct Case {
+        CompareOp op;
+        Array expected;
+    };
+    std::vector<Case> cases = {
+            {CompareOp::kEqual, testing::BuildArray({2, 3}).WithData<T>({-1, 11, -1, -2, -2, -2})},
+            {CompareOp::kNotEqual, testing::BuildArray({2, 3}).WithData<T>({10, -1, 12, 13, 14, 15})},
+            {CompareOp::kGreater, testing::BuildArray({2, 3}).WithData<T>({-1, -1, -1, 13, 14, 15})},
+            {CompareOp::kGreaterEqual, testing::BuildArray({2, 3}).WithData<T>({-1, 11, -1, 13, 14, 15})},
+            {CompareOp::kLess, testing::BuildArray({2, 3}).WithData<T>({10, -1, 12, -2, -2, -2})},
+            {CompareOp::kLessEqual, testing::BuildArray({2, 3}).WithData<T>({10, 11, 12, -2, -2, -2})},
+    };
+
+    Run([&]() {
+        for (const Case& c : cases) {
+            testing::CheckForward(
+                    [op = c.op](const std::vector<Array>& xs) { return std::vector<Array>{WhereCompare(op, xs[0], xs[1], xs[2], xs[3])}; },
+                    {a, b, x, y},
+                    {c.expected});
+        }
+    });
+}
+
+TEST_THREAD_SAFE_P(IndexingTest, WhereCompareScalars) {
+    using T = float;
+
+    Array a = testing::BuildArray({2, 2}).WithData<int32_t>({0, 1, 2, 3});
+    Array x = testing::BuildArray({2, 2}).WithLinearData<T>(10);
+    Array y = testing::BuildArray({2, 2}).WithLinearData<T>(-10);
+    std::vector<Array> expected = {testing::BuildArray({2, 2}).WithData<T>({-10, -9, 12, 13}),
+                                   testing::BuildArray({2, 2}).WithData<T>({0.5f, 0.5f, 12, 13}),
+                                   testing::BuildArray({2, 2}).WithData<T>({-10, -9, 0.5f, 0.5f}),
+                                   testing::BuildArray({2, 2}).WithData<T>({-0.5f, -0.5f, 0.5f, 0.5f}),
+                                   testing::BuildArray({2, 2}).WithData<T>({0.5f, 0.5f, 0.5f, 0.5f})};
+
+    Run([&]() {
+        testing::CheckForward(
+                [](const std::vector<Array>& xs) {
+                    return std::vector<Array>{WhereCompare(CompareOp::kGreater, xs[0], 1, xs[1], xs[2]),
+                                              WhereCompare(CompareOp::kGreater, xs[0], 1, xs[1], Scalar{0.5f}),
+                                              WhereCompare(CompareOp::kGreater, xs[0], 1, Scalar{0.5f}, xs[2]),
+                                              WhereCompare(CompareOp::kGreater, xs[0], 1, Scalar{0.5f}, Scalar{-0.5f}),
+                                              WhereCompare(CompareOp::kLess, xs[0], xs[0] + 1, Scalar{0.5f}, Scalar{-0.5f})};
+                },
+                {a, x, y},
+                expected);
+    });
+}
+
+TEST_P(IndexingTest, WhereCompareNan) {
+    using T = double;
+
+    T nan = std::numeric_limits<T>::quiet_NaN();
+    Array a = testing::BuildArray({4}).WithData<T>({1, nan, -2, nan});
+
+    Array e = Where(IsNan(a), 0, a);
+    EXPECT_ARRAY_EQ(e, WhereCompare(CompareOp::kNotEqual, a, a, 0, a));
+}
+
+TEST_P(IndexingTest, WhereCompareInvalidDtypes) {
+    Array a = testing::BuildArray({2}).WithData<bool>({true, false});
+    Array b = testing::BuildArray({2}).WithData<float>({1, 2});
+
+    EXPECT_THROW(WhereCompare(CompareOp::kEqual, a, b, 0, 1), DtypeError);
+    EXPECT_THROW(WhereCompare(CompareOp::kEqual, b, true, 0, 1), DtypeError);
+}
+
+TEST_P(IndexingTest, WhereCompareBackward) {
+    using T = double;
+
+    Array a = testing::BuildArray({2, 3}).WithData<T>({1, 2, 3, 4, 5, 6});
+    Array b = testing::BuildArray({2, 3}).WithData<T>({2, 2.5, 1, 3, 7, 0});
+
+    CheckBackward(
+            [&a, &b](const std::vector<Array>& xs) -> std::vector<Array> {
+                return {WhereCompare(CompareOp::kLess, a, b, xs[0], xs[1]),
+                        WhereCompare(CompareOp::kGreater, a, 3, xs[0], Scalar{0.5}),
+                        WhereCompare(CompareOp::kGreater, a, 3, Scalar{0.5}, xs[1])};
+            },
+            {(*testing::BuildArray({2, 3}).WithLinearData<T>(-1, 0.5)).RequireGrad(),
+             (*testing::BuildArray({3}).WithLinearData<T>(2, -0.25)).RequireGrad()},
+            {testing::BuildArray({2, 3}).WithLinearData<T>(-0.1, 0.1),
+             testing::BuildArray({2, 3}).WithLinearData<T>(0.3, -0.1),
+             testing::BuildArray({2, 3}).WithLinearData<T>(0.2, 0.05)},
+            {Full({2, 3}, 1e-3, Dtype::kFloat64), Full({3}, 1e-3, Dtype::kFloat64)});
+}
+
+TEST_P(IndexingTest, WhereCompareDoubleBackward) {
+    using T = double;
+
+    Array a = testing::BuildArray({2, 3}).WithData<T>({1, 2, 3, 4, 5, 6});
+
+    CheckDoubleBackwardComputation(
+            [&a](const std::vector<Array>& xs) -> std::vector<Array> {
+                Array y = WhereCompare(CompareOp::kLessEqual, a, 3, xs[0], xs[1]);
+                return {y * y};  // to make it nonlinear
+            },
+            {(*testing::BuildArray({2, 3}).WithLinearData<T>(-1, 0.5)).RequireGrad(),
+             (*testing::BuildArray({2, 3}).WithLinearData<T>(2, -0.25)).RequireGrad()},
+            {(*testing::BuildArray({2, 3}).WithLinearData<T>(-0.1, 0.1)).RequireGrad()},
+            {testing::BuildArray({2, 3}).WithLinearData<T>(0.5, 0.1), testing::BuildArray({2, 3}).WithLinearData<T>(-0.5, 0.1)},
+            {Full({2, 3}, 1e-3, Dtype::kFloat64), Full({2, 3}, 1e-3, Dtype::kFloat64), Full({2, 3}, 1e-3, Dtype::kFloat64)});
+}
+
+INSTANTIATE_TEST_CASE_P(
+        ForEachBackend,
+        IndexingTest,
+        ::testing::Values(
+#ifdef CHAINERX_ENABLE_CUDA
+                std::string{"cuda"},
+#endif  // CHAINERX_ENABLE_CUDA
+                std::string{"native"}));
+
+}  // namespace
+}  // namespace chainerx
@@ -3,7 +3,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <iterator>
 #include <limits>
+#include <map>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -19,13 +22,16 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/linalg.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/indexing.h"
 #include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/reduction.h"
 #include "chainerx/routines/type_util.h"
 #include "chainerx/shape.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 
@@ -510,4 +516,526 @@ Array Eigvalsh(const Array& a, char uplo) {
     return w;
 }
 
+namespace {
+
+// Labels of the axes of einsum operands. Letters are labeled by their character codes and the axes covered by an ellipsis by negative
+// integers, the last one being -1.
+using EinsumLabels = std::vector<int>;
+
+using EinsumSizes = std::map<int, int64_t>;
+
+using EinsumPath = std::vector<std::pair<size_t, size_t>>;
+
+// Operands up to which the contraction path is searched exhaustively.
+constexpr size_t kMaxOptimalEinsumOperands = 4;
+
+bool HasEinsumLabel(const EinsumLabels& labels, int label) { return std::find(labels.begin(), labels.end(), label) != labels.end(); }
+
+bool IsEinsumLetter(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+// Parses a term of the subscripts into labels, where the ellipsis, if any, is labeled by 0.
+EinsumLabels ParseEinsumTerm(const std::string& term) {
+    EinsumLabels labels;
+    bool has_ellipsis = false;
+    for (size_t i = 0; i < term.size(); ++i) {
+        if (IsEinsumLetter(term[i])) {
+            labels.emplace_back(term[i]);
+        } else if (!has_ellipsis && term.compare(i, 3, "...") == 0) {
+            labels.emplace_back(0);
+            has_ellipsis = true;
+            i += 2;
+        } else {
+            throw ChainerxError{"Invalid einsum subscripts term: '", term, "'."};
+        }
+    }
+    return labels;
+}
+
+// Replaces the ellipsis label with the labels of the ellipsis_ndim axes it covers.
+EinsumLabels ExpandEinsumEllipsis(const EinsumLabels& labels, int64_t ellipsis_ndim) {
+    EinsumLabels expanded;
+    for (int label : labels) {
+        if (label != 0) {
+            expanded.emplace_back(label);
+            continue;
+        }
+        for (int64_t i = ellipsis_ndim; i > 0; --i) {
+            expanded.emplace_back(static_cast<int>(-i));
+        }
+    }
+    return expanded;
+}
+
+double GetEinsumSize(const EinsumLabels& labels, const EinsumSizes& sizes) {
+    double size = 1;
+    for (int label : labels) {
+        size *= static_cast<double>(sizes.at(label));
+    }
+    return size;
+}
+
+// Returns the labels of the result of contracting the operands i and j, which are their labels needed by the output or the other
+// operands.
+EinsumLabels GetEinsumContractionLabels(
+        const std::vector<EinsumLabels>& operand_labels, size_t i, size_t j, const EinsumLabels& output_labels) {
+    EinsumLabels needed = output_labels;
+    for (size_t k = 0; k < operand_labels.size(); ++k) {
+        if (k != i && k != j) {
+            std::copy(operand_labels[k].begin(), operand_labels[k].end(), std::back_inserter(needed));
+        }
+    }
+    EinsumLabels labels;
+    for (size_t k : {i, j}) {
+        for (int label : operand_labels[k]) {
+            if (HasEinsumLabel(needed, label) && !HasEinsumLabel(labels, label)) {
+                labels.emplace_back(label);
+            }
+        }
+    }
+    return labels;
+}
+
+// Returns the number of multiply-adds of contracting the operands i and j, which is the product of the sizes of all their labels.
+double GetEinsumContractionCost(const std::vector<EinsumLabels>& operand_labels, size_t i, size_t j, const EinsumSizes& sizes) {
+    EinsumLabels labels = operand_labels[i];
+    for (int label : operand_labels[j]) {
+        if (!HasEinsumLabel(labels, label)) {
+            labels.emplace_back(label);
+        }
+    }
+    return GetEinsumSize(labels, sizes);
+}
+
+// Replaces the operands i and j, where i < j, with their contraction appended to the end, as Einsum does.
+std::vector<EinsumLabels> ContractEinsumLabels(std::vector<EinsumLabels> operand_labels, size_t i, size_t j, EinsumLabels labels) {
+    operand_labels.erase(operand_labels.begin() + j);
+    operand_labels.erase(operand_labels.begin() + i);
+    operand_labels.emplace_back(std::move(labels));
+    return operand_labels;
+}
+
+void SearchOptimalEinsumPath(
+        const std::vector<EinsumLabels>& operand_labels,
+        const EinsumLabels& output_labels,
+        const EinsumSizes& sizes,
+        double cost,
+        EinsumPath& path,
+        double& best_cost,
+        EinsumPath& best_path) {
+    if (cost >= best_cost) {
+        return;
+    }
+    if (operand_labels.size() == 1) {
+        best_cost = cost;
+        best_path = path;
+        return;
+    }
+    for (size_t i = 0; i < operand_labels.size(); ++i) {
+        for (size_t j = i + 1; j < operand_labels.size(); ++j) {
+            EinsumLabels labels = GetEinsumContractionLabels(operand_labels, i, j, output_labels);
+            double step_cost = GetEinsumContractionCost(operand_labels, i, j, sizes);
+            path.emplace_back(i, j);
+            SearchOptimalEinsumPath(
+                    ContractEinsumLabels(operand_labels, i, j, std::move(labels)),
+                    output_labels,
+                    sizes,
+                    cost + step_cost,
+                    path,
+                    best_cost,
+                    best_path);
+            path.pop_back();
+        }
+    }
+}
+
+// Returns the pairs of operands to contract one after another.
+// The path with the fewest multiply-adds is searched for exhaustively if there are few operands. Otherwise, the pair whose contraction
+// shrinks the operands the most is contracted greedily, preferring the fewest multiply-adds among ties.
+EinsumPath GetEinsumPath(std::vector<EinsumLabels> operand_labels, const EinsumLabels& output_labels, const EinsumSizes& sizes) {
+    EinsumPath path;
+    if (operand_labels.size() <= kMaxOptimalEinsumOperands) {
+        EinsumPath best_path;
+        double best_cost = std::numeric_limits<double>::infinity();
+        SearchOptimalEinsumPath(operand_labels, output_labels, sizes, 0, path, best_cost, best_path);
+        return best_path;
+    }
+    while (operand_labels.size() > 1) {
+        std::pair<size_t, size_t> best_pair{};
+        std::pair<double, double> best_key{std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+        for (size_t i = 0; i < operand_labels.size(); ++i) {
+            for (size_t j = i + 1; j < operand_labels.size(); ++j) {
+                double growth = GetEinsumSize(GetEinsumContractionLabels(operand_labels, i, j, output_labels), sizes) -
+                                GetEinsumSize(operand_labels[i], sizes) - GetEinsumSize(operand_labels[j], sizes);
+                std::pair<double, double> key{growth, GetEinsumContractionCost(operand_labels, i, j, sizes)};
+                if (key < best_key) {
+                    best_key = key;
+                    best_pair = {i, j};
+                }
+            }
+        }
+        size_t i = best_pair.first;
+        size_t j = best_pair.second;
+        EinsumLabels labels = GetEinsumContractionLabels(operand_labels, i, j, output_labels);
+        operand_labels = ContractEinsumLabels(std::move(operand_labels), i, j, std::move(labels));
+        path.emplace_back(best_pair);
+    }
+    return path;
+}
+
+Array PutEinsumDiagonal(const Array& a, const Shape& shape, const Axes& out_axes);
+
+// Returns a view of the diagonal of a, where out_axes maps each axis of a to the axis of the output it is taken along.
+Array TakeEinsumDiagonal(const Array& a, const Axes& out_axes, int8_t out_ndim) {
+    CHAINERX_ASSERT(out_axes.ndim() == a.ndim());
+    Shape out_shape;
+    Strides out_strides;
+    out_shape.resize(out_ndim);
+    out_strides.resize(out_ndim);
+    for (int8_t i = 0; i < a.ndim(); ++i) {
+        out_shape[out_axes[i]] = a.shape()[i];
+        out_strides[out_axes[i]] += a.strides()[i];
+    }
+
+    Array out = internal::MakeArray(out_shape, out_strides, a.dtype(), a.device(), a.data(), a.offset());
+
+    BackwardBuilder bb{"einsum_diagonal", a, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([shape = a.shape(), out_axes](BackwardContext& bctx) {
+            bctx.input_grad() = PutEinsumDiagonal(*bctx.output_grad(), shape, out_axes);
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+// Returns an array of the given shape whose diagonal, as taken by TakeEinsumDiagonal, is a and whose other elements are zeros.
+Array PutEinsumDiagonal(const Array& a, const Shape& shape, const Axes& out_axes) {
+    Array out = Zeros(shape, a.dtype(), a.device());
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<CopyKernel>(a, TakeEinsumDiagonal(out, out_axes, a.ndim()));
+    }
+
+    BackwardBuilder bb{"einsum_put_diagonal", a, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([out_axes, ndim = a.ndim()](BackwardContext& bctx) {
+            bctx.input_grad() = TakeEinsumDiagonal(*bctx.output_grad(), out_axes, ndim);
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+// Returns the matrix products of the stacks of matrices a of shape (batch, m, k) and b of shape (batch, k, n).
+// The Dot kernel is called for each pair of matrices, which may be transposed views.
+Array BatchDot(const Array& a, const Array& b, Dtype out_dtype) {
+    CHAINERX_ASSERT(a.ndim() == 3);
+    CHAINERX_ASSERT(b.ndim() == 3);
+    CHAINERX_ASSERT(a.shape()[0] == b.shape()[0]);
+    CHAINERX_ASSERT(a.shape()[2] == b.shape()[1]);
+
+    int64_t batch_size = a.shape()[0];
+    Array out = Empty({batch_size, a.shape()[1], b.shape()[2]}, out_dtype, a.device());
+    {
+        NoBackpropModeScope scope{};
+        if (a.shape()[2] == 0) {
+            out.Fill(0);
+        } else {
+            for (int64_t i = 0; i < batch_size; ++i) {
+                a.device().backend().CallKernel<DotKernel>(a.At({i}), b.At({i}), out.At({i}));
+            }
+        }
+    }
+
+    {
+        BackwardBuilder bb{"batch_dot", {a, b}, out};
+        if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+            bt.Define([b_tok = bb.RetainInput(1), a_dtype = a.dtype()](BackwardContext& bctx) {
+                const Array& b = bctx.GetRetainedInput(b_tok);
+                bctx.input_grad() = BatchDot(*bctx.output_grad(), Swapaxes(b, 1, 2), a_dtype);
+            });
+        }
+        if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
+            bt.Define([a_tok = bb.RetainInput(0), b_dtype = b.dtype()](BackwardContext& bctx) {
+                const Array& a = bctx.GetRetainedInput(a_tok);
+                bctx.input_grad() = BatchDot(Swapaxes(a, 1, 2), *bctx.output_grad(), b_dtype);
+            });
+        }
+        bb.Finalize();
+    }
+
+    return out;
+}
+
+// Appends the axes of a with the given labels to axes and returns the product of their lengths.
+int64_t AppendEinsumAxes(const Array& a, const EinsumLabels& a_labels, const EinsumLabels& labels, Axes& axes) {
+    int64_t size = 1;
+    for (int label : labels) {
+        auto axis = static_cast<int8_t>(std::find(a_labels.begin(), a_labels.end(), label) - a_labels.begin());
+        axes.emplace_back(axis);
+        size *= a.shape()[axis];
+    }
+    return size;
+}
+
+// Returns a as a stack of matrices of shape (batch, rows, cols) whose axes enumerate the given labels in C-order.
+// If a is laid out as a stack of transposed matrices, it is returned as their transposed views, so that a is copied only if it is laid out
+// in neither way.
+Array AsEinsumMatrices(
+        const Array& a, const EinsumLabels& a_labels, const EinsumLabels& batch, const EinsumLabels& rows, const EinsumLabels& cols) {
+    Axes axes;
+    int64_t batch_size = AppendEinsumAxes(a, a_labels, batch, axes);
+    Axes transposed_axes = axes;
+    int64_t row_size = AppendEinsumAxes(a, a_labels, rows, axes);
+    int64_t col_size = AppendEinsumAxes(a, a_labels, cols, axes);
+    AppendEinsumAxes(a, a_labels, cols, transposed_axes);
+    AppendEinsumAxes(a, a_labels, rows, transposed_axes);
+
+    Array matrices = a.Transpose(axes);
+    if (!matrices.IsContiguous()) {
+        Array transposed = a.Transpose(transposed_axes);
+        if (transposed.IsContiguous()) {
+            return Swapaxes(transposed.Reshape({batch_size, col_size, row_size}), 1, 2);
+        }
+    }
+    return matrices.Reshape({batch_size, row_size, col_size});
+}
+
+// Contracts a and b into an array labeled by the labels in both of them which are needed, followed by the other labels of a and then of b.
+// The labels in both of them which are not needed are summed over.
+std::tuple<Array, EinsumLabels> ContractEinsumOperands(
+        const Array& a, const EinsumLabels& a_labels, const Array& b, const EinsumLabels& b_labels, const EinsumLabels& needed_labels) {
+    EinsumLabels batch;
+    EinsumLabels reduced;
+    EinsumLabels a_kept;
+    EinsumLabels b_kept;
+    for (int label : a_labels) {
+        if (!HasEinsumLabel(b_labels, label)) {
+            a_kept.emplace_back(label);
+        } else if (HasEinsumLabel(needed_labels, label)) {
+            batch.emplace_back(label);
+        } else {
+            reduced.emplace_back(label);
+        }
+    }
+    for (int label : b_labels) {
+        if (!HasEinsumLabel(a_labels, label)) {
+            b_kept.emplace_back(label);
+        }
+    }
+
+    Array out{};
+    if (reduced.empty()) {
+        // Without a label to sum over, the contraction is a broadcast product. The labels which are dropped from the output were already
+        // summed over when the operands were prepared, so that no Sum is needed here.
+        Axes a_axes;
+        Axes b_axes;
+        AppendEinsumAxes(a, a_labels, batch, a_axes);
+        AppendEinsumAxes(a, a_labels, a_kept, a_axes);
+        AppendEinsumAxes(b, b_labels, batch, b_axes);
+        AppendEinsumAxes(b, b_labels, b_kept, b_axes);
+        Array a_broadcast = a.Transpose(a_axes);
+        Array b_broadcast = b.Transpose(b_axes);
+        Shape a_shape = a_broadcast.shape();
+        Shape b_shape = b_broadcast.shape();
+        for (size_t i = 0; i < b_kept.size(); ++i) {
+            a_shape.emplace_back(int64_t{1});
+        }
+        for (size_t i = 0; i < a_kept.size(); ++i) {
+            b_shape.insert(b_shape.begin() + batch.size(), int64_t{1});
+        }
+        out = Multiply(a_broadcast.Reshape(a_shape), b_broadcast.Reshape(b_shape));
+    } else {
+        out = BatchDot(
+                AsEinsumMatrices(a, a_labels, batch, a_kept, reduced),
+                AsEinsumMatrices(b, b_labels, batch, reduced, b_kept),
+                ResultType(a, b));
+    }
+
+    Shape out_shape;
+    EinsumLabels out_labels;
+    for (const EinsumLabels* labels : {&batch, &a_kept}) {
+        for (int label : *labels) {
+            out_shape.emplace_back(a.shape()[std::find(a_labels.begin(), a_labels.end(), label) - a_labels.begin()]);
+            out_labels.emplace_back(label);
+        }
+    }
+    for (int label : b_kept) {
+        out_shape.emplace_back(b.shape()[std::find(b_labels.begin(), b_labels.end(), label) - b_labels.begin()]);
+        out_labels.emplace_back(label);
+    }
+    return std::make_tuple(out.Reshape(out_shape), std::move(out_labels));
+}
+
+}  // namespace
+
+Array Einsum(const std::string& subscripts, const std::vector<Array>& operands) {
+    if (operands.empty()) {
+        throw ChainerxError{"Einsum requires at least one operand."};
+    }
+
+    std::string compact;
+    std::copy_if(subscripts.begin(), subscripts.end(), std::back_inserter(compact), [](char c) { return c != ' '; });
+    size_t arrow = compact.find("->");
+    std::vector<std::string> terms;
+    {
+        std::string inputs = compact.substr(0, arrow);
+        size_t begin = 0;
+        for (size_t comma = inputs.find(','); comma != std::string::npos; comma = inputs.find(',', begin)) {
+            terms.emplace_back(inputs.substr(begin, comma - begin));
+            begin = comma + 1;
+        }
+        terms.emplace_back(inputs.substr(begin));
+    }
+    if (terms.size() != operands.size()) {
+        throw ChainerxError{
+                "Einsum subscripts '", subscripts, "' specify ", terms.size(), " operands but ", operands.size(), " are given."};
+    }
+
+    // Label the axes of the operands and the output.
+    std::vector<EinsumLabels> operand_labels;
+    int64_t ellipsis_ndim = 0;
+    for (size_t i = 0; i < operands.size(); ++i) {
+        EinsumLabels labels = ParseEinsumTerm(terms[i]);
+        bool has_ellipsis = HasEinsumLabel(labels, 0);
+        int64_t operand_ellipsis_ndim = int64_t{operands[i].ndim()} - static_cast<int64_t>(labels.size()) + (has_ellipsis ? 1 : 0);
+        if (operand_ellipsis_ndim < 0 || (!has_ellipsis && operand_ellipsis_ndim != 0)) {
+            throw DimensionError{"Einsum subscripts term '", terms[i], "' does not match the operand of shape ", operands[i].shape(), "."};
+        }
+        ellipsis_ndim = std::max(ellipsis_ndim, operand_ellipsis_ndim);
+        operand_labels.emplace_back(ExpandEinsumEllipsis(labels, operand_ellipsis_ndim));
+    }
+
+    EinsumLabels output_labels;
+    if (arrow != std::string::npos) {
+        output_labels = ExpandEinsumEllipsis(ParseEinsumTerm(compact.substr(arrow + 2)), ellipsis_ndim);
+        for (size_t i = 0; i < output_labels.size(); ++i) {
+            int label = output_labels[i];
+            if (HasEinsumLabel(EinsumLabels{output_labels.begin() + i + 1, output_labels.end()}, label)) {
+                throw ChainerxError{"Einsum subscripts '", subscripts, "' repeat a label in the output."};
+            }
+            if (std::none_of(operand_labels.begin(), operand_labels.end(), [label](const EinsumLabels& labels) {
+                    return HasEinsumLabel(labels, label);
+                })) {
+                throw ChainerxError{"Einsum subscripts '", subscripts, "' have an output label which is not in the operands."};
+            }
+        }
+    } else {
+        output_labels = ExpandEinsumEllipsis({0}, ellipsis_ndim);
+        std::map<int, int> counts;
+        for (const EinsumLabels& labels : operand_labels) {
+            for (int label : labels) {
+                ++counts[label];
+            }
+        }
+        for (const auto& count : counts) {
+            if (count.first > 0 && count.second == 1) {
+                output_labels.emplace_back(count.first);
+            }
+        }
+    }
+
+    // Determine the size of each label, broadcasting axes of length 1.
+    EinsumSizes sizes;
+    for (size_t i = 0; i < operands.size(); ++i) {
+        for (size_t axis = 0; axis < operand_labels[i].size(); ++axis) {
+            int64_t dim = operands[i].shape()[axis];
+            auto it = sizes.find(operand_labels[i][axis]);
+            if (it == sizes.end() || it->second == 1) {
+                sizes[operand_labels[i][axis]] = dim;
+            } else if (dim != 1 && dim != it->second) {
+                throw DimensionError{"Einsum operand of shape ", operands[i].shape(), " does not match the subscripts '", subscripts, "'."};
+            }
+        }
+    }
+
+    // Prepare the operands so that each label appears once in each of them and, except for the output labels, in at least two of them.
+    std::vector<Array> arrays;
+    for (size_t i = 0; i < operands.size(); ++i) {
+        Array a = operands[i];
+        EinsumLabels& labels = operand_labels[i];
+
+        Axes broadcast_axes;
+        EinsumLabels unbroadcast_labels;
+        for (size_t axis = 0; axis < labels.size(); ++axis) {
+            if (a.shape()[axis] == 1 && sizes[labels[axis]] != 1) {
+                broadcast_axes.emplace_back(static_cast<int8_t>(axis));
+            } else {
+                unbroadcast_labels.emplace_back(labels[axis]);
+            }
+        }
+        if (!broadcast_axes.empty()) {
+            a = Squeeze(a, broadcast_axes);
+        }
+        labels = std::move(unbroadcast_labels);
+
+        EinsumLabels unique_labels;
+        Axes diagonal_axes;
+        for (int label : labels) {
+            auto it = std::find(unique_labels.begin(), unique_labels.end(), label);
+            diagonal_axes.emplace_back(static_cast<int8_t>(it - unique_labels.begin()));
+            if (it == unique_labels.end()) {
+                unique_labels.emplace_back(label);
+            }
+        }
+        if (unique_labels.size() != labels.size()) {
+            a = TakeEinsumDiagonal(a, diagonal_axes, static_cast<int8_t>(unique_labels.size()));
+        }
+        labels = std::move(unique_labels);
+
+        arrays.emplace_back(std::move(a));
+    }
+    for (size_t i = 0; i < arrays.size(); ++i) {
+        Array& a = arrays[i];
+        EinsumLabels& labels = operand_labels[i];
+        Axes sum_axes;
+        EinsumLabels kept_labels;
+        for (size_t axis = 0; axis < labels.size(); ++axis) {
+            int label = labels[axis];
+            bool is_needed = HasEinsumLabel(output_labels, label);
+            for (size_t j = 0; j < operands.size() && !is_needed; ++j) {
+                is_needed = j != i && HasEinsumLabel(operand_labels[j], label);
+            }
+            if (is_needed) {
+                kept_labels.emplace_back(label);
+            } else {
+                sum_axes.emplace_back(static_cast<int8_t>(axis));
+            }
+        }
+        if (!sum_axes.empty()) {
+            a = Sum(a, sum_axes);
+        }
+        labels = std::move(kept_labels);
+    }
+
+    // Contract the operands pairwise.
+    for (const std::pair<size_t, size_t>& pair : GetEinsumPath(operand_labels, output_labels, sizes)) {
+        size_t i = pair.first;
+        size_t j = pair.second;
+        Array out{};
+        EinsumLabels out_labels;
+        std::tie(out, out_labels) = ContractEinsumOperands(
+                arrays[i],
+                operand_labels[i],
+                arrays[j],
+                operand_labels[j],
+                GetEinsumContractionLabels(operand_labels, i, j, output_labels));
+        for (size_t k : {j, i}) {
+            arrays.erase(arrays.begin() + k);
+            operand_labels.erase(operand_labels.begin() + k);
+        }
+        arrays.emplace_back(std::move(out));
+        operand_labels.emplace_back(std::move(out_labels));
+    }
+    CHAINERX_ASSERT(arrays.size() == 1);
+
+    Axes axes;
+    AppendEinsumAxes(arrays[0], operand_labels[0], output_labels, axes);
+    Array out = arrays[0].Transpose(axes);
+    Dtype out_dtype = ResultType(operands);
+    return out.dtype() == out_dtype ? out : out.AsType(out_dtype);
+}
+
 }  // namespace chainerx
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include <absl/types/optional.h>
 
@@ -11,6 +13,15 @@ namespace chainerx {
 
 Array Dot(const Array& a, const Array& b, absl::optional<Dtype> out_dtype = absl::nullopt);
 
+// Evaluates the Einstein summation convention on the operands, as numpy.einsum does.
+// The subscripts consist of a comma-separated term of letters for each operand, which may contain an ellipsis, optionally followed by "->"
+// and a term for the output. Without the output term, the output is labeled by the ellipsis and then the letters that appear only once, in
+// alphabetical order.
+// Diagonals of repeated labels are taken as views and labels that appear in a single operand are summed over first. The remaining operands
+// are contracted pairwise, in the order minimizing the number of operations if there are few operands and greedily otherwise, as batched
+// matrix products.
+Array Einsum(const std::string& subscripts, const std::vector<Array>& operands);
+
 Array Solve(const Array& a, const Array& b);
 
 Array Inverse(const Array& a);
@@ -1,6 +1,7 @@
 #include "chainerx/routines/loss.h"
 
 #include "chainerx/array.h"
+#include "chainerx/dtype.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/explog.h"
@@ -22,10 +23,7 @@ Array GaussianKLDivergence(const Array& mean, const Array& ln_var) { return (Squ
 Array HuberLoss(const Array& x1, const Array& x2, Scalar delta) {
     Array a = x1 - x2;
     Array abs_a = Absolute(a);
-    Array delta_array = chainerx::FullLike(a, delta, a.device());
-
-    // TODO(kshitij12345) : use Array < Scalar when implemented.
-    return Where(abs_a < delta_array, 0.5 * Square(a), delta * (abs_a - Scalar{0.5} * delta));
+    return WhereCompare(CompareOp::kLess, abs_a, delta, 0.5 * Square(a), delta * (abs_a - Scalar{0.5} * delta));
 }
 
 Array SigmoidCrossEntropy(const Array& x1, const Array& x2) {
@@ -60,8 +58,12 @@ Array Hinge(const Array& x, const Array& t, double norm) {
         throw DimensionError{"x.shape[0] must be equal to t.shape[0]"};
     }
 
+    // The labels are compared in the dtype of x so that the comparison is fused into the selection. They are exact in it unless there are
+    // more classes than float16 can count, in which case the comparison falls back to float32 and a materialized mask.
     int64_t num = x.shape()[1];
-    Array one_minus_diff = Where(ExpandDims(t, 1) == Arange(num), 1 - x, 1 + x);
+    Dtype compare_dtype = x.dtype() == Dtype::kFloat16 && num > 2048 ? Dtype::kFloat32 : x.dtype();
+    Array one_minus_diff = WhereCompare(
+            CompareOp::kEqual, ExpandDims(t, 1).AsType(compare_dtype, false), Arange(num, compare_dtype, x.device()), 1 - x, 1 + x);
     Array bottom_diff = Maximum(0, one_minus_diff);
 
     return Power(bottom_diff, Scalar{norm});
@@ -14,17 +14,20 @@
 #include <absl/types/optional.h>
 
 #include "chainerx/array.h"
+#include "chainerx/array_index.h"
 #include "chainerx/axes.h"
 #include "chainerx/backend.h"
 #include "chainerx/backprop_mode.h"
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
+#include "chainerx/data_version.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/indexing.h"
+#include "chainerx/kernels/manipulation.h"
 #include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/creation.h"
@@ -32,6 +35,7 @@
 #include "chainerx/routines/routines_util.h"
 #include "chainerx/routines/type_util.h"
 #include "chainerx/shape.h"
+#include "chainerx/slice.h"
 #include "chainerx/strides.h"
 
 namespace chainerx {
@@ -510,6 +514,79 @@ Array Stack(const std::vector<Array>& arrays, int8_t axis) {
     return ConcatenateImpl(reshaped_arrays, axis);
 }
 
+Array Pack(const std::vector<Array>& arrays, const absl::optional<Dtype>& dtype) {
+    if (arrays.empty()) {
+        throw DimensionError{"Need at least one array to pack"};
+    }
+
+    Dtype out_dtype = dtype.has_value() ? *dtype : ResultType(arrays);
+    Device& device = arrays.front().device();
+    int64_t total_size = 0;
+    for (const Array& array : arrays) {
+        total_size += array.GetTotalSize();
+    }
+
+    Array out = Empty(Shape{total_size}, out_dtype, device);
+    {
+        NoBackpropModeScope scope{};
+        device.backend().CallKernel<PackKernel>(arrays, out);
+    }
+
+    {
+        std::vector<ConstArrayRef> array_refs{};
+        array_refs.reserve(arrays.size());
+        std::vector<Shape> in_shapes{};
+        in_shapes.reserve(arrays.size());
+        std::vector<Dtype> in_dtypes{};
+        in_dtypes.reserve(arrays.size());
+        for (const Array& array : arrays) {
+            array_refs.emplace_back(ConstArrayRef{array});
+            in_shapes.emplace_back(array.shape());
+            in_dtypes.emplace_back(array.dtype());
+        }
+
+        BackwardBuilder bb{"pack", array_refs, out};
+        if (BackwardBuilder::Target bt = bb.CreateTarget()) {
+            bt.Define([in_shapes = std::move(in_shapes), in_dtypes = std::move(in_dtypes)](BackwardContext& bctx) {
+                const Array& gy = *bctx.output_grad();
+                int64_t offset = 0;
+                for (size_t i = 0; i < in_shapes.size(); ++i) {
+                    int64_t size = in_shapes[i].GetTotalSize();
+                    Array gx = gy.At({Slice{offset, offset + size}}).Reshape(in_shapes[i]);
+                    bctx.input_grad(i) = gx.dtype() == in_dtypes[i] ? std::move(gx) : gx.AsType(in_dtypes[i]);
+                    offset += size;
+                }
+            });
+        }
+        bb.Finalize();
+    }
+
+    return out;
+}
+
+void Unpack(const Array& packed, const std::vector<Array>& arrays, Scalar scale) {
+    if (packed.ndim() != 1) {
+        throw DimensionError{"Packed array must be 1-dimensional, but got ", packed.ndim(), " dimensions."};
+    }
+    int64_t total_size = 0;
+    for (const Array& array : arrays) {
+        internal::CheckNoUnsafeInplace(array);
+        total_size += array.GetTotalSize();
+    }
+    if (total_size != packed.GetTotalSize()) {
+        throw DimensionError{
+                "Packed array of size ", packed.GetTotalSize(), " cannot be unpacked into arrays of total size ", total_size, "."};
+    }
+
+    {
+        NoBackpropModeScope scope{};
+        packed.device().backend().CallKernel<UnpackKernel>(packed.IsContiguous() ? packed : AsContiguous(packed), scale, arrays);
+    }
+    for (const Array& array : arrays) {
+        internal::BumpDataVersion(array);
+    }
+}
+
 namespace {
 
 // Defines the backward pass for Split, for both by-sections and by-indices.
@@ -526,14 +603,38 @@ void DefineSplitBackward(const Array& ary, const std::vector<Array>& out, int8_t
 
     BackwardBuilder bb{"split", ary, out_refs};
     if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-        bt.Define([axis_norm, shapes = std::move(shapes), dtype = ary.dtype(), &device = ary.device()](BackwardContext& bctx) {
-            std::vector<Array> output_grads;
-            output_grads.reserve(bctx.output_count());
+        bt.Define([axis_norm, shapes = std::move(shapes), in_shape = ary.shape(), dtype = ary.dtype(), &device = ary.device()](
+                          BackwardContext& bctx) {
+            if (bctx.next_required()) {
+                std::vector<Array> output_grads;
+                output_grads.reserve(bctx.output_count());
+                for (size_t i = 0; i < bctx.output_count(); ++i) {
+                    const absl::optional<Array>& gy = bctx.output_grad(i);
+                    output_grads.emplace_back(gy.has_value() ? *gy : Zeros(shapes[i], dtype, device));
+                }
+                bctx.input_grad() = ConcatenateImpl(output_grads, axis_norm);
+                return;
+            }
+
+            // The outputs tile the input along the axis without overlaps.
+            // Each region of the gradient is written exactly once, either by copying the output gradient or by filling zeros if the output
+            // has no gradient.
+            Array gx = Empty(in_shape, dtype, device);
+            std::vector<ArrayIndex> indices(axis_norm + 1, Slice{});
+            int64_t start = 0;
             for (size_t i = 0; i < bctx.output_count(); ++i) {
+                int64_t stop = start + shapes[i][axis_norm];
+                indices.back() = Slice{start, stop};
+                Array gx_region = gx.At(indices);
                 const absl::optional<Array>& gy = bctx.output_grad(i);
-                output_grads.emplace_back(gy.has_value() ? *gy : Zeros(shapes[i], dtype, device));
+                if (gy.has_value()) {
+                    device.backend().CallKernel<CopyKernel>(*gy, gx_region);
+                } else {
+                    gx_region.Fill(0);
+                }
+                start = stop;
             }
-            bctx.input_grad() = ConcatenateImpl(output_grads, axis_norm);
+            bctx.input_grad() = std::move(gx);
         });
     }
     bb.Finalize();
@@ -1006,7 +1107,7 @@ Array Moveaxis(const Array& a, const Axes& source, const Axes& destination) {
 }
 
 void CopyTo(const Array& dst, const Array& src, CastingMode casting, const Array& where) {
-    internal::CheckNoUnsafeInplace(dst, {dst, src, where});
+    internal::CheckNoUnsafeInplace(dst);
 
     switch (casting) {
         case CastingMode::kNo:
@@ -1025,6 +1126,7 @@ void CopyTo(const Array& dst, const Array& src, CastingMode casting, const Array
         NoBackpropModeScope scope;
         dst.device().backend().CallKernel<WhereKernel>(where_b, src_b, dst, dst);
     }
+    internal::BumpDataVersion(dst);
 }
 
 }  // namespace chainerx
@@ -7,6 +7,8 @@
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
+#include "chainerx/dtype.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -44,6 +46,15 @@ Array Concatenate(const std::vector<Array>& arrays, absl::optional<int8_t> axis)
 // Returns a joined array along a new axis.
 Array Stack(const std::vector<Array>& arrays, int8_t axis = 0);
 
+// Returns a contiguous 1-dimensional array holding the elements of the arrays one after another in row-major order.
+// Elements are cast to dtype, which defaults to the result type of the arrays. All the arrays are copied in a single kernel call, which
+// makes it suitable for preparing communication buffers from many small arrays.
+Array Pack(const std::vector<Array>& arrays, const absl::optional<Dtype>& dtype = absl::nullopt);
+
+// Copies the elements of a packed array into the arrays in place, multiplying them by scale and casting them to the dtypes of the arrays.
+// This is the inverse of Pack, which the array must have been created by with arrays of the same shapes.
+void Unpack(const Array& packed, const std::vector<Array>& arrays, Scalar scale = 1);
+
 // Returns a set of arrays resulting from splitting the given array into sections along the specified axis.
 // If the dimension is not equally divisible, DimensionError is throws.
 std::vector<Array> Split(const Array& ary, int64_t sections, int8_t axis = 0);
@@ -1,18 +1,22 @@
 #include "chainerx/routines/reduction.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <numeric>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include <absl/types/optional.h>
 
 #include "chainerx/array.h"
+#include "chainerx/array_index.h"
 #include "chainerx/axes.h"
 #include "chainerx/backprop_mode.h"
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
+#include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
@@ -24,12 +28,154 @@
 #include "chainerx/routines/indexing.h"
 #include "chainerx/routines/logic.h"
 #include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/misc.h"
 #include "chainerx/routines/routines_util.h"
 #include "chainerx/routines/statistics.h"
 #include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
+#include "chainerx/slice.h"
 
 namespace chainerx {
+namespace {
+
+// Returns the segment ids of the sub-arrays of data along the first axis as a contiguous int64 array.
+Array AsSegmentIds(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted) {
+    CheckEqual(data.device(), segment_ids.device());
+    if (data.ndim() == 0) {
+        throw DimensionError{"Segment reductions require an array of at least 1 dimension."};
+    }
+    if (segment_ids.ndim() != 1 || segment_ids.shape()[0] != data.shape()[0]) {
+        throw DimensionError{"Segment ids of shape ", segment_ids.shape(), " do not match the first axis of shape ", data.shape(), "."};
+    }
+    if (GetKind(segment_ids.dtype()) != DtypeKind::kInt && GetKind(segment_ids.dtype()) != DtypeKind::kUInt) {
+        throw DtypeError{"Segment ids must be of an integral dtype, but got ", segment_ids.dtype(), "."};
+    }
+    if (num_segments < 0) {
+        throw DimensionError{"Number of segments must be non-negative, but got ", num_segments, "."};
+    }
+    if (data.dtype() == Dtype::kBool) {
+        throw DtypeError{"Segment reductions do not support dtype ", data.dtype(), "."};
+    }
+
+    Array ids = AsContiguous(segment_ids, Dtype::kInt64);
+    int64_t n = ids.GetTotalSize();
+    if (n > 0) {
+        NoBackpropModeScope scope{};
+        auto min_id = static_cast<int64_t>(AsScalar(AMin(ids)));
+        auto max_id = static_cast<int64_t>(AsScalar(AMax(ids)));
+        if (min_id < 0 || num_segments <= max_id) {
+            throw IndexError{"Segment ids range from ", min_id, " to ", max_id, ", out of bounds of ", num_segments, " segments."};
+        }
+        if (sorted && n > 1 && static_cast<int64_t>(AsScalar(AMin(ids.At({Slice{1, n}}) - ids.At({Slice{0, n - 1}})))) < 0) {
+            throw ChainerxError{"Segment ids must be non-decreasing if they are sorted."};
+        }
+    }
+    return ids;
+}
+
+// Returns the shape of the reduction of data into num_segments segments.
+Shape GetSegmentReducedShape(const Shape& shape, int64_t num_segments) {
+    Shape out_shape = shape;
+    out_shape[0] = num_segments;
+    return out_shape;
+}
+
+// Reshapes the number of sub-arrays reduced into each segment so that it broadcasts to the segments.
+Array ReshapeSegmentCounts(const Array& counts, int8_t ndim) {
+    Shape shape{counts.shape()[0]};
+    for (int8_t i = 1; i < ndim; ++i) {
+        shape.emplace_back(1);
+    }
+    return counts.Reshape(shape);
+}
+
+// Reduces data into the segments given by ids, which are validated by AsSegmentIds, and returns the result and the number of sub-arrays
+// reduced into each segment.
+// If initial is given, the segments are initialized with it instead of being overwritten.
+std::pair<Array, Array> ReduceSegments(
+        const Array& data,
+        const Array& ids,
+        const Shape& out_shape,
+        SegmentReduction reduction,
+        bool sorted,
+        const absl::optional<Array>& initial) {
+    CHAINERX_ASSERT(reduction != SegmentReduction::kMean);
+    int64_t inner_size = out_shape.GetTotalSize() / std::max(int64_t{1}, out_shape[0]);
+    Device& device = data.device();
+    Array out{};
+    Array counts = Zeros(Shape{out_shape[0]}, Dtype::kInt64, device);
+    {
+        NoBackpropModeScope scope{};
+        out = initial.has_value() ? initial->Copy() : Zeros(out_shape, data.dtype(), device);
+        if (out_shape[0] > 0 && inner_size > 0) {
+            device.backend().CallKernel<SegmentReduceKernel>(
+                    data.Reshape({data.shape()[0], inner_size}),
+                    ids,
+                    reduction,
+                    sorted,
+                    initial.has_value(),
+                    out.Reshape({out_shape[0], inner_size}),
+                    counts);
+        }
+    }
+
+    {
+        std::vector<ConstArrayRef> inputs{data};
+        if (initial.has_value()) {
+            inputs.emplace_back(*initial);
+        }
+        BackwardBuilder bb{"segment_reduce", std::move(inputs), out};
+        if (reduction == SegmentReduction::kSum) {
+            if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+                bt.Define([ids](BackwardContext& bctx) { bctx.input_grad() = Take(*bctx.output_grad(), ids, 0); });
+            }
+            if (initial.has_value()) {
+                if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
+                    bt.Define([](BackwardContext& bctx) { bctx.input_grad() = *bctx.output_grad(); });
+                }
+            }
+        } else {
+            // data and out are used only for restoring the masks of the maxima or minima. We don't need graph nodes.
+            if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+                bt.Define([ids, data = data.AsGradStopped(), out = out.AsGradStopped()](BackwardContext& bctx) {
+                    const Array& gout = *bctx.output_grad();
+                    Array cond = (data == Take(out, ids, 0)).AsType(gout.dtype(), false);
+                    bctx.input_grad() = Take(gout, ids, 0) * cond;
+                });
+            }
+            if (initial.has_value()) {
+                if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
+                    bt.Define([initial = initial->AsGradStopped(), out = out.AsGradStopped()](BackwardContext& bctx) {
+                        const Array& gout = *bctx.output_grad();
+                        bctx.input_grad() = gout * (initial == out).AsType(gout.dtype(), false);
+                    });
+                }
+            }
+        }
+        bb.Finalize();
+    }
+
+    return {out, counts};
+}
+
+Array SegmentReduce(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted, SegmentReduction reduction) {
+    Array ids = AsSegmentIds(data, segment_ids, num_segments, sorted);
+    Shape out_shape = GetSegmentReducedShape(data.shape(), num_segments);
+    if (reduction != SegmentReduction::kMean) {
+        return ReduceSegments(data, ids, out_shape, reduction, sorted, absl::nullopt).first;
+    }
+
+    // Integral data are summed in int64, so that the sums of narrow dtypes do not overflow before they are divided.
+    bool is_integral = GetKind(data.dtype()) == DtypeKind::kInt || GetKind(data.dtype()) == DtypeKind::kUInt;
+    Array sum{};
+    Array counts{};
+    std::tie(sum, counts) = ReduceSegments(
+            is_integral ? data.AsType(Dtype::kInt64, false) : data, ids, out_shape, SegmentReduction::kSum, sorted, absl::nullopt);
+    return TrueDivide(sum, ReshapeSegmentCounts(Maximum(counts, Scalar{1}), sum.ndim()));
+}
+
+}  // namespace
 
 Array Sum(const Array& a, const OptionalAxes& axis, bool keepdims) {
     Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
@@ -148,7 +294,7 @@ Array Cumsum(const Array& a, absl::optional<int8_t> axis) {
 
 Array Nansum(const Array& a, const OptionalAxes& axis, bool keepdims) {
     Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
-    Array a_masked = Where(IsNan(a), 0, a);
+    Array a_masked = WhereCompare(CompareOp::kNotEqual, a, a, 0, a);
     // Decide the output dtype for integral input dtype.
     Dtype out_dtype{};
     switch (GetKind(a_masked.dtype())) {
@@ -186,11 +332,44 @@ Array Nansum(const Array& a, const OptionalAxes& axis, bool keepdims) {
             } else {
                 input_grad = gout.BroadcastTo(in_shape);
             }
-            input_grad = Where(IsNan(input), 0, input_grad);
+            input_grad = WhereCompare(CompareOp::kNotEqual, input, input, 0, input_grad);
         });
     }
     bb.Finalize();
     return out;
 }
 
+Array SegmentSum(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted) {
+    return SegmentReduce(data, segment_ids, num_segments, sorted, SegmentReduction::kSum);
+}
+
+Array SegmentMean(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted) {
+    return SegmentReduce(data, segment_ids, num_segments, sorted, SegmentReduction::kMean);
+}
+
+Array SegmentMax(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted) {
+    return SegmentReduce(data, segment_ids, num_segments, sorted, SegmentReduction::kMax);
+}
+
+Array SegmentMin(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted) {
+    return SegmentReduce(data, segment_ids, num_segments, sorted, SegmentReduction::kMin);
+}
+
+Array ScatterReduce(const Array& a, const Array& indices, const Array& b, SegmentReduction reduction) {
+    CheckEqual(a.device(), b.device());
+    if (a.ndim() == 0 || b.ndim() != a.ndim() || !std::equal(a.shape().begin() + 1, a.shape().end(), b.shape().begin() + 1)) {
+        throw DimensionError{"Cannot scatter an array of shape ", b.shape(), " into an array of shape ", a.shape(), "."};
+    }
+    Array b_cast = b.AsType(a.dtype(), false);
+    Array ids = AsSegmentIds(b_cast, indices, a.shape()[0], false);
+    if (reduction != SegmentReduction::kMean) {
+        return ReduceSegments(b_cast, ids, a.shape(), reduction, false, a).first;
+    }
+
+    Array sum{};
+    Array counts{};
+    std::tie(sum, counts) = ReduceSegments(b_cast, ids, a.shape(), SegmentReduction::kSum, false, a);
+    return TrueDivide(sum, ReshapeSegmentCounts(counts + Scalar{1}, sum.ndim()));
+}
+
 }  // namespace chainerx
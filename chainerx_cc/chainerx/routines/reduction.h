@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include <absl/types/optional.h>
 
 #include "chainerx/array.h"
@@ -23,4 +25,30 @@ Array Cumsum(const Array& a, absl::optional<int8_t> axis = absl::nullopt);
 
 Array Nansum(const Array& a, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
 
+enum class SegmentReduction {
+    kSum,
+    kMean,
+    kMax,
+    kMin,
+};
+
+// Reduces the sub-arrays of data along the first axis into num_segments segments, the i-th sub-array into the segment_ids[i]-th one.
+// The output has num_segments sub-arrays along the first axis, and those of empty segments are zeros.
+// The segment ids must be within [0, num_segments). If sorted is true, they must be non-decreasing, so that the segments are reduced in
+// parallel without per-thread buffers.
+Array SegmentSum(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted = false);
+
+// The mean of integral data is computed in the default floating point dtype.
+Array SegmentMean(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted = false);
+
+// NaNs are propagated, and the gradient is propagated to all the elements equal to the maxima.
+Array SegmentMax(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted = false);
+
+Array SegmentMin(const Array& data, const Array& segment_ids, int64_t num_segments, bool sorted = false);
+
+// Returns a copy of a whose sub-arrays along the first axis are reduced with those of b, the i-th sub-array of b with the indices[i]-th
+// one of a.
+// The mean is taken over the sub-array of a and all the sub-arrays of b reduced with it. b is cast to the dtype of a.
+Array ScatterReduce(const Array& a, const Array& indices, const Array& b, SegmentReduction reduction);
+
 }  // namespace chainerx
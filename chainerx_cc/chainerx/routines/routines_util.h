@@ -1,10 +1,11 @@
 #pragma once
 
-#include <functional>
-#include <initializer_list>
+#include <array>
+#include <cstddef>
 #include <memory>
 
 #include "chainerx/array.h"
+#include "chainerx/data_version.h"
 #include "chainerx/error.h"
 #include "chainerx/routines/creation.h"
 
@@ -12,30 +13,15 @@ namespace chainerx {
 namespace internal {
 
 // Checks for unsafe inplace operation on arrays.
-// This functions throws ChainerxError if at least one of the following conditions is met.
-// * The output array has any array nodes. Rewriting its data may affect other arrays in the graph.
-// * At least one input array is identical to the output array, and the input array is to be backpropped in the current no/force backprop
-// mode. In this case, if the backward computation of the operation retains and uses the input array, the retained input will not reflect
-// the original nodes. There will be no problem if the input array is not to be retained, but it's difficult to distinguish such operations.
-// Currently we take the safer strategy to forbid this case in any operations.
-// TODO(niboshi): Flag the data of retained input/output arrays and detect in-place operation using the flag. If that will be implemented,
-// the check in this function will not be needed.
-inline void CheckNoUnsafeInplace(const Array& out, std::initializer_list<std::reference_wrapper<const Array>> inputs) {
+// This functions throws ChainerxError if the output array has any array nodes. Rewriting its data may affect other arrays in the graph.
+// Input arrays identical to the output array are allowed even if other inputs are to be backpropped. If the backward computation of the
+// operation retains and uses such an input, the modification is detected by the data version of the buffer when the retained input is
+// retrieved.
+inline void CheckNoUnsafeInplace(const Array& out) {
     const std::shared_ptr<ArrayBody>& out_body = internal::GetArrayBody(out);
     if (!out_body->nodes().empty()) {
         throw ChainerxError{"In-place assignment to output array requiring grad is not allowed."};
     }
-
-    bool any_input_grad_required = false;
-    bool any_inplace = false;
-    for (const Array& input : inputs) {
-        any_input_grad_required |= input.IsBackpropRequired(AnyGraph{});
-        any_inplace |= out_body == internal::GetArrayBody(input);
-    }
-
-    if (any_input_grad_required && any_inplace) {
-        throw ChainerxError{"In-place assignment that involves input arrays requiring grad is not allowed."};
-    }
 }
 
 // Makes view of output arrays of ForwardBackward implementations to avoid cyclic references since ForwardBackward may internally capture
@@ -74,12 +60,13 @@ Array BroadcastBinary(Impl&& impl, const Array& x1, const Array& x2, Dtype dtype
 // Called from IAdd, ISubtract, IMultiply, IDivide, etc. to handle broadcasting.
 template <typename Impl>
 void BroadcastBinaryInplace(Impl&& impl, const Array& x1, const Array& x2) {
-    internal::CheckNoUnsafeInplace(x1, {x1, x2});
+    internal::CheckNoUnsafeInplace(x1);
     if (x1.shape() == x2.shape()) {
         impl(x1, x2, x1);
     } else {
         impl(x1, x2.BroadcastTo(x1.shape()), x1);
     }
+    BumpDataVersion(x1);
 }
 
 template <typename Impl>
@@ -98,8 +85,9 @@ Array Binary(Impl&& impl, Scalar x1, const Array& x2, Dtype dtype) {
 
 template <typename Impl>
 void BinaryInplace(Impl&& impl, const Array& x1, Scalar x2) {
-    internal::CheckNoUnsafeInplace(x1, {x1});
+    internal::CheckNoUnsafeInplace(x1);
     impl(x1, x2, x1);
+    BumpDataVersion(x1);
 }
 
 }  // namespace internal
@@ -1,22 +1,68 @@
 #include "chainerx/routines/sorting.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <numeric>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
 #include "chainerx/backprop_mode.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
+#include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/kernels/sorting.h"
+#include "chainerx/macro.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/indexing.h"
 #include "chainerx/routines/logic.h"
 #include "chainerx/routines/reduction.h"
+#include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
+namespace {
+
+template <typename Kernel>
+std::tuple<Array, Array> ExtremumAndIndex(const Array& a, const OptionalAxes& axis, const char* name) {
+    Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
+    for (int8_t i : sorted_axis) {
+        if (a.shape()[i] == 0) {
+            throw DimensionError{"Cannot compute ", name, " for an empty array."};
+        }
+    }
+
+    Shape out_shape = internal::ReduceShape(a.shape(), sorted_axis, false);
+    Array out_value = Empty(out_shape, a.dtype(), a.device());
+    Array out_index = Empty(out_shape, Dtype::kInt64, a.device());
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<Kernel>(a, sorted_axis, out_value, out_index);
+    }
+
+    BackwardBuilder bb{name, a, out_value};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        // a and out_value are used only for restoring the mask. We don't need graph nodes.
+        bt.Define([sorted_axis, a = a.AsGradStopped(), out_value = out_value.AsGradStopped()](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            CHAINERX_ASSERT(std::is_sorted(sorted_axis.begin(), sorted_axis.end()));
+
+            Shape shape = internal::ReduceShape(a.shape(), sorted_axis, true);
+            bctx.input_grad() =
+                    WhereCompare(CompareOp::kEqual, a, out_value.Reshape(shape), gout.Reshape(shape), Scalar{0, GetKind(gout.dtype())});
+        });
+    }
+    bb.Finalize();
+
+    return std::make_tuple(std::move(out_value), std::move(out_index));
+}
+
+}  // namespace
 
 Array ArgMax(const Array& a, const OptionalAxes& axis) {
     Axes sorted_axis{};
@@ -84,6 +130,14 @@ Array ArgMin(const Array& a, const OptionalAxes& axis) {
     return out;
 }
 
+std::tuple<Array, Array> MaxAndArgMax(const Array& a, const OptionalAxes& axis) {
+    return ExtremumAndIndex<MaxAndArgMaxKernel>(a, axis, "max_and_argmax");
+}
+
+std::tuple<Array, Array> MinAndArgMin(const Array& a, const OptionalAxes& axis) {
+    return ExtremumAndIndex<MinAndArgMinKernel>(a, axis, "min_and_argmin");
+}
+
 Array CountNonzero(const Array& a, const OptionalAxes& axis) {
     // TODO(aksub99): Fix after NotEqual(Array, Scalar) is supported.
     Array out = (a != ZerosLike(a)).Sum(axis);
@@ -93,7 +147,7 @@ Array CountNonzero(const Array& a, const OptionalAxes& axis) {
 Array NanArgMax(const Array& a, const OptionalAxes& axis) {
     Axes sorted_axis{};
     Shape out_shape{};
-    Array a_replaced = Where(IsNan(a), -INFINITY, a);
+    Array a_replaced = WhereCompare(CompareOp::kNotEqual, a, a, -INFINITY, a);
     if (axis.has_value()) {
         sorted_axis = internal::GetSortedAxes(*axis, a_replaced.ndim());
         int8_t i_axis = 0;
@@ -127,7 +181,7 @@ Array NanArgMax(const Array& a, const OptionalAxes& axis) {
 Array NanArgMin(const Array& a, const OptionalAxes& axis) {
     Axes sorted_axis{};
     Shape out_shape{};
-    Array a_replaced = Where(IsNan(a), INFINITY, a);
+    Array a_replaced = WhereCompare(CompareOp::kNotEqual, a, a, INFINITY, a);
 
     if (axis.has_value()) {
         sorted_axis = internal::GetSortedAxes(*axis, a_replaced.ndim());
@@ -159,4 +213,34 @@ Array NanArgMin(const Array& a, const OptionalAxes& axis) {
     return out;
 }
 
+std::tuple<Array, Array, Array, Array> Unique(const Array& a) {
+    NoBackpropModeScope scope{};
+    return a.device().backend().CallKernel<UniqueKernel>(a.Reshape({a.GetTotalSize()}));
+}
+
+Array Searchsorted(const Array& a, const Array& v, bool right) {
+    CheckEqual(a.device(), v.device());
+    if (a.ndim() == 0) {
+        throw DimensionError{"Searchsorted requires a sorted array of at least 1 dimension."};
+    }
+    if (a.ndim() > 1 && (v.ndim() != a.ndim() || !std::equal(a.shape().begin(), a.shape().end() - 1, v.shape().begin()))) {
+        throw DimensionError{"Cannot search values of shape ", v.shape(), " in sorted arrays of shape ", a.shape(), "."};
+    }
+
+    // The values are searched in the rows of a, all of them in a single row if a is 1-dimensional.
+    int64_t row_count = Shape{a.shape().begin(), a.shape().end() - 1}.GetTotalSize();
+    int64_t value_count = a.ndim() == 1 ? v.GetTotalSize() : v.shape().back();
+    Dtype dtype = ResultType(a, v);
+    Array out = Empty(Shape{row_count, value_count}, Dtype::kInt64, a.device());
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<SearchsortedKernel>(
+                a.AsType(dtype, false).Reshape({row_count, a.shape().back()}),
+                v.AsType(dtype, false).Reshape({row_count, value_count}),
+                right,
+                out);
+    }
+    return out.Reshape(v.shape());
+}
+
 }  // namespace chainerx
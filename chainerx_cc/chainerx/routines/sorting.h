@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tuple>
+
 #include <absl/types/optional.h>
 
 #include "chainerx/array.h"
@@ -11,10 +13,30 @@ Array ArgMax(const Array& a, const OptionalAxes& axis = absl::nullopt);
 
 Array ArgMin(const Array& a, const OptionalAxes& axis = absl::nullopt);
 
+// Returns the maxima along the given axes and their indices, computed in a single pass over the input.
+// The maxima are differentiable in the same way as AMax. If a NaN is found, it is the maximum and its index is returned.
+// Among equal maxima, the smallest index is returned.
+std::tuple<Array, Array> MaxAndArgMax(const Array& a, const OptionalAxes& axis = absl::nullopt);
+
+// Returns the minima along the given axes and their indices, computed in a single pass over the input.
+// See MaxAndArgMax for the details.
+std::tuple<Array, Array> MinAndArgMin(const Array& a, const OptionalAxes& axis = absl::nullopt);
+
 Array CountNonzero(const Array& a, const OptionalAxes& axis = absl::nullopt);
 
 Array NanArgMax(const Array& a, const OptionalAxes& axis = absl::nullopt);
 
 Array NanArgMin(const Array& a, const OptionalAxes& axis = absl::nullopt);
 
+// Returns the sorted unique elements of the flattened array, the indices of their first occurrences in it, the indices of the unique
+// elements which reconstruct it, and the numbers of their occurrences, computed by a single sort.
+// NaNs are sorted to the end and are equal to each other.
+std::tuple<Array, Array, Array, Array> Unique(const Array& a);
+
+// Returns the indices into the sorted array a at which the elements of v would be inserted to keep it sorted, by binary searches.
+// If right is false, the first such indices are returned, and otherwise the last ones.
+// If a has more than 1 dimension, the elements of v are searched in the rows of a along its last axis, and the shapes of a and v must
+// match except for the last axis. NaNs are sorted to the end.
+Array Searchsorted(const Array& a, const Array& v, bool right = false);
+
 }  // namespace chainerx
@@ -0,0 +1,172 @@
+#include "chainerx/routines/sorting.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/check_backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/statistics.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+#include "chainerx/testing/routines.h"
+#include "chainerx/testing/threading.h"
+
+namespace chainerx {
+namespace {
+
+class SortingTest : public ::testing::TestWithParam<std::string> {
+protected:
+    void SetUp() override {
+        const std::string& backend_name = GetParam();
+        device_session_.emplace(DeviceId{backend_name, 0});
+    }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+std::vector<Array> ToVector(const std::tuple<Array, Array>& outs) { return {std::get<0>(outs), std::get<1>(outs)}; }
+
+TEST_THREAD_SAFE_P(SortingTest, MaxAndArgMax) {
+    using T = float;
+
+    Array a = testing::BuildArray({2, 3, 4}).WithData<T>({3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8,  //
+                                                         9, 7, 9, 3, 2, 3, 8, 4, 6, 2, 6, 4})
+                      .WithPadding(1);
+    Array e_value = testing::BuildArray({2, 4}).WithData<T>({5, 9, 5, 8, 9, 7, 9, 4});
+    Array e_index = testing::BuildArray({2, 4}).WithData<int64_t>({1, 1, 2, 2, 0, 0, 0, 1});
+
+    Run([&]() {
+        testing::CheckForward(
+                [](const std::vector<Array>& xs) { return ToVector(MaxAndArgMax(xs[0], Axes{1})); }, {a}, {e_value, e_index});
+    });
+}
+
+TEST_THREAD_SAFE_P(SortingTest, MinAndArgMin) {
+    using T = float;
+
+    Array a = testing::BuildArray({2, 3, 4}).WithData<T>({3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8,  //
+                                                         9, 7, 9, 3, 2, 3, 8, 4, 6, 2, 6, 4})
+                      .WithPadding(1);
+    Array e_value = testing::BuildArray({3}).WithData<T>({1, 2, 2});
+    Array e_index = testing::BuildArray({3}).WithData<int64_t>({1, 2, 5});
+
+    Run([&]() {
+        testing::CheckForward(
+                [](const std::vector<Array>& xs) { return ToVector(MinAndArgMin(xs[0], Axes{0, 2})); }, {a}, {e_value, e_index});
+    });
+}
+
+TEST_P(SortingTest, MaxAndArgMaxMatchesAMaxAndArgMax) {
+    using T = double;
+
+    Array a = testing::BuildArray({3, 5, 7}).WithLinearData<T>(-20.0, 0.37).WithPadding(2);
+    for (const OptionalAxes& axis : {OptionalAxes{}, OptionalAxes{Axes{0}}, OptionalAxes{Axes{2, 0}}, OptionalAxes{Axes{1}}}) {
+        Array value{};
+        Array index{};
+        std::tie(value, index) = MaxAndArgMax(a, axis);
+        EXPECT_ARRAY_EQ(AMax(a, axis), value);
+        EXPECT_ARRAY_EQ(ArgMax(a, axis), index);
+
+        std::tie(value, index) = MinAndArgMin(a, axis);
+        EXPECT_ARRAY_EQ(AMin(a, axis), value);
+        EXPECT_ARRAY_EQ(ArgMin(a, axis), index);
+    }
+}
+
+TEST_P(SortingTest, MaxAndArgMaxTies) {
+    using T = int32_t;
+
+    // Long enough to be reduced in more than one block.
+    Array a = Full({2, 100}, 7, Dtype::kInt32);
+    Array e_value = testing::BuildArray({2}).WithData<T>({7, 7});
+    Array e_index = testing::BuildArray({2}).WithData<int64_t>({0, 0});
+
+    Array value{};
+    Array index{};
+    std::tie(value, index) = MaxAndArgMax(a, Axes{1});
+    EXPECT_ARRAY_EQ(e_value, value);
+    EXPECT_ARRAY_EQ(e_index, index);
+
+    std::tie(value, index) = MinAndArgMin(a, Axes{1});
+    EXPECT_ARRAY_EQ(e_value, value);
+    EXPECT_ARRAY_EQ(e_index, index);
+}
+
+TEST_P(SortingTest, MaxAndArgMaxZeroSized) {
+    Array a = Zeros({2, 0}, Dtype::kFloat32);
+    EXPECT_THROW(MaxAndArgMax(a, Axes{1}), DimensionError);
+    EXPECT_THROW(MinAndArgMin(a), DimensionError);
+}
+
+TEST_P(SortingTest, MaxAndArgMaxBackward) {
+    using T = double;
+
+    Array a = (*testing::BuildArray({2, 3}).WithData<T>({1, 5, 2, 4, 3, 6})).RequireGrad();
+    Array go = testing::BuildArray({2}).WithLinearData<T>(-0.1, 0.1);
+    Array eps = Full({2, 3}, 1e-3, Dtype::kFloat64);
+
+    CheckBackward([](const std::vector<Array>& xs) -> std::vector<Array> { return {std::get<0>(MaxAndArgMax(xs[0], Axes{1}))}; },
+                  {a},
+                  {go},
+                  {eps});
+    CheckBackward([](const std::vector<Array>& xs) -> std::vector<Array> { return {std::get<0>(MinAndArgMin(xs[0], Axes{1}))}; },
+                  {a},
+                  {go},
+                  {eps});
+}
+
+INSTANTIATE_TEST_CASE_P(
+        ForEachBackend,
+        SortingTest,
+        ::testing::Values(
+#ifdef CHAINERX_ENABLE_CUDA
+                std::string{"cuda"},
+#endif  // CHAINERX_ENABLE_CUDA
+                std::string{"native"}));
+
+// The CUDA kernels compute the indices in a separate pass and do not take NaNs into account.
+class SortingNativeTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(SortingNativeTest, MaxAndArgMaxNan) {
+    using T = float;
+
+    T nan = std::numeric_limits<T>::quiet_NaN();
+    Array a = testing::BuildArray({2, 4}).WithData<T>({1, nan, 3, nan, 2, 1, 4, 0});
+
+    Array value{};
+    Array index{};
+    std::tie(value, index) = MaxAndArgMax(a, Axes{1});
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<T>({nan, 4}), value);
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<int64_t>({1, 2}), index);
+
+    std::tie(value, index) = MinAndArgMin(a, Axes{1});
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<T>({nan, 0}), value);
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<int64_t>({1, 3}), index);
+}
+
+}  // namespace
+}  // namespace chainerx
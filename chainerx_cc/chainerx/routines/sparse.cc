@@ -0,0 +1,284 @@
+#include "chainerx/routines/sparse.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/array_index.h"
+#include "chainerx/backend.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/kernels/sparse.h"
+#include "chainerx/macro.h"
+#include "chainerx/routines/arithmetic.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/indexing.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/routines/statistics.h"
+#include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+#include "chainerx/slice.h"
+
+namespace chainerx {
+namespace {
+
+void CheckSparseShape(const Shape& shape) {
+    if (shape.ndim() != 2) {
+        throw DimensionError{"Sparse matrices must be 2-dimensional, but got shape ", shape, "."};
+    }
+}
+
+// Returns the indices of a sparse matrix as a contiguous int64 array.
+Array AsSparseIndices(const Array& indices, const Device& device) {
+    CheckEqual(indices.device(), device);
+    if (indices.ndim() != 1) {
+        throw DimensionError{"Indices of sparse matrices must be 1-dimensional, but got shape ", indices.shape(), "."};
+    }
+    if (GetKind(indices.dtype()) != DtypeKind::kInt && GetKind(indices.dtype()) != DtypeKind::kUInt) {
+        throw DtypeError{"Indices of sparse matrices must be of an integral dtype, but got ", indices.dtype(), "."};
+    }
+    return AsContiguous(indices, Dtype::kInt64);
+}
+
+void CheckSparseIndexBounds(const Array& indices, int64_t size) {
+    if (indices.GetTotalSize() == 0) {
+        return;
+    }
+    NoBackpropModeScope scope{};
+    auto min_index = static_cast<int64_t>(AsScalar(AMin(indices)));
+    auto max_index = static_cast<int64_t>(AsScalar(AMax(indices)));
+    if (min_index < 0 || size <= max_index) {
+        throw IndexError{"Indices of a sparse matrix range from ", min_index, " to ", max_index, ", out of bounds of size ", size, "."};
+    }
+}
+
+// Returns the row of each element of a sparse matrix in the CSR format.
+Array GetCsrRows(const Array& indptr, int64_t nnz) {
+    // The row of each element is the number of rows starting at or before it, but the first.
+    NoBackpropModeScope scope{};
+    int64_t m = indptr.GetTotalSize() - 1;
+    Array row_starts = Zeros(Shape{nnz + 1}, Dtype::kInt64, indptr.device());
+    if (m > 1) {
+        Array starts = indptr.At({Slice{1, m}});
+        row_starts = AddAt(row_starts, starts, 0, OnesLike(starts));
+    }
+    return Cumsum(row_starts).At({Slice{0, nnz}});
+}
+
+// Returns the transpose of a sparse matrix in the CSR format with the given data and valid indices.
+// The gradient of the data of the transpose is propagated to data.
+CsrMatrix TransposeCsr(const Array& data, const Array& indices, const Array& indptr, const Shape& shape) {
+    Device& device = data.device();
+    Array t_indptr = Empty(Shape{shape[1] + 1}, Dtype::kInt64, device);
+    Array order = Empty(indices.shape(), Dtype::kInt64, device);
+    Array t_indices{};
+    {
+        NoBackpropModeScope scope{};
+        device.backend().CallKernel<CooToCsrKernel>(indices, t_indptr, order);
+        t_indices = Take(GetCsrRows(indptr, indices.GetTotalSize()), order, 0);
+    }
+    return internal::MakeCsrMatrixUnchecked(Take(data, order, 0), t_indices, t_indptr, Shape{shape[1], shape[0]});
+}
+
+Array CsrMatmul(const CsrMatrix& a, const Array& b);
+
+// Returns the dot products of the rows of a and b at the non-zero positions of the sparse matrix with the given indices and shape, in the
+// order of its elements.
+Array CsrSampledDot(const Array& indices, const Array& indptr, const Shape& shape, const Array& a, const Array& b) {
+    CHAINERX_ASSERT(a.ndim() == 2);
+    CHAINERX_ASSERT(b.ndim() == 2);
+    CHAINERX_ASSERT(a.shape()[0] == shape[0]);
+    CHAINERX_ASSERT(b.shape()[0] == shape[1]);
+    CHAINERX_ASSERT(a.shape()[1] == b.shape()[1]);
+
+    Dtype out_dtype = ResultType(a, b);
+    Array a_cast = a.AsType(out_dtype, false);
+    Array b_cast = b.AsType(out_dtype, false);
+    Array out = Empty(indices.shape(), out_dtype, a.device());
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<CsrSampledDotKernel>(indices, indptr, a_cast, b_cast, out);
+    }
+
+    {
+        BackwardBuilder bb{"sparse_sampled_dot", {a_cast, b_cast}, out};
+        if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+            bt.Define([indices, indptr, shape, b_tok = bb.RetainInput(1)](BackwardContext& bctx) {
+                const Array& b = bctx.GetRetainedInput(b_tok);
+                bctx.input_grad() = CsrMatmul(internal::MakeCsrMatrixUnchecked(*bctx.output_grad(), indices, indptr, shape), b);
+            });
+        }
+        if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
+            bt.Define([indices, indptr, shape, a_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+                const Array& a = bctx.GetRetainedInput(a_tok);
+                bctx.input_grad() = CsrMatmul(TransposeCsr(*bctx.output_grad(), indices, indptr, shape), a);
+            });
+        }
+        bb.Finalize();
+    }
+
+    return out;
+}
+
+// Returns the product of a sparse matrix in the CSR format and a dense matrix.
+// The gradient of the non-zero elements is the dot products of the rows of the output gradient and b at their positions, and the
+// gradient of b is the product of the transpose of the sparse matrix and the output gradient.
+Array CsrMatmul(const CsrMatrix& a, const Array& b) {
+    CHAINERX_ASSERT(b.ndim() == 2);
+    CHAINERX_ASSERT(a.shape()[1] == b.shape()[0]);
+
+    Dtype out_dtype = ResultType(a.data(), b);
+    if (out_dtype == Dtype::kBool) {
+        throw DtypeError{"Sparse matrix products do not support dtype ", out_dtype, "."};
+    }
+    Array data = a.data().AsType(out_dtype, false);
+    Array b_cast = b.AsType(out_dtype, false);
+    Array out = Empty(Shape{a.shape()[0], b.shape()[1]}, out_dtype, b.device());
+    {
+        NoBackpropModeScope scope{};
+        b.device().backend().CallKernel<CsrMatmulKernel>(data, a.indices(), a.indptr(), b_cast, out);
+    }
+
+    {
+        BackwardBuilder bb{"sparse_matmul", {data, b_cast}, out};
+        if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+            bt.Define([indices = a.indices(), indptr = a.indptr(), shape = a.shape(), b_tok = bb.RetainInput(1)](BackwardContext& bctx) {
+                const Array& b = bctx.GetRetainedInput(b_tok);
+                bctx.input_grad() = CsrSampledDot(indices, indptr, shape, *bctx.output_grad(), b);
+            });
+        }
+        if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
+            bt.Define([indices = a.indices(), indptr = a.indptr(), shape = a.shape(), data_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+                const Array& data = bctx.GetRetainedInput(data_tok);
+                bctx.input_grad() = CsrMatmul(TransposeCsr(data, indices, indptr, shape), *bctx.output_grad());
+            });
+        }
+        bb.Finalize();
+    }
+
+    return out;
+}
+
+}  // namespace
+
+CooMatrix::CooMatrix(const Array& data, const Array& row, const Array& col, const Shape& shape)
+    : data_{data}, row_{AsSparseIndices(row, data.device())}, col_{AsSparseIndices(col, data.device())}, shape_{shape} {
+    CheckSparseShape(shape_);
+    if (data_.ndim() != 1 || data_.shape() != row_.shape() || data_.shape() != col_.shape()) {
+        throw DimensionError{
+                "Data and indices of a sparse matrix must be 1-dimensional of the same length, but got shapes ",
+                data_.shape(),
+                ", ",
+                row_.shape(),
+                " and ",
+                col_.shape(),
+                "."};
+    }
+    CheckSparseIndexBounds(row_, shape_[0]);
+    CheckSparseIndexBounds(col_, shape_[1]);
+}
+
+CsrMatrix::CsrMatrix(const Array& data, const Array& indices, const Array& indptr, const Shape& shape)
+    : data_{data}, indices_{AsSparseIndices(indices, data.device())}, indptr_{AsSparseIndices(indptr, data.device())}, shape_{shape} {
+    CheckSparseShape(shape_);
+    if (data_.ndim() != 1 || data_.shape() != indices_.shape()) {
+        throw DimensionError{
+                "Data and indices of a sparse matrix must be 1-dimensional of the same length, but got shapes ",
+                data_.shape(),
+                " and ",
+                indices_.shape(),
+                "."};
+    }
+    if (indptr_.GetTotalSize() != shape_[0] + 1) {
+        throw DimensionError{"Row pointers of a sparse matrix of shape ", shape_, " must have ", shape_[0] + 1, " elements."};
+    }
+    {
+        NoBackpropModeScope scope{};
+        int64_t m = shape_[0];
+        if (static_cast<int64_t>(AsScalar(indptr_.At({0}))) != 0 || static_cast<int64_t>(AsScalar(indptr_.At({m}))) != nnz() ||
+            (m > 0 && static_cast<int64_t>(AsScalar(AMin(indptr_.At({Slice{1, m + 1}}) - indptr_.At({Slice{0, m}})))) < 0)) {
+            throw IndexError{"Row pointers of a sparse matrix must be non-decreasing from 0 to the number of non-zero elements."};
+        }
+    }
+    CheckSparseIndexBounds(indices_, shape_[1]);
+}
+
+namespace internal {
+
+CsrMatrix MakeCsrMatrixUnchecked(const Array& data, const Array& indices, const Array& indptr, const Shape& shape) {
+    CHAINERX_ASSERT(indices.dtype() == Dtype::kInt64 && indices.IsContiguous());
+    CHAINERX_ASSERT(indptr.dtype() == Dtype::kInt64 && indptr.IsContiguous());
+    CHAINERX_ASSERT(data.shape() == indices.shape());
+    CHAINERX_ASSERT(indptr.GetTotalSize() == shape[0] + 1);
+    CsrMatrix a{};
+    a.data_ = data;
+    a.indices_ = indices;
+    a.indptr_ = indptr;
+    a.shape_ = shape;
+    return a;
+}
+
+}  // namespace internal
+
+CooMatrix ToCoo(const Array& a) {
+    CheckSparseShape(a.shape());
+    std::vector<Array> nonzero = Nonzero(a);
+    Array flat_indices = nonzero[0] * a.shape()[1] + nonzero[1];
+    return CooMatrix{Take(a.Reshape({a.GetTotalSize()}), flat_indices, 0), nonzero[0], nonzero[1], a.shape()};
+}
+
+CsrMatrix ToCsr(const Array& a) { return ToCsr(ToCoo(a)); }
+
+CooMatrix ToCoo(const CsrMatrix& a) { return CooMatrix{a.data(), GetCsrRows(a.indptr(), a.nnz()), a.indices(), a.shape()}; }
+
+CsrMatrix ToCsr(const CooMatrix& a) {
+    Device& device = a.data().device();
+    Array indptr = Empty(Shape{a.shape()[0] + 1}, Dtype::kInt64, device);
+    Array order = Empty(Shape{a.nnz()}, Dtype::kInt64, device);
+    {
+        NoBackpropModeScope scope{};
+        device.backend().CallKernel<CooToCsrKernel>(a.row(), indptr, order);
+    }
+    Array col{};
+    {
+        NoBackpropModeScope scope{};
+        col = Take(a.col(), order, 0);
+    }
+    return internal::MakeCsrMatrixUnchecked(Take(a.data(), order, 0), col, indptr, a.shape());
+}
+
+Array ToDense(const CooMatrix& a) {
+    Array flat_indices{};
+    {
+        NoBackpropModeScope scope{};
+        flat_indices = a.row() * a.shape()[1] + a.col();
+    }
+    Array zeros = Zeros(Shape{a.shape().GetTotalSize()}, a.data().dtype(), a.data().device());
+    return AddAt(zeros, flat_indices, 0, a.data()).Reshape(a.shape());
+}
+
+Array ToDense(const CsrMatrix& a) { return ToDense(ToCoo(a)); }
+
+Array SparseMatmul(const CsrMatrix& a, const Array& b) {
+    CheckEqual(a.data().device(), b.device());
+    if (b.ndim() != 1 && b.ndim() != 2) {
+        throw DimensionError{"Sparse matrices can only be multiplied by vectors and matrices, but got shape ", b.shape(), "."};
+    }
+    if (b.shape()[0] != a.shape()[1]) {
+        throw DimensionError{"Axis dimension mismatch between ", a.shape(), " and ", b.shape()};
+    }
+    if (b.ndim() == 1) {
+        return CsrMatmul(a, b.Reshape({b.shape()[0], 1})).Reshape({a.shape()[0]});
+    }
+    return CsrMatmul(a, b);
+}
+
+Array SparseMatmul(const CooMatrix& a, const Array& b) { return SparseMatmul(ToCsr(a), b); }
+
+}  // namespace chainerx
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+#include "chainerx/array.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+// Sparse matrix in the coordinate (COO) format, whose non-zero elements data[p] are at (row[p], col[p]).
+// The elements may be in any order, and elements at the same position are summed up.
+class CooMatrix {
+public:
+    // The indices are cast to int64 and must be within the shape.
+    CooMatrix(const Array& data, const Array& row, const Array& col, const Shape& shape);
+
+    const Array& data() const { return data_; }
+    const Array& row() const { return row_; }
+    const Array& col() const { return col_; }
+    const Shape& shape() const { return shape_; }
+    int64_t nnz() const { return data_.GetTotalSize(); }
+
+private:
+    Array data_;
+    Array row_;
+    Array col_;
+    Shape shape_;
+};
+
+class CsrMatrix;
+
+namespace internal {
+
+// Creates a sparse matrix in the CSR format from contiguous int64 indices which are known to be valid, e.g. derived from those of another
+// matrix, without the checks of the constructor which synchronize the device.
+CsrMatrix MakeCsrMatrixUnchecked(const Array& data, const Array& indices, const Array& indptr, const Shape& shape);
+
+}  // namespace internal
+
+// Sparse matrix in the compressed sparse row (CSR) format, whose non-zero elements in the i-th row are data[indptr[i]:indptr[i + 1]] at
+// the columns indices[indptr[i]:indptr[i + 1]].
+class CsrMatrix {
+public:
+    // The indices are cast to int64 and must be within the shape.
+    CsrMatrix(const Array& data, const Array& indices, const Array& indptr, const Shape& shape);
+
+    const Array& data() const { return data_; }
+    const Array& indices() const { return indices_; }
+    const Array& indptr() const { return indptr_; }
+    const Shape& shape() const { return shape_; }
+    int64_t nnz() const { return data_.GetTotalSize(); }
+
+private:
+    friend CsrMatrix internal::MakeCsrMatrixUnchecked(const Array& data, const Array& indices, const Array& indptr, const Shape& shape);
+
+    CsrMatrix() = default;
+
+    Array data_;
+    Array indices_;
+    Array indptr_;
+    Shape shape_;
+};
+
+// Converts a matrix into a sparse matrix of its non-zero elements in C-order.
+// The gradients of the non-zero elements are propagated to the matrix.
+CooMatrix ToCoo(const Array& a);
+
+CsrMatrix ToCsr(const Array& a);
+
+// Converts a sparse matrix in the CSR format into the COO format, in the same order of the elements.
+CooMatrix ToCoo(const CsrMatrix& a);
+
+// Converts a sparse matrix in the COO format into the CSR format, sorting the elements by their rows stably.
+CsrMatrix ToCsr(const CooMatrix& a);
+
+Array ToDense(const CooMatrix& a);
+
+Array ToDense(const CsrMatrix& a);
+
+// Returns the product of a sparse matrix and a dense matrix or vector.
+// The gradients are propagated to the non-zero elements of the sparse matrix and to the dense operand.
+Array SparseMatmul(const CsrMatrix& a, const Array& b);
+
+Array SparseMatmul(const CooMatrix& a, const Array& b);
+
+}  // namespace chainerx
@@ -1,5 +1,14 @@
 #include "chainerx/routines/statistics.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
 
@@ -7,16 +16,60 @@
 #include "chainerx/backward.h"
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
+#include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/error.h"
 #include "chainerx/kernels/arithmetic.h"
 #include "chainerx/kernels/reduction.h"
 #include "chainerx/kernels/statistics.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+#include "chainerx/slice.h"
 
 namespace chainerx {
+namespace {
+
+// Returns the dtype of a histogram, which is the dtype of the weights if it is floating.
+Dtype GetHistogramDtype(const absl::optional<Array>& weights) {
+    if (!weights.has_value()) {
+        return Dtype::kInt64;
+    }
+    return GetKind(weights->dtype()) == DtypeKind::kFloat ? weights->dtype() : Dtype::kFloat64;
+}
+
+// Returns the flattened weights of the elements of a in the given dtype.
+absl::optional<Array> FlattenHistogramWeights(const Array& a, const absl::optional<Array>& weights, Dtype dtype) {
+    if (!weights.has_value()) {
+        return absl::nullopt;
+    }
+    CheckEqual(a.device(), weights->device());
+    if (weights->shape() != a.shape()) {
+        throw DimensionError{"Weights of shape ", weights->shape(), " do not match the array of shape ", a.shape(), "."};
+    }
+    return weights->AsType(dtype, false).Reshape({a.GetTotalSize()});
+}
+
+// Returns the histogram of the flattened array in the bins of the given edges, which have the dtype of the array.
+Array HistogramWithEdges(const Array& a, const Array& edges, const absl::optional<Array>& weights) {
+    Dtype dtype = GetHistogramDtype(weights);
+    absl::optional<Array> flat_weights = FlattenHistogramWeights(a, weights, dtype);
+    Array out = Empty(Shape{edges.GetTotalSize() - 1}, dtype, a.device());
+    a.device().backend().CallKernel<HistogramKernel>(a.Reshape({a.GetTotalSize()}), edges, flat_weights, out);
+    return out;
+}
+
+void CheckHistogramDtype(const Array& a) {
+    if (a.dtype() == Dtype::kBool) {
+        throw DtypeError{"Histograms do not support dtype ", a.dtype(), "."};
+    }
+}
+
+}  // namespace
 
 Array AMax(const Array& a, const OptionalAxes& axis, bool keepdims) {
     Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
@@ -153,4 +206,170 @@ Array Var(const Array& a, const OptionalAxes& axis, bool keepdims) {
     return Mean(diff * diff, sorted_axis, keepdims);
 }
 
+Array Bincount(const Array& x, const absl::optional<Array>& weights, int64_t minlength) {
+    if (x.ndim() != 1) {
+        throw DimensionError{"Bincount requires a 1-dimensional array, but got shape ", x.shape(), "."};
+    }
+    if (GetKind(x.dtype()) == DtypeKind::kFloat) {
+        throw DtypeError{"Bincount requires an array of an integral dtype, but got ", x.dtype(), "."};
+    }
+    if (minlength < 0) {
+        throw ChainerxError{"Minimum length of Bincount must be non-negative, but got ", minlength, "."};
+    }
+
+    NoBackpropModeScope scope{};
+    Array x_cast = x.AsType(Dtype::kInt64, false);
+    int64_t length = minlength;
+    if (x.GetTotalSize() > 0) {
+        auto min_value = static_cast<int64_t>(AsScalar(AMin(x_cast)));
+        if (min_value < 0) {
+            throw ChainerxError{"Bincount requires non-negative integers, but got ", min_value, "."};
+        }
+        length = std::max(length, static_cast<int64_t>(AsScalar(AMax(x_cast))) + 1);
+    }
+
+    Dtype dtype = GetHistogramDtype(weights);
+    absl::optional<Array> flat_weights = FlattenHistogramWeights(x, weights, dtype);
+    Array out = Empty(Shape{length}, dtype, x.device());
+    x.device().backend().CallKernel<BincountKernel>(x_cast, flat_weights, out);
+    return out;
+}
+
+std::tuple<Array, Array> Histogram(
+        const Array& a, int64_t bins, const absl::optional<std::pair<double, double>>& range, const absl::optional<Array>& weights) {
+    CheckHistogramDtype(a);
+    if (bins < 1) {
+        throw ChainerxError{"Number of bins must be positive, but got ", bins, "."};
+    }
+
+    NoBackpropModeScope scope{};
+    double first_edge = 0.0;
+    double last_edge = 1.0;
+    if (range.has_value()) {
+        std::tie(first_edge, last_edge) = *range;
+        if (first_edge > last_edge) {
+            throw ChainerxError{"Range of a histogram must be increasing, but got [", first_edge, ", ", last_edge, "]."};
+        }
+    } else if (a.GetTotalSize() > 0) {
+        first_edge = static_cast<double>(AsScalar(AMin(a)));
+        last_edge = static_cast<double>(AsScalar(AMax(a)));
+    }
+    if (!std::isfinite(first_edge) || !std::isfinite(last_edge)) {
+        throw ChainerxError{"Range of a histogram must be finite, but got [", first_edge, ", ", last_edge, "]."};
+    }
+    if (first_edge == last_edge) {
+        first_edge -= 0.5;
+        last_edge += 0.5;
+    }
+
+    // Integral arrays are binned in float64.
+    Dtype edge_dtype = GetKind(a.dtype()) == DtypeKind::kFloat ? a.dtype() : Dtype::kFloat64;
+    Array edges = Linspace(first_edge, last_edge, bins + 1, true, edge_dtype, a.device());
+    return std::make_tuple(HistogramWithEdges(a.AsType(edge_dtype, false), edges, weights), edges);
+}
+
+std::tuple<Array, Array> Histogram(const Array& a, const Array& bins, const absl::optional<Array>& weights) {
+    CheckHistogramDtype(a);
+    CheckEqual(a.device(), bins.device());
+    int64_t edge_count = bins.GetTotalSize();
+    if (bins.ndim() != 1 || edge_count < 2) {
+        throw DimensionError{"Bin edges must be 1-dimensional with at least 2 elements, but got shape ", bins.shape(), "."};
+    }
+
+    NoBackpropModeScope scope{};
+    if (static_cast<double>(AsScalar(AMin(bins.At({Slice{1, edge_count}}) - bins.At({Slice{0, edge_count - 1}})))) < 0) {
+        throw ChainerxError{"Bin edges must increase monotonically."};
+    }
+    Dtype dtype = ResultType(a, bins);
+    return std::make_tuple(HistogramWithEdges(a.AsType(dtype, false), bins.AsType(dtype, false), weights), bins);
+}
+
+namespace {
+
+// Returns the quantiles of a along the axes in the shape of q_shape followed by the reduced shape.
+Array QuantileImpl(
+        const Array& a, const std::vector<double>& q, const Shape& q_shape, const OptionalAxes& axis, bool keepdims, bool ignore_nan) {
+    if (a.dtype() == Dtype::kBool) {
+        throw DtypeError{"Quantiles do not support dtype ", a.dtype(), "."};
+    }
+    for (double quantile : q) {
+        if (!(0 <= quantile && quantile <= 1)) {
+            throw ChainerxError{"Quantiles must be in the range [0, 1], but got ", quantile, "."};
+        }
+    }
+
+    // The reduced axes are moved to the end, so that each row of the matrix is reduced to its quantiles.
+    Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
+    Axes transpose_axes{};
+    Shape out_shape = q_shape;
+    int64_t row_count = 1;
+    for (int8_t i = 0; i < a.ndim(); ++i) {
+        if (std::find(sorted_axis.begin(), sorted_axis.end(), i) == sorted_axis.end()) {
+            transpose_axes.emplace_back(i);
+            row_count *= a.shape()[i];
+        }
+    }
+    std::copy(sorted_axis.begin(), sorted_axis.end(), std::back_inserter(transpose_axes));
+    Shape reduced_shape = internal::ReduceShape(a.shape(), sorted_axis, keepdims);
+    std::copy(reduced_shape.begin(), reduced_shape.end(), std::back_inserter(out_shape));
+
+    NoBackpropModeScope scope{};
+    Dtype out_dtype = PromoteInt2Float(a.dtype());
+    int64_t row_size = internal::CountItemsAlongAxes(a.shape(), sorted_axis);
+    Array a_matrix = a.AsType(out_dtype, false).Transpose(transpose_axes).Reshape({row_count, row_size});
+    Array out = Empty(Shape{static_cast<int64_t>(q.size()), row_count}, out_dtype, a.device());
+    a.device().backend().CallKernel<QuantileKernel>(a_matrix, q, ignore_nan, out);
+    return out.Reshape(out_shape);
+}
+
+std::vector<double> PercentilesToQuantiles(const std::vector<double>& q) {
+    std::vector<double> quantiles;
+    quantiles.reserve(q.size());
+    for (double percentile : q) {
+        if (!(0 <= percentile && percentile <= 100)) {
+            throw ChainerxError{"Percentiles must be in the range [0, 100], but got ", percentile, "."};
+        }
+        quantiles.emplace_back(percentile / 100);
+    }
+    return quantiles;
+}
+
+}  // namespace
+
+Array Quantile(const Array& a, double q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, {q}, Shape{}, axis, keepdims, false);
+}
+
+Array Quantile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, q, Shape{static_cast<int64_t>(q.size())}, axis, keepdims, false);
+}
+
+Array Percentile(const Array& a, double q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, PercentilesToQuantiles({q}), Shape{}, axis, keepdims, false);
+}
+
+Array Percentile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, PercentilesToQuantiles(q), Shape{static_cast<int64_t>(q.size())}, axis, keepdims, false);
+}
+
+Array Median(const Array& a, const OptionalAxes& axis, bool keepdims) { return QuantileImpl(a, {0.5}, Shape{}, axis, keepdims, false); }
+
+Array NanQuantile(const Array& a, double q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, {q}, Shape{}, axis, keepdims, true);
+}
+
+Array NanQuantile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, q, Shape{static_cast<int64_t>(q.size())}, axis, keepdims, true);
+}
+
+Array NanPercentile(const Array& a, double q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, PercentilesToQuantiles({q}), Shape{}, axis, keepdims, true);
+}
+
+Array NanPercentile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis, bool keepdims) {
+    return QuantileImpl(a, PercentilesToQuantiles(q), Shape{static_cast<int64_t>(q.size())}, axis, keepdims, true);
+}
+
+Array NanMedian(const Array& a, const OptionalAxes& axis, bool keepdims) { return QuantileImpl(a, {0.5}, Shape{}, axis, keepdims, true); }
+
 }  // namespace chainerx
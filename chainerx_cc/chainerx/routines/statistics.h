@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include <absl/types/optional.h>
 
 #include "chainerx/array.h"
@@ -15,4 +20,42 @@ Array Mean(const Array& a, const OptionalAxes& axis = absl::nullopt, bool keepdi
 
 Array Var(const Array& a, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
 
+// Returns the quantiles of a along the axes, linearly interpolated between the nearest elements.
+// The quantiles must be in [0, 1]. If a sequence of quantiles is given, they are stacked along the first axis of the output.
+// The output is of a floating point dtype, and NaN wherever a NaN or no element is reduced. These routines are not differentiable.
+Array Quantile(const Array& a, double q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+Array Quantile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+
+// Returns the percentiles of a along the axes, as Quantile does for q / 100.
+Array Percentile(const Array& a, double q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+Array Percentile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+
+Array Median(const Array& a, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+
+// Variants of Quantile, Percentile and Median which ignore NaNs.
+Array NanQuantile(const Array& a, double q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+Array NanQuantile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+
+Array NanPercentile(const Array& a, double q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+Array NanPercentile(const Array& a, const std::vector<double>& q, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+
+Array NanMedian(const Array& a, const OptionalAxes& axis = absl::nullopt, bool keepdims = false);
+
+// Counts the occurrences of the non-negative integers in the 1-dimensional array x.
+// The output has max(x) + 1 elements, and at least minlength. If weights are given, they are summed instead of ones.
+// The output is int64 without weights, and otherwise of the dtype of the weights if it is floating, or float64.
+Array Bincount(const Array& x, const absl::optional<Array>& weights = absl::nullopt, int64_t minlength = 0);
+
+// Returns the histogram of the flattened array in the given number of equal-width bins, and the bin edges.
+// The bins span range, which defaults to the minimum and the maximum of the array, and elements outside of it are ignored.
+// The last bin includes its right edge. The dtype of the histogram follows Bincount.
+std::tuple<Array, Array> Histogram(
+        const Array& a,
+        int64_t bins = 10,
+        const absl::optional<std::pair<double, double>>& range = absl::nullopt,
+        const absl::optional<Array>& weights = absl::nullopt);
+
+// Returns the histogram of the flattened array in the bins given by their monotonically increasing edges, and the edges.
+std::tuple<Array, Array> Histogram(const Array& a, const Array& bins, const absl::optional<Array>& weights = absl::nullopt);
+
 }  // namespace chainerx
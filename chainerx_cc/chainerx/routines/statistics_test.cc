@@ -95,6 +95,27 @@ TEST_THREAD_SAFE_P(StatisticsTest, MeanLarge) {
     Run([&]() { testing::CheckForward([](const std::vector<Array>& xs) { return std::vector<Array>{Mean(xs[0], Axes{0})}; }, {a}, {e}); });
 }
 
+TEST_THREAD_SAFE_P(StatisticsTest, MeanContiguous) {
+    using T = double;
+
+    // Reductions over the trailing axes of contiguous arrays.
+    Array a = testing::BuildArray({2, 3, 4}).WithLinearData<T>();
+    Array large = testing::BuildArray({0x100000}).WithLinearData<T>();
+    Array e1 = testing::BuildArray({2, 3}).WithData<T>({1.5, 5.5, 9.5, 13.5, 17.5, 21.5});
+    Array e2 = testing::BuildArray({2}).WithData<T>({5.5, 17.5});
+    Array e3 = testing::BuildArray({}).WithData<T>({11.5});
+    Array e_large = testing::BuildArray({}).WithData<T>({524287.5});
+
+    Run([&]() {
+        testing::CheckForward(
+                [](const std::vector<Array>& xs) {
+                    return std::vector<Array>{Mean(xs[0], Axes{2}), Mean(xs[0], Axes{1, 2}), Mean(xs[0]), Mean(xs[1])};
+                },
+                {a, large},
+                {e1, e2, e3, e_large});
+    });
+}
+
 TEST_THREAD_SAFE_P(StatisticsTest, MeanKeepDims) {
     using T = float;
 
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include "chainerx/allocation_tracking.h"
+
+namespace chainerx {
+namespace testing {
+
+// The number and the total size of device memory allocations.
+struct AllocationCount {
+    int64_t count;
+    int64_t bytesize;
+};
+
+// Calls the function and returns the allocations made by any device during the call.
+// Only one call can be in progress at any given moment, although the function itself may run on multiple threads.
+// This function does not depend on gtest, so that it can be used in benchmarks as well as in tests.
+template <typename Func>
+AllocationCount CountAllocations(const Func& func) {
+    internal::AllocationTracker tracker{};
+    {
+        internal::AllocationTrackingScope scope{tracker};
+        func();
+    }
+    return AllocationCount{tracker.count(), tracker.bytesize()};
+}
+
+}  // namespace testing
+}  // namespace chainerx
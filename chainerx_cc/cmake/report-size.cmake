@@ -0,0 +1,9 @@
+# Prints the size of a built file.
+# Usage: cmake -DREPORT_SIZE_FILE=<path> -P report-size.cmake
+if(CMAKE_VERSION VERSION_LESS 3.14)
+    return()
+endif()
+file(SIZE ${REPORT_SIZE_FILE} size)
+math(EXPR size_kib "${size} / 1024")
+get_filename_component(name ${REPORT_SIZE_FILE} NAME)
+message(STATUS "${name}: ${size_kib} KiB")
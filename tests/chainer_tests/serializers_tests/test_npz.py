@@ -681,4 +681,47 @@ class TestGroupHierachy(unittest.TestCase):
         self.assertFalse(hasattr(self.parent.child.linear, 'b'))
 
 
+@attr.chainerx
+@testing.parameterize(*testing.product({
+    'link_type': ['linear', 'convolution'],
+}))
+class TestLoadNpzChainerxAfterForward(unittest.TestCase):
+
+    def _make_link(self):
+        if self.link_type == 'linear':
+            return links.Linear(3, 2)
+        return links.Convolution2D(2, 3, 2)
+
+    def _make_input(self):
+        if self.link_type == 'linear':
+            shape = (4, 3)
+        else:
+            shape = (2, 2, 4, 4)
+        return numpy.random.uniform(-1, 1, shape).astype(numpy.float32)
+
+    def test_load_after_forward(self):
+        source = self._make_link()
+        target = self._make_link()
+        target.to_device('native:0')
+        x = self._make_input()
+
+        # Run a forward pass before loading, so that anything derived from
+        # the initial weights could be reused by the next one.
+        target(chainerx.asarray(x))
+        version = chainerx._core._get_data_version(target.W.array)
+
+        f = six.BytesIO()
+        npz.save_npz(f, source)
+        f.seek(0)
+        npz.load_npz(f, target)
+
+        # Loading writes the weights in place, which bumps their version.
+        assert chainerx._core._get_data_version(target.W.array) > version
+
+        y = target(chainerx.asarray(x))
+        testing.assert_allclose(
+            source(x).array, chainerx.to_numpy(y.array),
+            atol=1e-5, rtol=1e-4)
+
+
 testing.run_module(__name__, __file__)
@@ -1,3 +1,4 @@
+import math
 import random
 import chainer
 import numpy
@@ -396,3 +397,141 @@ class TestSoftplus(UnaryMathTestBase, op_utils.NumpyOpTest):
             return xp.softplus(a)
         else:
             return xp.softplus(a, self.beta)
+
+
+def _numpy_sigmoid(a):
+    return numpy.reciprocal(1 + numpy.exp(-a))
+
+
+def _numpy_softplus(a):
+    return numpy.fmax(a, 0) + numpy.log1p(numpy.exp(-numpy.fabs(a)))
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*(
+    # Special shapes
+    chainer.testing.product({
+        'shape': [(), (0,), (1,), (2, 0, 3), (1, 1, 1), (2, 3)],
+        'in_dtypes,out_dtype': _in_out_dtypes_math_functions,
+        'input': [-2, 2],
+        'contiguous': [None, 'C'],
+        'approximate': [False, True],
+    })
+    # Random values
+    + chainer.testing.product({
+        'shape': [(2, 3)],
+        'in_dtypes,out_dtype': _in_out_float_dtypes_math_functions,
+        'input': ['random'],
+        'approximate': [False, True],
+    })
+    # Special values
+    + chainer.testing.product({
+        'shape': [(2, 3)],
+        'in_dtypes,out_dtype': _in_out_float_dtypes_math_functions,
+        'input': [0, float('inf'), -float('inf'), float('nan')],
+        'skip_backward_test': [True],
+        'skip_double_backward_test': [True],
+        'approximate': [False, True],
+    })
+))
+class TestGelu(UnaryMathTestBase, op_utils.NumpyOpTest):
+
+    def func(self, xp, a):
+        if xp is numpy:
+            if self.approximate:
+                t = numpy.tanh(
+                    math.sqrt(2 / math.pi) * (a + 0.044715 * a * a * a))
+                return 0.5 * a * (1 + t)
+            erf = numpy.vectorize(math.erf, otypes=[a.dtype])
+            return 0.5 * a * (1 + erf(a / math.sqrt(2)))
+        return xp.gelu(a, self.approximate)
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*(
+    # Special shapes
+    chainer.testing.product({
+        'shape': [(), (0,), (1,), (2, 0, 3), (1, 1, 1), (2, 3)],
+        'in_dtypes,out_dtype': _in_out_dtypes_math_functions,
+        'input': [-2, 2],
+        'contiguous': [None, 'C'],
+    })
+    # Random values
+    + chainer.testing.product({
+        'shape': [(2, 3)],
+        'in_dtypes,out_dtype': _in_out_float_dtypes_math_functions,
+        'input': ['random'],
+    })
+    # Special values
+    + chainer.testing.product({
+        'shape': [(2, 3)],
+        'in_dtypes,out_dtype': _in_out_float_dtypes_math_functions,
+        'input': [0, float('inf'), -float('inf'), float('nan')],
+        'skip_backward_test': [True],
+        'skip_double_backward_test': [True],
+    })
+))
+class TestSilu(UnaryMathTestBase, op_utils.NumpyOpTest):
+
+    def func(self, xp, a):
+        if xp is numpy:
+            return a * _numpy_sigmoid(a)
+        return xp.silu(a)
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*(
+    # Special shapes
+    chainer.testing.product({
+        'shape': [(), (0,), (1,), (2, 0, 3), (1, 1, 1), (2, 3)],
+        'in_dtypes,out_dtype': _in_out_dtypes_math_functions,
+        'input': [-2, 2],
+        'contiguous': [None, 'C'],
+    })
+    # Random values
+    + chainer.testing.product({
+        'shape': [(2, 3)],
+        'in_dtypes,out_dtype': _in_out_float_dtypes_math_functions,
+        'input': ['random'],
+    })
+    # Special values
+    + chainer.testing.product({
+        'shape': [(2, 3)],
+        'in_dtypes,out_dtype': _in_out_float_dtypes_math_functions,
+        'input': [0, float('inf'), -float('inf'), float('nan')],
+        'skip_backward_test': [True],
+        'skip_double_backward_test': [True],
+    })
+))
+class TestMish(UnaryMathTestBase, op_utils.NumpyOpTest):
+
+    def func(self, xp, a):
+        if xp is numpy:
+            return a * numpy.tanh(_numpy_softplus(a))
+        return xp.mish(a)
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*(
+    # Special shapes
+    chainer.testing.product({
+        'shape': [(), (0,), (1,), (2, 0, 3), (1, 1, 1), (2, 3)],
+        'in_dtypes,out_dtype': _in_out_dtypes_math_functions,
+        'input': [-4, -1, 1, 4],
+        'contiguous': [None, 'C'],
+    })
+    # Special values
+    + chainer.testing.product({
+        'shape': [(2, 3)],
+        'in_dtypes,out_dtype': _in_out_float_dtypes_math_functions,
+        'input': [0, float('inf'), -float('inf'), float('nan')],
+        'skip_backward_test': [True],
+        'skip_double_backward_test': [True],
+    })
+))
+class TestHardSwish(UnaryMathTestBase, op_utils.NumpyOpTest):
+
+    def func(self, xp, a):
+        if xp is numpy:
+            return a * numpy.clip(a + 3, 0, 6) / 6
+        return xp.hard_swish(a)
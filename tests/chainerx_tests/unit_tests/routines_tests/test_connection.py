@@ -98,6 +98,8 @@ def _convert_to_nhwc_layout(array):
 
 class _ConvTestBase(object):
 
+    dilate = 1
+
     def setup(self):
         if len(self.in_dtypes) == 3:
             x_dtype, w_dtype, b_dtype = self.in_dtypes
@@ -155,7 +157,9 @@ class _ConvTestBase(object):
             (x, w), b = inputs, None
         else:
             x, w, b = inputs
-        y = chainerx.conv(x, w, b, self.stride, self.pad, self.cover_all)
+        y = chainerx.conv(
+            x, w, b, self.stride, self.pad, self.cover_all,
+            dilate=self.dilate)
         return y,
 
     def forward_chainer(self, inputs):
@@ -170,7 +174,8 @@ class _ConvTestBase(object):
         if b is not None and b.dtype.kind != 'f':
             b = F.cast(b, 'float64')
         y = F.convolution_nd(
-            x, w, b, self.stride, self.pad, self.cover_all)
+            x, w, b, self.stride, self.pad, self.cover_all,
+            dilate=self.dilate)
         y = F.cast(y, self.out_dtype)
         return y,
 
@@ -211,6 +216,31 @@ class TestConv(_ConvTestBase, op_utils.ChainerOpTest):
     pass
 
 
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize_pytest(
+    'x_shape,w_shape,b_shape,stride,pad,dilate', [
+        ((1, 3, 7), (5, 3, 2), None, 1, 0, 2),
+        ((2, 3, 7), (5, 3, 3), (5,), 2, 1, 3),
+        ((2, 3, 6, 7), (2, 3, 3, 2), (2,), 1, (2, 0), 2),
+        ((1, 3, 6, 7), (2, 3, 3, 3), None, (2, 1), 1, (1, 3)),
+        ((1, 3, 5, 6, 7), (2, 3, 2, 3, 2), (2,), (1, 2, 3), (2, 0, 1),
+         (2, 1, 3)),
+    ])
+@chainer.testing.parameterize_pytest('in_dtypes,out_dtype', [
+    (('float32', 'float32'), 'float32'),
+    (('float64', 'float64'), 'float64'),
+])
+@chainer.testing.parameterize_pytest('cover_all', [True, False])
+class TestConvDilate(_ConvTestBase, op_utils.ChainerOpTest):
+
+    def generate_inputs(self):
+        x, w = super().generate_inputs()
+        if self.b_shape is None:
+            return x, w
+        b = array_utils.uniform(self.b_shape, self.in_dtypes[0])
+        return x, w, b
+
+
 # cudnnFindConvolutionForwardAlgorithmEx tends to choose an algorithm which
 # uses TensorCore when:
 # - The sizes of the input arrays are large
@@ -259,8 +289,23 @@ def test_conv_invalid(
                 cover_all, float_dtype))
 
 
+@pytest.mark.parametrize('x_shape,w_shape,dilate', [
+    ((2, 3, 4, 3), (5, 3, 2, 2), (1,)),  # Wrong number of dilations.
+    ((2, 3, 4, 3), (5, 3, 2, 2), (1, 0)),  # Non-positive dilation.
+    ((2, 3, 4, 3), (5, 3, 2, 2), 3),  # Dilated kernel larger than input.
+])
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_conv_invalid_dilate(device, x_shape, w_shape, dilate, float_dtype):
+    x = array_utils.create_dummy_ndarray(chainerx, x_shape, float_dtype)
+    w = array_utils.create_dummy_ndarray(chainerx, w_shape, float_dtype)
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.conv(x, w, None, 1, 0, dilate=dilate)
+
+
 class _ConvTransposeTestBase(object):
 
+    dilate = 1
+
     def setup(self):
         if len(self.in_dtypes) == 3:
             x_dtype, w_dtype, b_dtype = self.in_dtypes
@@ -314,10 +359,14 @@ class _ConvTransposeTestBase(object):
             stride_tup = (
                 (stride,) * ndim if isinstance(stride, int) else stride)
             pad_tup = (pad,) * ndim if isinstance(pad, int) else pad
+            dilate = self.dilate
+            dilate_tup = (
+                (dilate,) * ndim if isinstance(dilate, int) else dilate)
             outsize = tuple(
-                chainer.utils.conv.get_deconv_outsize(d, k, s, p, cover_all)
-                for (d, k, s, p)
-                in zip(in_dims, kernel_size, stride_tup, pad_tup))
+                chainer.utils.conv.get_deconv_outsize(
+                    d, k, s, p, cover_all, d=r)
+                for (d, k, s, p, r)
+                in zip(in_dims, kernel_size, stride_tup, pad_tup, dilate_tup))
         self.outsize = outsize
 
     def generate_inputs(self):
@@ -343,7 +392,7 @@ class _ConvTransposeTestBase(object):
         else:
             (x, w), b = inputs, None
         y = chainerx.conv_transpose(
-            x, w, b, self.stride, self.pad, self.outsize)
+            x, w, b, self.stride, self.pad, self.outsize, dilate=self.dilate)
         return y,
 
     def forward_chainer(self, inputs):
@@ -358,7 +407,7 @@ class _ConvTransposeTestBase(object):
         if b is not None and b.dtype.kind != 'f':
             b = F.cast(b, 'float64')
         y = chainer.functions.deconvolution_nd(
-            x, w, b, self.stride, self.pad, self.outsize)
+            x, w, b, self.stride, self.pad, self.outsize, dilate=self.dilate)
         y = F.cast(y, self.out_dtype)
         return y,
 
@@ -400,6 +449,32 @@ class TestConvTranspose(_ConvTransposeTestBase, op_utils.ChainerOpTest):
     pass
 
 
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize_pytest(
+    'x_shape,w_shape,b_shape,stride,pad,dilate', [
+        ((1, 3, 4), (3, 5, 2), None, 1, 0, 2),
+        ((2, 3, 4), (3, 5, 3), (5,), 2, 1, 3),
+        ((2, 3, 4, 4), (3, 2, 3, 2), (2,), 1, (2, 0), 2),
+        ((1, 3, 4, 4), (3, 2, 3, 3), None, (2, 1), 1, (1, 3)),
+        ((1, 3, 3, 4, 3), (3, 2, 2, 3, 2), (2,), (1, 2, 3), (2, 0, 1),
+         (2, 1, 3)),
+    ])
+@chainer.testing.parameterize_pytest('in_dtypes,out_dtype', [
+    (('float32', 'float32'), 'float32'),
+    (('float64', 'float64'), 'float64'),
+])
+# If None, outsize argument will be None.
+@chainer.testing.parameterize_pytest('cover_all', [None, True, False])
+class TestConvTransposeDilate(_ConvTransposeTestBase, op_utils.ChainerOpTest):
+
+    def generate_inputs(self):
+        x, w = super().generate_inputs()
+        if self.b_shape is None:
+            return x, w
+        b = array_utils.uniform(self.b_shape, self.in_dtypes[0])
+        return x, w, b
+
+
 # cudnnFindConvolutionForwardAlgorithmEx tends to choose an algorithm which
 # uses TensorCore when:
 # - The sizes of the input arrays are large
@@ -459,3 +459,114 @@ class TestNonzero(op_utils.NumpyOpTest):
     def forward_xp(self, inputs, xp):
         x, = inputs
         return xp.nonzero(x)
+
+
+def _embedding_bag_numpy(table, indices, offsets, mode, weights):
+    bounds = list(offsets) + [len(indices)]
+    dtype = 'float64' if mode == 'mean' else table.dtype
+    out = numpy.zeros((len(offsets), table.shape[1]), dtype)
+    for b in range(len(offsets)):
+        rows = table[indices[bounds[b]:bounds[b + 1]]]
+        if weights is not None:
+            rows = rows * weights[bounds[b]:bounds[b + 1], None]
+        if len(rows) > 0:
+            out[b] = getattr(numpy, mode)(rows, axis=0)
+    return out
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('table_shape,indices,offsets', [
+    ((5, 3), [3, 0, 3, 1, 4, 3, 0], [0, 2, 2, 5]),
+    ((4, 1), [2, 2, 1], [0]),
+    ((2, 4), [1, 0], [0, 1, 2]),
+    ((3, 2), [], [0, 0]),
+    ((3, 2), [], []),
+])
+@chainer.testing.parameterize_pytest('mode', ['sum', 'mean', 'max', 'min'])
+@chainer.testing.parameterize_pytest('weighted', [False, True])
+class TestEmbeddingBag(op_utils.NumpyOpTest):
+
+    def setup(self):
+        if self.weighted and self.mode != 'sum':
+            pytest.skip('Per-sample weights are only supported with sum')
+        self.indices = numpy.array(self.indices, dtype=numpy.int64)
+        self.offsets = numpy.array(self.offsets, dtype=numpy.int64)
+        if self.mode in ('max', 'min'):
+            self.skip_double_backward_test = True
+
+    def generate_inputs(self):
+        # Distinct values so that the maxima and minima are unique.
+        size = numpy.prod(self.table_shape)
+        table = numpy.random.permutation(size).reshape(self.table_shape)
+        table = (table * 0.1 - 1).astype('float64')
+        if not self.weighted:
+            return table,
+        weights = numpy.random.uniform(-1, 1, len(self.indices))
+        return table, weights.astype('float64')
+
+    def forward_xp(self, inputs, xp):
+        table = inputs[0]
+        weights = inputs[1] if self.weighted else None
+        if xp is numpy:
+            return _embedding_bag_numpy(
+                table, self.indices, self.offsets, self.mode, weights),
+        indices = chainerx.array(self.indices, device=table.device)
+        offsets = chainerx.array(self.offsets, device=table.device)
+        return chainerx.embedding_bag(
+            table, indices, offsets, mode=self.mode,
+            per_sample_weights=weights),
+
+
+@pytest.mark.parametrize('weighted', [False, True])
+@pytest.mark.parametrize_device(['native:0'])
+def test_embedding_bag_grad_multi_chunk(device, weighted):
+    # Enough indices to scatter the gradient in several chunks of rows of
+    # the table. The indices are unsorted, so that each row gathers from
+    # bags across the whole batch.
+    table_shape = (300, 16)
+    indices = numpy.random.randint(0, table_shape[0], 5000)
+    offsets = numpy.sort(numpy.random.randint(0, len(indices), 200))
+    offsets[0] = 0
+    gy = numpy.random.uniform(-1, 1, (len(offsets), table_shape[1]))
+    weights = numpy.random.uniform(-1, 1, len(indices))
+
+    bags = numpy.repeat(
+        numpy.arange(len(offsets)),
+        numpy.diff(numpy.append(offsets, len(indices))))
+    rows = gy[bags] * weights[:, None] if weighted else gy[bags]
+    expected = numpy.zeros(table_shape)
+    numpy.add.at(expected, indices, rows)
+
+    table = chainerx.zeros(table_shape, 'float64').require_grad()
+    y = chainerx.embedding_bag(
+        table, chainerx.array(indices), chainerx.array(offsets),
+        per_sample_weights=chainerx.array(weights) if weighted else None)
+    y.grad = chainerx.array(gy)
+    y.backward()
+    chainerx.testing.assert_allclose(table.grad, expected)
+
+
+@pytest.mark.parametrize('indices,offsets,mode,weights,error', [
+    # Indices out of bounds
+    ([0, 3], [0], 'sum', None, IndexError),
+    ([0, -1], [0], 'sum', None, IndexError),
+    # Offsets not starting from 0, decreasing or out of bounds
+    ([0, 1], [1], 'sum', None, IndexError),
+    ([0, 1, 1], [0, 2, 1], 'sum', None, IndexError),
+    ([0, 1], [0, 3], 'sum', None, IndexError),
+    # Weights with other reductions or of another shape
+    ([0, 1], [0], 'max', [1, 1], chainerx.ChainerxError),
+    ([0, 1], [0], 'sum', [1], chainerx.DimensionError),
+    # Unknown reduction
+    ([0, 1], [0], 'prod', None, ValueError),
+])
+@pytest.mark.parametrize_device(['native:0'])
+def test_embedding_bag_invalid(device, indices, offsets, mode, weights, error):
+    table = array_utils.create_dummy_ndarray(chainerx, (3, 2), 'float32')
+    indices = chainerx.array(indices, dtype='int64')
+    offsets = chainerx.array(offsets, dtype='int64')
+    if weights is not None:
+        weights = chainerx.array(weights, dtype='float32')
+    with pytest.raises(error):
+        chainerx.embedding_bag(
+            table, indices, offsets, mode=mode, per_sample_weights=weights)
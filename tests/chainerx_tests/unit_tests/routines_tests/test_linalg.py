@@ -113,6 +113,74 @@ def test_dot_invalid(is_module, xp, device, a_shape, b_shape, dtype):
         return a.dot(b)
 
 
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize_pytest('subscripts,shapes', [
+    ('ij,jk->ik', ((2, 3), (3, 4))),
+    ('ij,jk', ((2, 3), (3, 4))),
+    ('ji,jk->ki', ((3, 2), (3, 4))),
+    ('ij->ji', ((2, 3),)),
+    ('ij->', ((2, 3),)),
+    ('ii', ((3, 3),)),
+    ('ii->i', ((3, 3),)),
+    ('iij->ij', ((3, 3, 2),)),
+    ('i,i', ((3,), (3,))),
+    ('i,j', ((3,), (2,))),
+    ('ij,j->i', ((2, 3), (3,))),
+    ('ij,ij->ij', ((2, 3), (2, 3))),
+    ('ij,ij->ij', ((6, 7), (6, 7))),
+    ('ij,j->ij', ((6, 7), (7,))),
+    ('bi,bj->bij', ((3, 4), (3, 5))),
+    ('ij,ij->i', ((6, 7), (6, 7))),
+    ('bij,bjk->bik', ((2, 3, 4), (2, 4, 3))),
+    ('bhqd,bhkd->bhqk', ((2, 2, 3, 4), (2, 2, 5, 4))),
+    ('ijk,jil->kl', ((3, 2, 4), (2, 3, 5))),
+    ('ii,ij->j', ((3, 3), (3, 2))),
+    ('ij,jk,kl->il', ((2, 3), (3, 4), (4, 2))),
+    ('ab,bc,cd,de,ea->', ((2, 3), (3, 2), (2, 4), (4, 3), (3, 2))),
+    ('...ij,...jk->...ik', ((2, 3, 4), (2, 4, 3))),
+    ('...ij,jk', ((2, 1, 3, 4), (4, 2))),
+    ('i...->...', ((3, 2, 2),)),
+    ('ij,kj->ik', ((1, 3), (2, 3))),
+    ('ij,jk->ik', ((2, 0), (0, 3))),
+])
+@chainer.testing.parameterize_pytest('dtype', chainerx.testing.float_dtypes)
+class TestEinsum(op_utils.NumpyOpTest):
+
+    def setup(self):
+        if self.dtype == 'float16':
+            self.check_forward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_backward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-2, 'atol': 1e-2})
+
+    def generate_inputs(self):
+        return tuple(
+            numpy.random.uniform(-1, 1, shape).astype(self.dtype)
+            for shape in self.shapes)
+
+    def forward_xp(self, inputs, xp):
+        y = xp.einsum(self.subscripts, *inputs)
+        y = dtype_utils.cast_if_numpy_array(xp, y, self.dtype)
+        return y,
+
+
+@pytest.mark.parametrize('subscripts,shapes,error', [
+    ('ij,jk', ((2, 3),), chainerx.ChainerxError),
+    ('ij->ii', ((2, 3),), chainerx.ChainerxError),
+    ('ij->k', ((2, 3),), chainerx.ChainerxError),
+    ('i1', ((2, 3),), chainerx.ChainerxError),
+    ('ij', ((2, 3, 4),), chainerx.DimensionError),
+    ('ij,jk', ((2, 3), (4, 5)), chainerx.DimensionError),
+])
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_einsum_invalid(device, subscripts, shapes, error):
+    operands = [
+        array_utils.create_dummy_ndarray(chainerx, shape, 'float32')
+        for shape in shapes]
+    with pytest.raises(error):
+        chainerx.einsum(subscripts, *operands)
+
+
 class NumpyLinalgOpTest(op_utils.NumpyOpTest):
 
     dodge_nondifferentiable = True
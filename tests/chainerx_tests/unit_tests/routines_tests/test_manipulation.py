@@ -594,6 +594,106 @@ def test_concatenate_insufficient_inputs():
         chainerx.concatenate([])
 
 
+class PackTestBase(JoinTestBase):
+
+    dtype = None
+    transpose = False
+
+    def join(self, inputs, xp):
+        if self.transpose:
+            inputs = [a.T for a in inputs]
+        if xp is numpy:
+            b = numpy.concatenate([a.ravel() for a in inputs])
+            if self.dtype is not None:
+                b = b.astype(self.dtype)
+            return b
+        return xp.pack(inputs, self.dtype)
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize_pytest('shapes', [
+    [(0,)],
+    [(3,)],
+    [(0,), (2, 0)],
+    [(2, 3), (4,), ()],
+    [(2, 3, 4), (1, 5), (3, 1)],
+])
+@chainer.testing.parameterize_pytest('dtype', [None, 'float16', 'float64'])
+@chainer.testing.parameterize_pytest('transpose', [False, True])
+class TestPack(PackTestBase):
+
+    def setup(self):
+        self.dtypes = ['float32'] * len(self.shapes)
+        super().setup()
+        if self.dtype == 'float16':
+            self.check_forward_options.update({'rtol': 1e-3, 'atol': 1e-3})
+            self.check_backward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-2, 'atol': 1e-2})
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize_pytest('shapes', [
+    [(2, 3), (4,)],
+])
+@chainer.testing.parameterize_pytest(
+    'dtypes,chx_expected_dtype', dtype_utils.result_dtypes_two_arrays)
+class TestPackTwoArraysMixedDtypes(PackTestBase):
+    pass
+
+
+def test_pack_insufficient_inputs():
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.pack([])
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+@pytest.mark.parametrize('packed_dtype,dtype', [
+    ('float32', 'float32'),
+    ('float16', 'float32'),
+    ('float32', 'float64'),
+    ('float32', 'int32'),
+])
+@pytest.mark.parametrize('scale', [1, 0.5])
+def test_unpack(device, packed_dtype, dtype, scale):
+    if numpy.dtype(dtype).kind != 'f' and scale != 1:
+        # The scale is cast to the dtype of the arrays.
+        return
+    shapes = [(2, 3), (4,), (), (3, 0)]
+    expected = [
+        array_utils.create_dummy_ndarray(numpy, shape, dtype)
+        for shape in shapes]
+    packed = chainerx.array(
+        numpy.concatenate([a.ravel() for a in expected]).astype(packed_dtype))
+    # Non-contiguous arrays are written through their strides.
+    arrays = [
+        array_utils.create_dummy_ndarray(chainerx, shape, dtype, padding=True)
+        for shape in shapes]
+    arrays[0] = chainerx.zeros((3, 2), dtype).T
+
+    chainerx.unpack(packed, arrays, scale)
+
+    for a, e in zip(arrays, expected):
+        chainerx.testing.assert_array_equal_ex(
+            a, (e * scale).astype(dtype), strides_check=False)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_unpack_invalid_size(device):
+    packed = chainerx.zeros((5,), 'float32')
+    arrays = [chainerx.zeros((2, 3), 'float32')]
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.unpack(packed, arrays)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_unpack_requires_grad(device):
+    packed = chainerx.zeros((6,), 'float32')
+    arrays = [chainerx.zeros((2, 3), 'float32').require_grad()]
+    with pytest.raises(chainerx.ChainerxError):
+        chainerx.unpack(packed, arrays)
+
+
 class StackTestBase(JoinTestBase):
 
     axis = None
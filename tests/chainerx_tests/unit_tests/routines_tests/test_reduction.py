@@ -333,3 +333,143 @@ class TestNansum(math_utils.UnaryMathTestBase, op_utils.NumpyOpTest):
 
     def func(self, xp, a):
         return xp.nansum(a, axis=self.axis, keepdims=self.keepdims)
+
+
+def _segment_reduce_numpy(a, segment_ids, num_segments, reduce, dtype):
+    out = numpy.zeros((num_segments,) + a.shape[1:], dtype)
+    for i in range(num_segments):
+        rows = a[segment_ids == i]
+        if len(rows) > 0:
+            out[i] = getattr(numpy, reduce)(rows, axis=0)
+    return out
+
+
+_segment_reduce_params = [
+    ((6,), [0, 2, 2, 0, 1, 2], 3),
+    ((6, 3), [3, 1, 3, 0, 1, 3], 5),
+    ((5, 2, 2), [1, 1, 0, 1, 1], 2),
+    ((1, 3), [0], 1),
+    ((0, 3), [], 2),
+]
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest(
+    'shape,segment_ids,num_segments', _segment_reduce_params)
+@chainer.testing.parameterize_pytest('reduce', ['sum', 'mean', 'max', 'min'])
+@chainer.testing.parameterize_pytest('sorted', [False, True])
+@chainer.testing.parameterize_pytest('dtype', ['float32', 'float64'])
+class TestSegmentReduce(op_utils.NumpyOpTest):
+
+    def setup(self):
+        self.ids = numpy.array(self.segment_ids, dtype=numpy.int64)
+        if self.sorted:
+            self.ids.sort()
+        if self.reduce in ('max', 'min'):
+            self.skip_double_backward_test = True
+        if self.dtype == 'float32':
+            self.check_backward_options.update({'rtol': 1e-3, 'atol': 1e-3})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-3, 'atol': 1e-3})
+
+    def generate_inputs(self):
+        # Distinct values so that the maxima and minima are unique.
+        size = numpy.prod(self.shape, dtype=numpy.int64)
+        a = numpy.random.permutation(size).reshape(self.shape)
+        return (a * 0.1 - 1).astype(self.dtype),
+
+    def forward_xp(self, inputs, xp):
+        a, = inputs
+        if xp is numpy:
+            return _segment_reduce_numpy(
+                a, self.ids, self.num_segments, self.reduce, self.dtype),
+        ids = chainerx.array(self.ids, device=a.device)
+        func = getattr(chainerx, 'segment_' + self.reduce)
+        return func(a, ids, self.num_segments, sorted=self.sorted),
+
+
+@pytest.mark.parametrize('reduce', ['sum', 'mean', 'max', 'min'])
+@pytest.mark.parametrize('sorted', [False, True])
+@pytest.mark.parametrize('dtype', ['int8', 'int32', 'float64'])
+@pytest.mark.parametrize_device(['native:0'])
+def test_segment_reduce_multi_chunk(device, reduce, sorted, dtype):
+    # Enough rows to be reduced in several chunks. Sorted segments are long
+    # enough to cross the boundaries of the chunks.
+    n = 50000
+    num_segments = 100
+    ids = numpy.random.randint(0, num_segments, n)
+    if sorted:
+        ids.sort()
+    if dtype == 'float64':
+        a = numpy.random.uniform(-1, 1, (n, 2))
+    else:
+        # The sums overflow int8, which the means must not.
+        a = numpy.random.randint(-100, 100, (n, 2)).astype(dtype)
+    out_dtype = 'float32' if reduce == 'mean' and dtype != 'float64' else dtype
+    expected = _segment_reduce_numpy(a, ids, num_segments, reduce, out_dtype)
+
+    func = getattr(chainerx, 'segment_' + reduce)
+    out = func(
+        chainerx.array(a), chainerx.array(ids), num_segments, sorted=sorted)
+    chainerx.testing.assert_allclose_ex(out, expected, rtol=1e-6, atol=1e-6)
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('a_shape,b_shape,indices', [
+    ((4,), (5,), [3, 1, 3, 0, 3]),
+    ((3, 2), (4, 2), [2, 2, 0, 2]),
+    ((2, 3), (0, 3), []),
+])
+@chainer.testing.parameterize_pytest('reduce', ['sum', 'mean', 'max', 'min'])
+class TestScatterReduce(op_utils.NumpyOpTest):
+
+    def setup(self):
+        self.indices = numpy.array(self.indices, dtype=numpy.int64)
+        if self.reduce in ('max', 'min'):
+            self.skip_double_backward_test = True
+
+    def generate_inputs(self):
+        size = (numpy.prod(self.a_shape, dtype=numpy.int64)
+                + numpy.prod(self.b_shape, dtype=numpy.int64))
+        values = (numpy.random.permutation(size) * 0.1 - 1).astype('float64')
+        a = values[:numpy.prod(self.a_shape)].reshape(self.a_shape)
+        b = values[numpy.prod(self.a_shape):].reshape(self.b_shape)
+        return a, b
+
+    def forward_xp(self, inputs, xp):
+        a, b = inputs
+        if xp is numpy:
+            ab = numpy.concatenate([a, b])
+            indices = numpy.concatenate([numpy.arange(len(a)), self.indices])
+            return _segment_reduce_numpy(
+                ab, indices, len(a), self.reduce, 'float64'),
+        indices = chainerx.array(self.indices, device=a.device)
+        return chainerx.scatter_reduce(a, indices, b, reduce=self.reduce),
+
+
+@pytest.mark.parametrize('segment_ids,num_segments,sorted,error', [
+    # Out of bounds
+    ([0, 1, 3], 3, False, IndexError),
+    ([0, -1, 2], 3, False, IndexError),
+    # Not sorted
+    ([1, 0, 2], 3, True, chainerx.ChainerxError),
+    # Length mismatch
+    ([0, 1], 3, False, chainerx.DimensionError),
+    # Negative number of segments
+    ([0, 0, 0], -1, False, chainerx.DimensionError),
+])
+@pytest.mark.parametrize_device(['native:0'])
+def test_segment_sum_invalid(
+        device, segment_ids, num_segments, sorted, error):
+    a = array_utils.create_dummy_ndarray(chainerx, (3, 2), 'float32')
+    ids = chainerx.array(segment_ids, dtype='int64')
+    with pytest.raises(error):
+        chainerx.segment_sum(a, ids, num_segments, sorted=sorted)
+
+
+@pytest.mark.parametrize_device(['native:0'])
+def test_scatter_reduce_invalid_reduce(device):
+    a = array_utils.create_dummy_ndarray(chainerx, (3, 2), 'float32')
+    indices = chainerx.array([0, 2], dtype='int64')
+    with pytest.raises(ValueError):
+        chainerx.scatter_reduce(a, indices, a[:2], reduce='prod')
@@ -2,9 +2,12 @@ import unittest
 
 import chainer
 import numpy
+import pytest
 
+import chainerx
 import chainerx.testing
 
+from chainerx_tests import array_utils
 from chainerx_tests import op_utils
 
 
@@ -235,3 +238,108 @@ class TestNanArgmin(op_utils.NumpyOpTest):
         axis = self.axis
         b = xp.nanargmin(a, axis)
         return b,
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('shape,high', [
+    ((0,), 3),
+    ((1,), 3),
+    ((7,), 3),
+    ((3, 4), 3),
+    # Enough elements to be sorted in several chunks, with runs of equal
+    # values which span the boundaries of the chunks.
+    ((100000,), 3),
+    ((100000,), 100),
+])
+@chainer.testing.parameterize_pytest('return_index', [True, False])
+@chainer.testing.parameterize_pytest('return_inverse', [True, False])
+@chainer.testing.parameterize_pytest('return_counts', [True, False])
+class TestUnique(op_utils.NumpyOpTest):
+
+    skip_backward_test = True
+    skip_double_backward_test = True
+
+    def setup(self, dtype):
+        self.dtype = dtype
+
+    def generate_inputs(self):
+        a = numpy.random.randint(0, self.high, self.shape).astype(self.dtype)
+        return a,
+
+    def forward_xp(self, inputs, xp):
+        a, = inputs
+        out = xp.unique(
+            a, return_index=self.return_index,
+            return_inverse=self.return_inverse,
+            return_counts=self.return_counts)
+        if not isinstance(out, tuple):
+            return out,
+        if xp is numpy and self.return_inverse:
+            # NumPy may not flatten the inverse indices.
+            inverse_index = 2 if self.return_index else 1
+            out = list(out)
+            out[inverse_index] = out[inverse_index].ravel()
+        return tuple(out)
+
+
+@pytest.mark.parametrize_device(['native:0'])
+def test_unique_nan(device):
+    a = chainerx.array([2, float('nan'), 1, float('nan'), 2], 'float32')
+    unique, index, inverse, counts = chainerx.unique(
+        a, return_index=True, return_inverse=True, return_counts=True)
+    chainerx.testing.assert_array_equal(
+        unique, numpy.array([1, 2, float('nan')], 'float32'))
+    chainerx.testing.assert_array_equal(index, numpy.array([2, 0, 1]))
+    chainerx.testing.assert_array_equal(
+        inverse, numpy.array([1, 2, 0, 2, 1]))
+    chainerx.testing.assert_array_equal(counts, numpy.array([1, 2, 2]))
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('a_shape,v_shape', [
+    ((1,), ()),
+    ((5,), (3,)),
+    ((5,), (2, 3)),
+    ((0,), (3,)),
+    ((2, 5), (2, 3)),
+    ((2, 3, 4), (2, 3, 1)),
+])
+@chainer.testing.parameterize_pytest('side', ['left', 'right'])
+class TestSearchsorted(op_utils.NumpyOpTest):
+
+    skip_backward_test = True
+    skip_double_backward_test = True
+
+    def setup(self, numeric_dtype):
+        self.dtype = numeric_dtype
+
+    def generate_inputs(self):
+        a = numpy.sort(numpy.random.randint(0, 6, self.a_shape), axis=-1)
+        v = numpy.random.randint(-1, 7, self.v_shape)
+        return a.astype(self.dtype), v.astype(self.dtype)
+
+    def forward_xp(self, inputs, xp):
+        a, v = inputs
+        if xp is chainerx:
+            return chainerx.searchsorted(a, v, side=self.side),
+        if a.ndim == 1:
+            return numpy.asarray(numpy.searchsorted(a, v, side=self.side)),
+        rows_a = a.reshape(-1, a.shape[-1])
+        rows_v = v.reshape(-1, v.shape[-1])
+        out = [numpy.searchsorted(row_a, row_v, side=self.side)
+               for row_a, row_v in zip(rows_a, rows_v)]
+        return numpy.array(out, dtype=numpy.int64).reshape(v.shape),
+
+
+@pytest.mark.parametrize('a_shape,v_shape,side,error', [
+    ((), (3,), 'left', chainerx.DimensionError),
+    ((2, 5), (3, 3), 'left', chainerx.DimensionError),
+    ((2, 5), (3,), 'left', chainerx.DimensionError),
+    ((5,), (3,), 'middle', ValueError),
+])
+@pytest.mark.parametrize_device(['native:0'])
+def test_searchsorted_invalid(device, a_shape, v_shape, side, error):
+    a = array_utils.create_dummy_ndarray(chainerx, a_shape, 'float32')
+    v = array_utils.create_dummy_ndarray(chainerx, v_shape, 'float32')
+    with pytest.raises(error):
+        chainerx.searchsorted(a, v, side=side)
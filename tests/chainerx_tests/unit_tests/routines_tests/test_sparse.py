@@ -0,0 +1,143 @@
+import numpy
+import pytest
+
+import chainer.testing
+import chainerx
+import chainerx.testing
+
+from chainerx_tests import array_utils
+from chainerx_tests import op_utils
+
+
+def _make_coo_indices(shape, nnz):
+    # Unsorted indices with duplicate positions.
+    row = numpy.arange(nnz) * 7 % shape[0]
+    col = numpy.arange(nnz) * 5 % shape[1]
+    return row, col
+
+
+def _coo_to_dense(xp, data, row, col, shape):
+    if xp is chainerx:
+        return chainerx.sparse.coo_matrix(data, row, col, shape).todense()
+    a = numpy.zeros(shape, data.dtype)
+    numpy.add.at(a, (row, col), data)
+    return a
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('shape,nnz', [
+    ((3, 4), 6),
+    ((5, 2), 10),
+    ((1, 3), 2),
+    ((4, 3), 0),
+])
+@chainer.testing.parameterize_pytest('b_shape_tail', [(), (3,)])
+@chainer.testing.parameterize_pytest('sparse_format', ['coo', 'csr'])
+@chainer.testing.parameterize_pytest('dtype', ['float32', 'float64'])
+class TestSparseMatmul(op_utils.NumpyOpTest):
+
+    def setup(self):
+        self.row, self.col = _make_coo_indices(self.shape, self.nnz)
+        if self.dtype == 'float32':
+            self.check_backward_options.update({'rtol': 1e-3, 'atol': 1e-3})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-3, 'atol': 1e-3})
+
+    def generate_inputs(self):
+        data = numpy.random.uniform(-1, 1, (self.nnz,)).astype(self.dtype)
+        b_shape = (self.shape[1],) + self.b_shape_tail
+        b = numpy.random.uniform(-1, 1, b_shape).astype(self.dtype)
+        return data, b
+
+    def forward_xp(self, inputs, xp):
+        data, b = inputs
+        if xp is numpy:
+            a = _coo_to_dense(numpy, data, self.row, self.col, self.shape)
+            return a.dot(b),
+        device = chainerx.get_default_device()
+        row = chainerx.array(self.row, device=device)
+        col = chainerx.array(self.col, device=device)
+        a = chainerx.sparse.coo_matrix(data, row, col, self.shape)
+        if self.sparse_format == 'csr':
+            a = a.tocsr()
+        return chainerx.sparse.matmul(a, b),
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('shape,nnz', [
+    ((3, 4), 6),
+    ((5, 2), 10),
+    ((4, 3), 0),
+])
+class TestSparseToDense(op_utils.NumpyOpTest):
+
+    def setup(self):
+        self.row, self.col = _make_coo_indices(self.shape, self.nnz)
+
+    def generate_inputs(self):
+        data = numpy.random.uniform(-1, 1, (self.nnz,)).astype('float32')
+        return data,
+
+    def forward_xp(self, inputs, xp):
+        data, = inputs
+        if xp is chainerx:
+            device = chainerx.get_default_device()
+            row = chainerx.array(self.row, device=device)
+            col = chainerx.array(self.col, device=device)
+        else:
+            row, col = self.row, self.col
+        return _coo_to_dense(xp, data, row, col, self.shape),
+
+
+@pytest.mark.parametrize('shape', [(3, 4), (1, 5), (0, 2)])
+@pytest.mark.parametrize_device(['native:0'])
+def test_sparse_conversions(device, shape):
+    a_np = numpy.random.uniform(-1, 1, shape).astype('float32')
+    a_np[a_np < 0] = 0
+    a = chainerx.array(a_np)
+
+    coo = chainerx.sparse.to_coo(a)
+    csr = chainerx.sparse.to_csr(a)
+    row, col = numpy.nonzero(a_np)
+    assert coo.shape == shape
+    assert csr.shape == shape
+    assert coo.nnz == csr.nnz == len(row)
+    chainerx.testing.assert_array_equal(coo.row, row.astype('int64'))
+    chainerx.testing.assert_array_equal(coo.col, col.astype('int64'))
+    chainerx.testing.assert_array_equal(csr.indices, col.astype('int64'))
+    indptr = numpy.concatenate([[0], numpy.cumsum((a_np != 0).sum(axis=1))])
+    chainerx.testing.assert_array_equal(csr.indptr, indptr.astype('int64'))
+    chainerx.testing.assert_array_equal(coo.todense(), a_np)
+    chainerx.testing.assert_array_equal(csr.todense(), a_np)
+    chainerx.testing.assert_array_equal(coo.tocsr().todense(), a_np)
+    chainerx.testing.assert_array_equal(csr.tocoo().todense(), a_np)
+
+
+@pytest.mark.parametrize_device(['native:0'])
+def test_sparse_matrix_invalid(device):
+    data = array_utils.create_dummy_ndarray(chainerx, (3,), 'float32')
+    row = chainerx.array([0, 1, 2])
+    col = chainerx.array([0, 1, 3])
+    with pytest.raises(IndexError):
+        chainerx.sparse.coo_matrix(data, row, col, (3, 3))
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.sparse.coo_matrix(data, row, col[:2], (3, 4))
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.sparse.coo_matrix(data, row, col, (3, 4, 1))
+    with pytest.raises(chainerx.DtypeError):
+        chainerx.sparse.coo_matrix(data, row.astype('float32'), col, (3, 4))
+    with pytest.raises(IndexError):
+        chainerx.sparse.csr_matrix(
+            data, col, chainerx.array([0, 2, 1, 3]), (3, 4))
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.sparse.csr_matrix(
+            data, col, chainerx.array([0, 3]), (3, 4))
+
+    a = chainerx.sparse.coo_matrix(data, row, col, (3, 4))
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.sparse.matmul(
+            a, array_utils.create_dummy_ndarray(chainerx, (3, 2), 'float32'))
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.sparse.matmul(
+            a, array_utils.create_dummy_ndarray(
+                chainerx, (4, 2, 1), 'float32'))
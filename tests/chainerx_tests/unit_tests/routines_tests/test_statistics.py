@@ -303,3 +303,189 @@ def test_valid_stats(is_module, func, xp, device, input, axis, dtypes):
 # TODO(kshitij12345): Remove strides_check=False
 def test_invalid_stats(is_module, func, xp, device, input, axis, dtypes):
     return apply_func(is_module, func, xp, device, input, axis, dtypes)
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('length,high,minlength', [
+    (0, 1, 0),
+    (0, 1, 3),
+    (1, 1, 0),
+    (10, 4, 0),
+    (10, 4, 7),
+    (100, 20, 5),
+    # Enough elements to be counted in several chunks.
+    (100000, 20, 5),
+    (100000, 1000, 0),
+])
+@chainer.testing.parameterize_pytest('weighted', [True, False])
+class TestBincount(op_utils.NumpyOpTest):
+
+    skip_backward_test = True
+    skip_double_backward_test = True
+
+    def generate_inputs(self):
+        x = numpy.random.randint(0, self.high, self.length).astype('int32')
+        if not self.weighted:
+            return x,
+        # NumPy always sums the weights in float64.
+        weights = numpy.random.uniform(-1, 1, self.length)
+        return x, weights.astype('float64')
+
+    def forward_xp(self, inputs, xp):
+        x = inputs[0]
+        weights = inputs[1] if self.weighted else None
+        out = xp.bincount(x, weights=weights, minlength=self.minlength)
+        if xp is numpy and not self.weighted:
+            out = out.astype('int64')
+        return out,
+
+
+@pytest.mark.parametrize('x,dtype,minlength,error', [
+    ([1, -1], 'int32', 0, chainerx.ChainerxError),
+    ([1, 2], 'float32', 0, chainerx.DtypeError),
+    ([[1, 2]], 'int32', 0, chainerx.DimensionError),
+    ([1, 2], 'int32', -1, chainerx.ChainerxError),
+])
+@pytest.mark.parametrize_device(['native:0'])
+def test_bincount_invalid(device, x, dtype, minlength, error):
+    x = chainerx.array(x, dtype)
+    with pytest.raises(error):
+        chainerx.bincount(x, minlength=minlength)
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest(
+    'shape', [(0,), (1,), (10,), (4, 5), (100000,)])
+@chainer.testing.parameterize_pytest('bins,range', [
+    (1, None),
+    (4, None),
+    (4, (-0.5, 0.5)),
+    (10, (0, 1)),
+    ([-1, 0, 0.5, 2], None),
+])
+@chainer.testing.parameterize_pytest('weighted', [True, False])
+class TestHistogram(op_utils.NumpyOpTest):
+
+    skip_backward_test = True
+    skip_double_backward_test = True
+
+    def setup(self, float_dtype):
+        self.dtype = float_dtype
+        if self.dtype == 'float16' and self.shape == (100000,):
+            # NumPy rounds the sums of the weights of blocks of elements to
+            # float16 before adding them, while ChainerX rounds only once.
+            self.check_forward_options.update({'rtol': 1e-2, 'atol': 1e-1})
+
+    def generate_inputs(self):
+        a = numpy.random.uniform(-1, 1, self.shape).astype(self.dtype)
+        if not self.weighted:
+            return a,
+        weights = numpy.random.uniform(-1, 1, self.shape)
+        return a, weights.astype(self.dtype)
+
+    def forward_xp(self, inputs, xp):
+        a = inputs[0]
+        weights = inputs[1] if self.weighted else None
+        bins = self.bins
+        if isinstance(bins, list):
+            bins = xp.array(bins, self.dtype)
+        hist, edges = xp.histogram(
+            a, bins=bins, range=self.range, weights=weights)
+        if xp is numpy:
+            if not self.weighted:
+                hist = hist.astype('int64')
+            edges = edges.astype(self.dtype)
+        return hist, edges
+
+
+@pytest.mark.parametrize('a,bins,range,error', [
+    ([1, 2], 0, None, chainerx.ChainerxError),
+    ([1, 2], 2, (1, 0), chainerx.ChainerxError),
+    ([1, float('nan')], 2, None, chainerx.ChainerxError),
+    ([1, 2], [0, 2, 1], None, chainerx.ChainerxError),
+    ([1, 2], [0], None, chainerx.DimensionError),
+])
+@pytest.mark.parametrize_device(['native:0'])
+def test_histogram_invalid(device, a, bins, range, error):
+    a = chainerx.array(a, 'float32')
+    if isinstance(bins, list):
+        bins = chainerx.array(bins, 'float32')
+    with pytest.raises(error):
+        chainerx.histogram(a, bins=bins, range=range)
+
+
+@op_utils.op_test(['native:0'])
+@chainer.testing.parameterize_pytest('shape,axis', [
+    ((), None),
+    ((1,), None),
+    ((6,), 0),
+    ((2, 7), None),
+    ((2, 7), 1),
+    ((2, 7), -2),
+    ((2, 3, 4), (0, 2)),
+    ((2, 3, 4), (2, 1)),
+])
+@chainer.testing.parameterize_pytest('keepdims', [True, False])
+@chainer.testing.parameterize_pytest('func,q', [
+    ('median', None),
+    ('nanmedian', None),
+    ('quantile', 0.3),
+    ('quantile', [0, 0.5, 0.25, 1]),
+    ('nanquantile', [0.75, 0.1]),
+    ('percentile', 90),
+    ('percentile', [10, 50]),
+    ('nanpercentile', 33.3),
+])
+class TestQuantile(op_utils.NumpyOpTest):
+
+    skip_backward_test = True
+    skip_double_backward_test = True
+
+    def setup(self, float_dtype):
+        self.dtype = float_dtype
+        if float_dtype == 'float16':
+            self.check_forward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+
+    def generate_inputs(self):
+        a = numpy.random.uniform(-1, 1, self.shape).astype(self.dtype)
+        if self.func.startswith('nan') and a.size > 1:
+            # Leave at least one element which is not NaN in every row.
+            a.ravel()[1::3] = numpy.nan
+        return a,
+
+    def forward_xp(self, inputs, xp):
+        a, = inputs
+        func = getattr(xp, self.func)
+        if self.q is None:
+            out = func(a, axis=self.axis, keepdims=self.keepdims)
+        else:
+            out = func(a, self.q, axis=self.axis, keepdims=self.keepdims)
+        if xp is numpy:
+            out = numpy.asarray(out, dtype=self.dtype)
+        return out,
+
+
+@pytest.mark.parametrize_device(['native:0'])
+def test_median_nan(device):
+    a = chainerx.array(
+        [[1, float('nan'), 3], [float('nan')] * 3], 'float32')
+    chainerx.testing.assert_array_equal(
+        chainerx.median(a, axis=1),
+        numpy.array([float('nan')] * 2, 'float32'))
+    chainerx.testing.assert_array_equal(
+        chainerx.nanmedian(a, axis=1),
+        numpy.array([2, float('nan')], 'float32'))
+
+
+@pytest.mark.parametrize('func,q,dtype,error', [
+    ('quantile', 1.5, 'float32', chainerx.ChainerxError),
+    ('quantile', [0.5, -0.1], 'float32', chainerx.ChainerxError),
+    ('percentile', 101, 'float32', chainerx.ChainerxError),
+    ('nanpercentile', -1, 'float32', chainerx.ChainerxError),
+    ('quantile', 0.5, 'bool_', chainerx.DtypeError),
+])
+@pytest.mark.parametrize_device(['native:0'])
+def test_quantile_invalid(device, func, q, dtype, error):
+    a = array_utils.create_dummy_ndarray(chainerx, (2, 3), dtype)
+    with pytest.raises(error):
+        getattr(chainerx, func)(a, q)